@@ -0,0 +1,73 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/benchmarks/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "heraConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "benchmarks/CMakeFiles/bench_byteswap.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_compare.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_csv.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_delta.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_format.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_group_by.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_hash.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_hash_join.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_json.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_log.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_radix_sort.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_regex.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_search.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_serialize.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_soa_vector.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_static_map.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_table.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bench_tuple_builder.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_csv.dir/csv.cpp.o"
+  "CMakeFiles/bench_csv.dir/csv.cpp.o.d"
+  "bench_csv"
+  "bench_csv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_csv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
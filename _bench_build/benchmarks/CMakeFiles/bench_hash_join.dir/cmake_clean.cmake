@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_hash_join.dir/hash_join.cpp.o"
+  "CMakeFiles/bench_hash_join.dir/hash_join.cpp.o.d"
+  "bench_hash_join"
+  "bench_hash_join.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_hash_join.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_radix_sort.dir/radix_sort.cpp.o"
+  "CMakeFiles/bench_radix_sort.dir/radix_sort.cpp.o.d"
+  "bench_radix_sort"
+  "bench_radix_sort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_radix_sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_soa_vector.dir/soa_vector.cpp.o"
+  "CMakeFiles/bench_soa_vector.dir/soa_vector.cpp.o.d"
+  "bench_soa_vector"
+  "bench_soa_vector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_soa_vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_static_map.dir/static_map.cpp.o"
+  "CMakeFiles/bench_static_map.dir/static_map.cpp.o.d"
+  "bench_static_map"
+  "bench_static_map.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_static_map.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_table.dir/table.cpp.o"
+  "CMakeFiles/bench_table.dir/table.cpp.o.d"
+  "bench_table"
+  "bench_table.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_tuple_builder.dir/tuple_builder.cpp.o"
+  "CMakeFiles/bench_tuple_builder.dir/tuple_builder.cpp.o.d"
+  "bench_tuple_builder"
+  "bench_tuple_builder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_tuple_builder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string_view>
+
+// minimal timing helpers shared by the benchmarks
+
+namespace bench
+{
+template<typename T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+/// runs `fn` `repetitions` times and reports the best run, `fn` must process
+/// `items` items per call.
+template<typename F>
+double run(std::string_view name,
+           std::size_t      items,
+           std::size_t      repetitions,
+           F&&              fn)
+{
+    using clock = std::chrono::steady_clock;
+
+    auto best = clock::duration::max();
+
+    for (std::size_t i = 0; i < repetitions; ++i)
+    {
+        const auto start = clock::now();
+        fn();
+        const auto elapsed = clock::now() - start;
+
+        if (elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+
+    const double ns =
+        std::chrono::duration<double, std::nano>(best).count() / items;
+
+    std::printf("%-40.*s %10.2f ns/item\n",
+                static_cast<int>(name.size()),
+                name.data(),
+                ns);
+
+    return ns;
+}
+
+/// like `run` but reports a throughput for `bytes` bytes processed per call
+template<typename F>
+double run_bytes(std::string_view name,
+                 std::size_t      bytes,
+                 std::size_t      repetitions,
+                 F&&              fn)
+{
+    using clock = std::chrono::steady_clock;
+
+    auto best = clock::duration::max();
+
+    for (std::size_t i = 0; i < repetitions; ++i)
+    {
+        const auto start = clock::now();
+        fn();
+        const auto elapsed = clock::now() - start;
+
+        if (elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+
+    const double gbps =
+        bytes / std::chrono::duration<double, std::nano>(best).count();
+
+    std::printf("%-40.*s %10.2f GB/s\n",
+                static_cast<int>(name.size()),
+                name.data(),
+                gbps);
+
+    return gbps;
+}
+} // namespace bench
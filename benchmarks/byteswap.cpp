@@ -0,0 +1,78 @@
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "bench.hpp"
+#include "hera/algorithm/byteswap.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/view/byteswap.hpp"
+#include "hera/view/ref.hpp"
+
+namespace
+{
+template<typename T>
+void bench_bulk(const char* hera_name, const char* scalar_name)
+{
+    constexpr std::size_t count       = (1 << 20) / sizeof(T);
+    constexpr std::size_t repetitions = 200;
+
+    std::vector<T> values(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        values[i] = static_cast<T>(i * 0x9e3779b97f4a7c15);
+    }
+
+    bench::run_bytes(hera_name, count * sizeof(T), repetitions, [&] {
+        hera::byteswap(std::span<T>{values});
+        bench::do_not_optimize(values.data());
+    });
+
+    bench::run_bytes(scalar_name, count * sizeof(T), repetitions, [&] {
+        for (auto& v : values)
+        {
+            v = hera::detail::byteswap(v);
+            // keeps the compiler from vectorizing the loop itself
+            bench::do_not_optimize(v);
+        }
+    });
+}
+} // namespace
+
+int main()
+{
+    bench_bulk<std::uint16_t>("hera::byteswap 16 bit", "bswap loop 16 bit");
+    bench_bulk<std::uint32_t>("hera::byteswap 32 bit", "bswap loop 32 bit");
+    bench_bulk<std::uint64_t>("hera::byteswap 64 bit", "bswap loop 64 bit");
+
+    using record = hera::tuple<std::uint64_t, std::uint32_t, std::uint16_t>;
+
+    std::vector<record> wire;
+    for (std::uint32_t i = 0; i < (1 << 16); ++i)
+    {
+        wire.push_back(record{hera::detail::byteswap(std::uint64_t{i}),
+                              hera::detail::byteswap(i),
+                              hera::detail::byteswap(std::uint16_t(i))});
+    }
+
+    bench::run("views::byteswap record", wire.size(), 50, [&] {
+        std::uint64_t sum = 0;
+        for (const auto& r : wire)
+        {
+            auto decoded = hera::ref_view{r} | hera::views::byteswap;
+            sum += hera::get<0>(decoded) + hera::get<1>(decoded) +
+                   hera::get<2>(decoded);
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    bench::run("hand-written record swap", wire.size(), 50, [&] {
+        std::uint64_t sum = 0;
+        for (const auto& r : wire)
+        {
+            sum += __builtin_bswap64(hera::get<0>(r)) +
+                   __builtin_bswap32(hera::get<1>(r)) +
+                   __builtin_bswap16(hera::get<2>(r));
+        }
+        bench::do_not_optimize(sum);
+    });
+}
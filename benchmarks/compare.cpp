@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "bench.hpp"
+#include "hera/compare.hpp"
+#include "hera/container/tuple.hpp"
+
+namespace
+{
+// venue, side, order type, time in force, desk, trader, session, instrument,
+// quantity
+using fill = hera::tuple<std::uint8_t,
+                         std::uint8_t,
+                         std::uint8_t,
+                         std::uint8_t,
+                         std::uint16_t,
+                         std::uint16_t,
+                         std::uint32_t,
+                         std::uint32_t,
+                         std::uint32_t>;
+
+// country, class, fare basis
+using booking = hera::tuple<std::array<std::uint8_t, 2>,
+                            std::uint8_t,
+                            std::array<std::uint8_t, 8>>;
+
+// all positions, which compares element by element
+using all_fill_fields    = hera::index_sequence<0, 1, 2, 3, 4, 5, 6, 7, 8>;
+using all_booking_fields = hera::index_sequence<0, 1, 2>;
+} // namespace
+
+int main()
+{
+    constexpr std::size_t rows        = 1 << 20;
+    constexpr std::size_t repetitions = 5;
+
+    std::uint64_t state = 42;
+    const auto    next  = [&] {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return state >> 33;
+    };
+
+    // long runs of duplicates, told apart by the last field
+    std::vector<fill> fills;
+    fills.reserve(rows);
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        fills.push_back(fill{3,
+                             1,
+                             0,
+                             2,
+                             12,
+                             40,
+                             7,
+                             static_cast<std::uint32_t>(i / 8),
+                             static_cast<std::uint32_t>(next() % 2)});
+    }
+
+    std::vector<booking> bookings;
+    bookings.reserve(rows);
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        const auto letter = [&](std::uint64_t n) {
+            return static_cast<std::uint8_t>('A' + next() % n);
+        };
+
+        bookings.push_back(
+            booking{std::array<std::uint8_t, 2>{letter(4), letter(4)},
+                    letter(3),
+                    std::array<std::uint8_t, 8>{letter(26), letter(26)}});
+    }
+
+    std::size_t equal = 0;
+
+    bench::run("adjacent == hera::tuple", rows, repetitions, [&] {
+        equal = 0;
+        for (std::size_t i = 1; i != rows; ++i)
+        {
+            equal += fills[i - 1] == fills[i];
+        }
+        bench::do_not_optimize(equal);
+    });
+
+    bench::run("adjacent == by element", rows, repetitions, [&] {
+        equal = 0;
+        for (std::size_t i = 1; i != rows; ++i)
+        {
+            equal += hera::equal(fills[i - 1], fills[i], all_fill_fields{});
+        }
+        bench::do_not_optimize(equal);
+    });
+
+    // every run sorts a fresh copy, the copy is part of all timings
+    std::vector<booking> sorted;
+
+    bench::run("std::sort with < on hera::tuple", rows, repetitions, [&] {
+        sorted = bookings;
+        std::sort(sorted.begin(), sorted.end());
+        bench::do_not_optimize(sorted.data());
+    });
+
+    bench::run("std::sort with < by element", rows, repetitions, [&] {
+        sorted = bookings;
+        std::sort(sorted.begin(),
+                  sorted.end(),
+                  [](const booking& lhs, const booking& rhs) {
+                      return hera::less(lhs, rhs, all_booking_fields{});
+                  });
+        bench::do_not_optimize(sorted.data());
+    });
+}
@@ -0,0 +1,117 @@
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+#include "bench.hpp"
+#include "hera/csv.hpp"
+
+namespace
+{
+std::string make_csv(std::size_t rows)
+{
+    std::string text;
+    text.reserve(rows * 64);
+
+    for (std::size_t i = 0; i < rows; ++i)
+    {
+        text += std::to_string(i);
+        text += ',';
+        text += std::to_string(static_cast<double>(i % 10000) / 64);
+        text += ",symbol-";
+        text += std::to_string(i % 977);
+        text += ',';
+        text += std::to_string(i * 7919 % 1000003);
+        text += ",venue ";
+        text += static_cast<char>('A' + i % 26);
+        text += '\n';
+    }
+
+    return text;
+}
+
+// splits on commas and parses with the C library, like a quick hand-written
+// importer would
+template<typename F>
+void scalar_parse(std::string_view text, F&& fn)
+{
+    const char* p    = text.data();
+    const char* last = p + text.size();
+
+    while (p < last)
+    {
+        char* end;
+
+        const long   id    = std::strtol(p, &end, 10);
+        const double price = std::strtod(end + 1, &end);
+
+        const char* symbol = end + 1;
+        const char* comma  = symbol;
+        while (*comma != ',')
+        {
+            ++comma;
+        }
+        const std::string_view sym(symbol, comma - symbol);
+
+        const long qty = std::strtol(comma + 1, &end, 10);
+
+        while (end < last && *end != '\n')
+        {
+            ++end;
+        }
+
+        fn(id, price, sym, qty);
+        p = end + 1;
+    }
+}
+} // namespace
+
+int main()
+{
+    const auto text = make_csv(1 << 20);
+
+    constexpr std::size_t repetitions = 5;
+
+    bench::run_bytes("hera::csv_reader all columns",
+                     text.size(),
+                     repetitions,
+                     [&] {
+                         hera::csv_reader<hera::tuple<std::int64_t,
+                                                      double,
+                                                      std::string_view,
+                                                      std::int64_t,
+                                                      std::string_view>>
+                             reader{text};
+
+                         std::int64_t sum = 0;
+                         for (const auto& row : reader)
+                         {
+                             sum += hera::get<3>(row) +
+                                    hera::get<2>(row).size();
+                         }
+                         bench::do_not_optimize(sum);
+                     });
+
+    bench::run_bytes(
+        "hera::csv_reader projected", text.size(), repetitions, [&] {
+            hera::csv_reader<hera::tuple<std::int64_t, std::string_view>,
+                             hera::index_sequence<3, 2>>
+                reader{text};
+
+            std::int64_t sum = 0;
+            for (const auto& row : reader)
+            {
+                sum += hera::get<0>(row) + hera::get<1>(row).size();
+            }
+            bench::do_not_optimize(sum);
+        });
+
+    bench::run_bytes("strtol/strtod", text.size(), repetitions, [&] {
+        std::int64_t sum = 0;
+        scalar_parse(text,
+                     [&](long, double, std::string_view sym, long qty) {
+                         sum += qty + sym.size();
+                     });
+        bench::do_not_optimize(sum);
+    });
+}
@@ -0,0 +1,99 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/delta.hpp"
+#include "hera/serialize.hpp"
+
+namespace
+{
+using account = hera::tuple<std::uint64_t, // id
+                            std::uint32_t, // owner
+                            std::uint16_t, // branch
+                            std::uint16_t, // status
+                            std::int64_t,  // balance
+                            std::int64_t,  // reserved
+                            double,        // rate
+                            std::uint64_t, // last update
+                            std::string,   // name
+                            std::string>;  // address
+} // namespace
+
+int main()
+{
+    constexpr std::size_t records     = 1 << 16;
+    constexpr std::size_t repetitions = 10;
+
+    std::vector<account> states;
+    states.reserve(records);
+    for (std::size_t i = 0; i != records; ++i)
+    {
+        states.push_back(account{i,
+                                 static_cast<std::uint32_t>(i * 7),
+                                 static_cast<std::uint16_t>(i % 300),
+                                 std::uint16_t{1},
+                                 static_cast<std::int64_t>(i * 100),
+                                 std::int64_t{0},
+                                 0.0125,
+                                 std::uint64_t{0},
+                                 "account holder " + std::to_string(i),
+                                 "1 Long Street, Some Town, " +
+                                     std::to_string(i % 1000)});
+    }
+
+    // a new balance and update time for one in four, the rest unchanged
+    std::vector<account> updates = states;
+    for (std::size_t i = 0; i < records; i += 4)
+    {
+        hera::get<4>(updates[i]) += 250;
+        hera::get<7>(updates[i]) = 1;
+    }
+
+    std::vector<std::byte> wire(records * 256);
+    std::size_t            bytes = 0;
+
+    bench::run("whole record hera::serialize", records, repetitions, [&] {
+        bytes = 0;
+        for (std::size_t i = 0; i != records; ++i)
+        {
+            bytes += *hera::serialize(
+                updates[i], std::span{wire}.subspan(bytes));
+        }
+        bench::do_not_optimize(wire.data());
+    });
+    std::printf("  %zu bytes per record\n", bytes / records);
+
+    hera::delta<account> delta;
+
+    bench::run("hera::diff", records, repetitions, [&] {
+        bytes = 0;
+        for (std::size_t i = 0; i != records; ++i)
+        {
+            hera::diff(states[i], updates[i], delta);
+            if (!delta.unchanged())
+            {
+                bytes += *hera::serialize(
+                    delta, std::span{wire}.subspan(bytes));
+            }
+        }
+        bench::do_not_optimize(wire.data());
+    });
+    std::printf("  %zu bytes per record\n", bytes / records);
+
+    std::vector<account> replica = states;
+
+    bench::run("hera::apply_patch", records, repetitions, [&] {
+        std::span<const std::byte> in{wire.data(), bytes};
+
+        for (std::size_t i = 0; i < records; i += 4)
+        {
+            in = in.subspan(*hera::deserialize(in, delta));
+            hera::apply_patch(replica[i], delta);
+        }
+        bench::do_not_optimize(replica.data());
+    });
+}
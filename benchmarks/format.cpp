@@ -0,0 +1,105 @@
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+#include "bench.hpp"
+#include "hera/format.hpp"
+
+using namespace hera::literals;
+
+namespace
+{
+struct metric
+{
+    std::string name;
+    long        count;
+    double      millis;
+};
+} // namespace
+
+int main()
+{
+    std::vector<metric> metrics;
+    for (long i = 0; i < 1 << 16; ++i)
+    {
+        metrics.push_back(metric{"request.latency.p" + std::to_string(i % 100),
+                                 i * 7919,
+                                 static_cast<double>(i % 1000) / 7.0});
+    }
+
+    constexpr std::size_t repetitions = 20;
+
+    char buffer[256];
+
+    bench::run("hera::format_to", metrics.size(), repetitions, [&] {
+        std::size_t n = 0;
+        for (const auto& m : metrics)
+        {
+            n += hera::format_to<"{}: {} calls {:.3f} ms\n"_s>(
+                     buffer, m.name, m.count, m.millis) -
+                 buffer;
+        }
+        bench::do_not_optimize(n);
+    });
+
+    bench::run("snprintf", metrics.size(), repetitions, [&] {
+        std::size_t n = 0;
+        for (const auto& m : metrics)
+        {
+            n += std::snprintf(buffer,
+                               sizeof(buffer),
+                               "%s: %ld calls %.3f ms\n",
+                               m.name.c_str(),
+                               m.count,
+                               m.millis);
+        }
+        bench::do_not_optimize(n);
+    });
+
+#if defined(__cpp_lib_format)
+    bench::run("std::format_to", metrics.size(), repetitions, [&] {
+        std::size_t n = 0;
+        for (const auto& m : metrics)
+        {
+            n += std::format_to(buffer,
+                                "{}: {} calls {:.3f} ms\n",
+                                m.name,
+                                m.count,
+                                m.millis) -
+                 buffer;
+        }
+        bench::do_not_optimize(n);
+    });
+#endif
+
+    bench::run("hera::format", metrics.size(), repetitions, [&] {
+        std::size_t n = 0;
+        for (const auto& m : metrics)
+        {
+            n += hera::format<"{}: {} calls {:.3f} ms\n"_s>(
+                     m.name, m.count, m.millis)
+                     .size();
+        }
+        bench::do_not_optimize(n);
+    });
+
+#if defined(__cpp_lib_format)
+    bench::run("std::format", metrics.size(), repetitions, [&] {
+        std::size_t n = 0;
+        for (const auto& m : metrics)
+        {
+            n += std::format("{}: {} calls {:.3f} ms\n",
+                             m.name,
+                             m.count,
+                             m.millis)
+                     .size();
+        }
+        bench::do_not_optimize(n);
+    });
+#endif
+}
@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "bench.hpp"
+#include "hera/group_by.hpp"
+
+namespace
+{
+// customer, quantity, price
+using order = hera::tuple<std::uint32_t, std::int64_t, double>;
+
+struct totals
+{
+    std::int64_t quantity = 0;
+    double       min      = 1e300;
+    double       max      = -1e300;
+    std::size_t  count    = 0;
+};
+} // namespace
+
+int main()
+{
+    constexpr std::size_t rows        = 1 << 22;
+    constexpr std::size_t customers   = 100000;
+    constexpr std::size_t repetitions = 10;
+
+    std::vector<order> orders;
+    orders.reserve(rows);
+
+    std::uint64_t state = 42;
+    const auto    next  = [&] {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return state >> 33;
+    };
+
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        orders.push_back(order{static_cast<std::uint32_t>(next() % customers),
+                               static_cast<std::int64_t>(next() % 50 + 1),
+                               static_cast<double>(next() % 100000) / 10});
+    }
+
+    const auto reducers =
+        hera::tuple{hera::sum<1>, hera::min<2>, hera::max<2>, hera::count};
+
+    bench::run("hera::group_by", rows, repetitions, [&] {
+        const auto res = hera::group_by<0>(orders, reducers);
+        bench::do_not_optimize(res.size());
+    });
+
+    const std::size_t threads =
+        std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+    bench::run("hera::group_by all threads", rows, repetitions, [&] {
+        const auto res = hera::group_by<0>(orders, reducers, threads);
+        bench::do_not_optimize(res.size());
+    });
+
+    bench::run("std::unordered_map one pass", rows, repetitions, [&] {
+        std::unordered_map<std::uint32_t, totals> groups;
+        for (const auto& o : orders)
+        {
+            auto& group = groups[hera::get<0>(o)];
+            group.quantity += hera::get<1>(o);
+            group.min = std::min(group.min, hera::get<2>(o));
+            group.max = std::max(group.max, hera::get<2>(o));
+            ++group.count;
+        }
+        bench::do_not_optimize(groups.size());
+    });
+
+    bench::run("std::unordered_map pass per aggregate", rows, repetitions, [&] {
+        std::unordered_map<std::uint32_t, std::int64_t> quantity;
+        std::unordered_map<std::uint32_t, double>       min;
+        std::unordered_map<std::uint32_t, double>       max;
+        std::unordered_map<std::uint32_t, std::size_t>  count;
+
+        for (const auto& o : orders)
+        {
+            quantity[hera::get<0>(o)] += hera::get<1>(o);
+        }
+        for (const auto& o : orders)
+        {
+            auto [it, inserted] = min.try_emplace(hera::get<0>(o), 1e300);
+            it->second          = std::min(it->second, hera::get<2>(o));
+        }
+        for (const auto& o : orders)
+        {
+            auto [it, inserted] = max.try_emplace(hera::get<0>(o), -1e300);
+            it->second          = std::max(it->second, hera::get<2>(o));
+        }
+        for (const auto& o : orders)
+        {
+            ++count[hera::get<0>(o)];
+        }
+        bench::do_not_optimize(count.size());
+    });
+}
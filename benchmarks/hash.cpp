@@ -0,0 +1,92 @@
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "bench.hpp"
+#include "hera/container/soa_vector.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/hash.hpp"
+
+namespace
+{
+struct quote
+{
+    std::uint64_t instrument;
+    std::int32_t  venue;
+    double        price;
+    std::uint32_t size;
+};
+
+// the usual hand-rolled combiner over std::hash
+std::size_t combine(std::size_t seed, std::size_t hash)
+{
+    return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+} // namespace
+
+int main()
+{
+    constexpr std::size_t rows        = 1 << 20;
+    constexpr std::size_t repetitions = 10;
+
+    std::vector<quote>                                   quotes;
+    std::vector<hera::tuple<std::uint64_t, std::uint64_t>> keys;
+    quotes.reserve(rows);
+    keys.reserve(rows);
+
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        quotes.push_back({i * 31,
+                          static_cast<std::int32_t>(i % 17),
+                          static_cast<double>(i % 1000) / 8,
+                          static_cast<std::uint32_t>(i % 300)});
+        keys.push_back(hera::tuple<std::uint64_t, std::uint64_t>{i, i * 7});
+    }
+
+    const auto columns = hera::to_soa(quotes);
+
+    std::vector<std::uint64_t> hashes(rows);
+
+    bench::run("hera::hash_many over columns", rows, repetitions, [&] {
+        hera::hash_many(columns, hashes);
+        bench::do_not_optimize(hashes.data());
+    });
+
+    bench::run("hera::hash per row", rows, repetitions, [&] {
+        for (std::size_t i = 0; i != rows; ++i)
+        {
+            hashes[i] = hera::hash(columns[i]);
+        }
+        bench::do_not_optimize(hashes.data());
+    });
+
+    bench::run("std::hash combined per row", rows, repetitions, [&] {
+        for (std::size_t i = 0; i != rows; ++i)
+        {
+            const auto& q   = quotes[i];
+            std::size_t res = std::hash<std::uint64_t>{}(q.instrument);
+            res = combine(res, std::hash<std::int32_t>{}(q.venue));
+            res = combine(res, std::hash<double>{}(q.price));
+            res = combine(res, std::hash<std::uint32_t>{}(q.size));
+            hashes[i] = res;
+        }
+        bench::do_not_optimize(hashes.data());
+    });
+
+    bench::run("hera::hash packed tuples", rows, repetitions, [&] {
+        for (std::size_t i = 0; i != rows; ++i)
+        {
+            hashes[i] = hera::hash(keys[i]);
+        }
+        bench::do_not_optimize(hashes.data());
+    });
+
+    bench::run("std::hash combined tuples", rows, repetitions, [&] {
+        for (std::size_t i = 0; i != rows; ++i)
+        {
+            hashes[i] = combine(std::hash<std::uint64_t>{}(hera::get<0>(keys[i])),
+                                std::hash<std::uint64_t>{}(hera::get<1>(keys[i])));
+        }
+        bench::do_not_optimize(hashes.data());
+    });
+}
@@ -0,0 +1,87 @@
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "bench.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/hash_join.hpp"
+
+namespace
+{
+// id, segment, balance
+using customer = hera::tuple<std::uint64_t, std::uint32_t, double>;
+// order id, customer id, amount
+using order = hera::tuple<std::uint64_t, std::uint64_t, double>;
+} // namespace
+
+int main()
+{
+    constexpr std::size_t customers   = 1 << 20;
+    constexpr std::size_t orders      = 1 << 22;
+    constexpr std::size_t repetitions = 5;
+
+    std::uint64_t state = 42;
+    const auto    next  = [&] {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return state >> 33;
+    };
+
+    std::vector<customer> left;
+    left.reserve(customers);
+    for (std::size_t i = 0; i != customers; ++i)
+    {
+        // every other id has a customer
+        left.push_back(customer{i * 2,
+                                static_cast<std::uint32_t>(next() % 5),
+                                static_cast<double>(next() % 10000)});
+    }
+
+    std::vector<order> right;
+    right.reserve(orders);
+    for (std::size_t i = 0; i != orders; ++i)
+    {
+        right.push_back(
+            order{i, next() % (customers * 2), static_cast<double>(i % 100)});
+    }
+
+    bench::run("hera::hash_join", orders, repetitions, [&] {
+        const auto joined =
+            hera::hash_join<hera::index_sequence<0>, hera::index_sequence<1>>(
+                left, right);
+
+        double total = 0;
+        for (const auto row : joined)
+        {
+            total += hera::get<2>(row) * hera::get<5>(row);
+        }
+        bench::do_not_optimize(total);
+    });
+
+    bench::run("std::unordered_multimap", orders, repetitions, [&] {
+        std::unordered_multimap<std::uint64_t, std::size_t> table;
+        table.reserve(customers);
+        for (std::size_t i = 0; i != left.size(); ++i)
+        {
+            table.emplace(hera::get<0>(left[i]), i);
+        }
+
+        std::vector<std::pair<std::size_t, std::size_t>> joined;
+        for (std::size_t i = 0; i != right.size(); ++i)
+        {
+            auto [first, last] = table.equal_range(hera::get<1>(right[i]));
+            for (; first != last; ++first)
+            {
+                joined.emplace_back(first->second, i);
+            }
+        }
+
+        double total = 0;
+        for (const auto& [l, r] : joined)
+        {
+            total += hera::get<2>(left[l]) * hera::get<2>(right[r]);
+        }
+        bench::do_not_optimize(total);
+    });
+}
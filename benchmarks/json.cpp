@@ -0,0 +1,91 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "hera/json.hpp"
+
+using namespace hera::literals;
+
+namespace
+{
+using order = hera::record<hera::field<"id"_s, std::uint64_t>,
+                           hera::field<"symbol"_s, std::string>,
+                           hera::field<"price"_s, double>,
+                           hera::field<"quantity"_s, std::int64_t>,
+                           hera::field<"open"_s, bool>>;
+
+// what a hand-written emitter usually looks like
+void write_by_hand(std::string& out, const order& o)
+{
+    out += "{\"id\":";
+    out += std::to_string(o["id"_s]);
+    out += ",\"symbol\":\"";
+    out += o["symbol"_s];
+    out += "\",\"price\":";
+    out += std::to_string(o["price"_s]);
+    out += ",\"quantity\":";
+    out += std::to_string(o["quantity"_s]);
+    out += ",\"open\":";
+    out += o["open"_s] ? "true" : "false";
+    out += '}';
+}
+} // namespace
+
+int main()
+{
+    std::vector<order> orders;
+    for (std::uint64_t i = 0; i != 1 << 16; ++i)
+    {
+        orders.push_back(order{i,
+                               "SYM" + std::to_string(i % 977),
+                               static_cast<double>(i % 10000) / 64,
+                               static_cast<std::int64_t>(i * 7919 % 1000003),
+                               i % 3 == 0});
+    }
+
+    std::string text;
+    for (const auto& o : orders)
+    {
+        hera::write_json(text, o);
+        text += '\n';
+    }
+
+    constexpr std::size_t repetitions = 20;
+
+    bench::run_bytes("hera::write_json", text.size(), repetitions, [&] {
+        std::string out;
+        out.reserve(text.size());
+        for (const auto& o : orders)
+        {
+            hera::write_json(out, o);
+            out += '\n';
+        }
+        bench::do_not_optimize(out.data());
+    });
+
+    bench::run_bytes("hand-written writer", text.size(), repetitions, [&] {
+        std::string out;
+        out.reserve(text.size());
+        for (const auto& o : orders)
+        {
+            write_by_hand(out, o);
+            out += '\n';
+        }
+        bench::do_not_optimize(out.data());
+    });
+
+    bench::run_bytes("hera::read_json", text.size(), repetitions, [&] {
+        order        o{};
+        std::size_t  pos = 0;
+        std::int64_t sum = 0;
+        while (pos < text.size())
+        {
+            const auto end = text.find('\n', pos);
+            hera::read_json(std::string_view{text}.substr(pos, end - pos), o);
+            sum += o["quantity"_s];
+            pos = end + 1;
+        }
+        bench::do_not_optimize(sum);
+    });
+}
@@ -0,0 +1,60 @@
+#include <cstdio>
+#include <string_view>
+
+#include "bench.hpp"
+#include "hera/format.hpp"
+#include "hera/log.hpp"
+
+using namespace hera::literals;
+
+// cost of a log statement on the calling thread
+int main()
+{
+    std::FILE* sink = std::tmpfile();
+
+    constexpr std::size_t messages    = 1 << 14;
+    constexpr std::size_t repetitions = 20;
+
+    const std::string_view path = "/api/users";
+
+    {
+        hera::log_backend backend{sink};
+
+        bench::run("hera::log", messages, repetitions, [&] {
+            for (std::size_t i = 0; i < messages; ++i)
+            {
+                hera::log<"request {} took {:.3f} ms, status {}"_s>(
+                    path, static_cast<double>(i) * 0.001, 200);
+            }
+        });
+
+        backend.flush();
+    }
+
+    char buffer[256];
+
+    bench::run("hera::format_to", messages, repetitions, [&] {
+        for (std::size_t i = 0; i < messages; ++i)
+        {
+            bench::do_not_optimize(
+                hera::format_to<"request {} took {:.3f} ms, status {}"_s>(
+                    buffer, path, static_cast<double>(i) * 0.001, 200));
+        }
+    });
+
+    bench::run("snprintf", messages, repetitions, [&] {
+        for (std::size_t i = 0; i < messages; ++i)
+        {
+            bench::do_not_optimize(
+                std::snprintf(buffer,
+                              sizeof(buffer),
+                              "request %.*s took %.3f ms, status %d",
+                              static_cast<int>(path.size()),
+                              path.data(),
+                              static_cast<double>(i) * 0.001,
+                              200));
+        }
+    });
+
+    std::fclose(sink);
+}
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "bench.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/radix_sort.hpp"
+
+namespace
+{
+// account, amount, currency, memo
+using transfer = hera::
+    tuple<std::int32_t, double, std::array<char, 3>, std::array<char, 64>>;
+} // namespace
+
+int main()
+{
+    constexpr std::size_t rows        = 1 << 20;
+    constexpr std::size_t repetitions = 5;
+
+    std::vector<transfer> transfers;
+    transfers.reserve(rows);
+
+    std::uint64_t state = 42;
+    const auto    next  = [&] {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return state >> 33;
+    };
+
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        transfers.push_back(
+            transfer{static_cast<std::int32_t>(next() % 200000) - 100000,
+                     (static_cast<double>(next() % 2000000) - 1000000) / 100,
+                     std::array<char, 3>{static_cast<char>('A' + next() % 4),
+                                         'U',
+                                         'R'},
+                     std::array<char, 64>{}});
+    }
+
+    // every run sorts a fresh copy, the copy is part of all timings
+    std::vector<transfer> sorted;
+
+    bench::run("copy only", rows, repetitions, [&] {
+        sorted = transfers;
+        bench::do_not_optimize(sorted.data());
+    });
+
+    bench::run("int32 hera::radix_sort", rows, repetitions, [&] {
+        sorted = transfers;
+        hera::radix_sort<0>(sorted);
+        bench::do_not_optimize(sorted.data());
+    });
+
+    bench::run("int32 std::sort", rows, repetitions, [&] {
+        sorted = transfers;
+        std::sort(sorted.begin(),
+                  sorted.end(),
+                  [](const transfer& lhs, const transfer& rhs) {
+                      return hera::get<0>(lhs) < hera::get<0>(rhs);
+                  });
+        bench::do_not_optimize(sorted.data());
+    });
+
+    bench::run("currency, amount hera::radix_sort", rows, repetitions, [&] {
+        sorted = transfers;
+        hera::radix_sort<2, 1>(sorted);
+        bench::do_not_optimize(sorted.data());
+    });
+
+    bench::run("currency, amount std::sort", rows, repetitions, [&] {
+        sorted = transfers;
+        std::sort(sorted.begin(),
+                  sorted.end(),
+                  [](const transfer& lhs, const transfer& rhs) {
+                      const int currency = std::memcmp(
+                          hera::get<2>(lhs).data(), hera::get<2>(rhs).data(), 3);
+                      return currency < 0 ||
+                             (currency == 0 &&
+                              hera::get<1>(lhs) < hera::get<1>(rhs));
+                  });
+        bench::do_not_optimize(sorted.data());
+    });
+}
@@ -0,0 +1,108 @@
+#include <random>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bench.hpp"
+#include "hera/regex.hpp"
+
+using namespace hera::literals;
+
+namespace
+{
+constexpr std::string_view lines[]{
+    "2024-01-01T00:00:00Z INFO request served path=/index.html ms=3",
+    "2024-01-01T00:00:01Z WARN slow request path=/api/users ms=812",
+    "2024-01-01T00:00:02Z ERROR connection reset code=104",
+    "2024-01-01T00:00:03Z DEBUG pool size=16 idle=11"};
+
+using line_regex = hera::regex<
+    "\\d{4}-\\d\\d-\\d\\dT[0-9:]+Z (INFO|WARN|ERROR|DEBUG) (.*)"_s>;
+
+using ms_regex = hera::regex<"ms=(\\d+)"_s>;
+} // namespace
+
+int main()
+{
+    std::mt19937             rng{42};
+    std::vector<std::string> log;
+    for (std::size_t i = 0; i < 1 << 14; ++i)
+    {
+        log.emplace_back(lines[rng() % std::size(lines)]);
+    }
+
+    constexpr std::size_t repetitions = 10;
+
+    const std::regex std_line{
+        "\\d{4}-\\d\\d-\\d\\dT[0-9:]+Z (INFO|WARN|ERROR|DEBUG) (.*)"};
+    const std::regex std_ms{"ms=(\\d+)"};
+
+    bench::run("hera::regex match", log.size(), repetitions, [&] {
+        std::size_t n = 0;
+        for (const auto& line : log)
+        {
+            n += line_regex::match(line);
+        }
+        bench::do_not_optimize(n);
+    });
+
+    bench::run("std::regex_match", log.size(), repetitions, [&] {
+        std::size_t n = 0;
+        for (const auto& line : log)
+        {
+            n += std::regex_match(line, std_line);
+        }
+        bench::do_not_optimize(n);
+    });
+
+    bench::run("hera::regex match_captures", log.size(), repetitions, [&] {
+        std::size_t n = 0;
+        for (const auto& line : log)
+        {
+            if (const auto captures = line_regex::match_captures(line))
+            {
+                n += hera::get<1>(*captures).size();
+            }
+        }
+        bench::do_not_optimize(n);
+    });
+
+    bench::run("std::regex_match with captures", log.size(), repetitions, [&] {
+        std::size_t n = 0;
+        std::smatch m;
+        for (const auto& line : log)
+        {
+            if (std::regex_match(line, m, std_line))
+            {
+                n += m[1].length();
+            }
+        }
+        bench::do_not_optimize(n);
+    });
+
+    bench::run("hera::regex search_captures", log.size(), repetitions, [&] {
+        std::size_t n = 0;
+        for (const auto& line : log)
+        {
+            if (const auto captures = ms_regex::search_captures(line))
+            {
+                n += hera::get<1>(*captures).size();
+            }
+        }
+        bench::do_not_optimize(n);
+    });
+
+    bench::run("std::regex_search", log.size(), repetitions, [&] {
+        std::size_t n = 0;
+        std::smatch m;
+        for (const auto& line : log)
+        {
+            if (std::regex_search(line, m, std_ms))
+            {
+                n += m[1].length();
+            }
+        }
+        bench::do_not_optimize(n);
+    });
+}
@@ -0,0 +1,105 @@
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "bench.hpp"
+#include "hera/algorithm/search.hpp"
+
+using namespace hera::literals;
+
+namespace
+{
+constexpr std::string_view lines[]{
+    "2024-01-01T00:00:00Z INFO  request served path=/index.html ms=3\n",
+    "2024-01-01T00:00:01Z WARN  slow request path=/api/users ms=812\n",
+    "2024-01-01T00:00:02Z INFO  cache hit key=session:1a2b3c4d ttl=300\n",
+    "2024-01-01T00:00:03Z DEBUG connection pool size=16 idle=11\n"};
+
+// counts all occurrences to scan the whole input
+template<typename Find>
+std::size_t count(std::string_view haystack, std::size_t length, Find find)
+{
+    std::size_t n = 0;
+
+    for (auto pos = find(haystack); pos != std::string_view::npos;
+         pos      = find(haystack))
+    {
+        ++n;
+        haystack.remove_prefix(pos + length);
+    }
+
+    return n;
+}
+} // namespace
+
+int main()
+{
+    // a log of 16 MiB with a rare error line
+    std::mt19937 rng{42};
+    std::string  log;
+    while (log.size() < (1 << 24))
+    {
+        log += (rng() % 10000 == 0)
+                   ? "2024-01-01T00:00:04Z ERROR connection reset by peer\n"
+                   : lines[rng() % std::size(lines)];
+    }
+
+    constexpr std::size_t repetitions = 10;
+
+    bench::run_bytes("hera::search \"ERROR\"", log.size(), repetitions, [&] {
+        bench::do_not_optimize(count(log, 5, [](std::string_view h) {
+            return hera::search(h, "ERROR"_s);
+        }));
+    });
+
+    bench::run_bytes(
+        "std::string_view::find \"ERROR\"", log.size(), repetitions, [&] {
+            bench::do_not_optimize(count(log, 5, [](std::string_view h) {
+                return h.find("ERROR");
+            }));
+        });
+
+    bench::run_bytes(
+        "hera::search long needle", log.size(), repetitions, [&] {
+            bench::do_not_optimize(count(log, 44, [](std::string_view h) {
+                return hera::search(
+                    h, "ERROR connection reset by peer while reading"_s);
+            }));
+        });
+
+    bench::run_bytes(
+        "std::string_view::find long needle", log.size(), repetitions, [&] {
+            bench::do_not_optimize(count(log, 44, [](std::string_view h) {
+                return h.find("ERROR connection reset by peer while reading");
+            }));
+        });
+
+    const auto needles = hera::tuple{"ERROR"_s, "FATAL"_s, "panic"_s};
+
+    bench::run_bytes("hera::search_any", log.size(), repetitions, [&] {
+        std::string_view haystack = log;
+        std::size_t      n        = 0;
+
+        for (auto result = hera::search_any(haystack, needles); result;
+             result      = hera::search_any(haystack, needles))
+        {
+            ++n;
+            haystack.remove_prefix(result.position + 1);
+        }
+
+        bench::do_not_optimize(n);
+    });
+
+    bench::run_bytes("std::string_view::find x3", log.size(), repetitions, [&] {
+        std::size_t n = 0;
+
+        for (std::string_view needle : {"ERROR", "FATAL", "panic"})
+        {
+            n += count(log, needle.size(), [needle](std::string_view h) {
+                return h.find(needle);
+            });
+        }
+
+        bench::do_not_optimize(n);
+    });
+}
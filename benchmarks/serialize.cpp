@@ -0,0 +1,246 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bench.hpp"
+#include "hera/serialize.hpp"
+
+namespace
+{
+// stored back to back, a single memcpy
+using tick = hera::tuple<std::uint64_t, // timestamp
+                         std::uint32_t, // instrument
+                         std::uint32_t, // quantity
+                         double,        // price
+                         std::int64_t>; // flags
+
+// padding between the first two fields
+using order = hera::tuple<std::uint8_t,  // side
+                          std::uint64_t, // id
+                          std::uint32_t, // quantity
+                          std::uint16_t, // venue
+                          double>;       // price
+
+using message = hera::tuple<std::uint32_t, std::string_view, double>;
+
+std::byte* write_tick(const tick& t, std::byte* out) noexcept
+{
+    std::memcpy(out, &hera::get<0>(t), 8);
+    std::memcpy(out + 8, &hera::get<1>(t), 4);
+    std::memcpy(out + 12, &hera::get<2>(t), 4);
+    std::memcpy(out + 16, &hera::get<3>(t), 8);
+    std::memcpy(out + 24, &hera::get<4>(t), 8);
+    return out + 32;
+}
+
+const std::byte* read_tick(tick& t, const std::byte* in) noexcept
+{
+    std::memcpy(&hera::get<0>(t), in, 8);
+    std::memcpy(&hera::get<1>(t), in + 8, 4);
+    std::memcpy(&hera::get<2>(t), in + 12, 4);
+    std::memcpy(&hera::get<3>(t), in + 16, 8);
+    std::memcpy(&hera::get<4>(t), in + 24, 8);
+    return in + 32;
+}
+
+std::byte* write_order(const order& o, std::byte* out) noexcept
+{
+    std::memcpy(out, &hera::get<0>(o), 1);
+    std::memcpy(out + 1, &hera::get<1>(o), 8);
+    std::memcpy(out + 9, &hera::get<2>(o), 4);
+    std::memcpy(out + 13, &hera::get<3>(o), 2);
+    std::memcpy(out + 15, &hera::get<4>(o), 8);
+    return out + 23;
+}
+
+std::byte* write_message(const message& m, std::byte* out) noexcept
+{
+    const auto& text   = hera::get<1>(m);
+    const auto  length = static_cast<std::uint32_t>(text.size());
+
+    std::memcpy(out, &hera::get<0>(m), 4);
+    std::memcpy(out + 4, &length, 4);
+    std::memcpy(out + 8, text.data(), text.size());
+    out += 8 + text.size();
+    std::memcpy(out, &hera::get<2>(m), 8);
+    return out + 8;
+}
+
+const std::byte*
+read_message(message& m, const std::byte* in, const std::byte* last) noexcept
+{
+    std::uint32_t length;
+
+    if (last - in < 8)
+    {
+        return nullptr;
+    }
+    std::memcpy(&hera::get<0>(m), in, 4);
+    std::memcpy(&length, in + 4, 4);
+    in += 8;
+
+    if (static_cast<std::size_t>(last - in) < std::size_t{length} + 8)
+    {
+        return nullptr;
+    }
+    hera::get<1>(m) = std::string_view(reinterpret_cast<const char*>(in), length);
+    in += length;
+    std::memcpy(&hera::get<2>(m), in, 8);
+    return in + 8;
+}
+} // namespace
+
+int main()
+{
+    constexpr std::size_t count       = 1 << 16;
+    constexpr std::size_t repetitions = 50;
+
+    std::vector<tick>        ticks;
+    std::vector<order>       orders;
+    std::vector<std::string> texts;
+    std::vector<message>     messages;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        ticks.push_back(tick{i * 1000,
+                             static_cast<std::uint32_t>(i % 512),
+                             static_cast<std::uint32_t>(i % 100),
+                             100.0 + i % 37,
+                             static_cast<std::int64_t>(i & 3)});
+
+        orders.push_back(order{static_cast<std::uint8_t>(i & 1),
+                               std::uint64_t{i},
+                               static_cast<std::uint32_t>(i % 100),
+                               static_cast<std::uint16_t>(i % 7),
+                               99.5 + i % 13});
+
+        texts.push_back("symbol-" + std::to_string(i % 977));
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        messages.push_back(message{static_cast<std::uint32_t>(i),
+                                   std::string_view{texts[i]},
+                                   static_cast<double>(i) / 3});
+    }
+
+    std::vector<std::byte> buffer(count * 64);
+
+    constexpr auto tick_bytes = count * hera::serialized_size_v<tick>;
+
+    bench::run_bytes("hera::serialize tick", tick_bytes, repetitions, [&] {
+        std::span<std::byte> out{buffer};
+        for (const auto& t : ticks)
+        {
+            out = out.subspan(*hera::serialize(t, out));
+        }
+        bench::do_not_optimize(out);
+    });
+
+    bench::run_bytes("memcpy tick", tick_bytes, repetitions, [&] {
+        auto* out = buffer.data();
+        for (const auto& t : ticks)
+        {
+            out = write_tick(t, out);
+        }
+        bench::do_not_optimize(out);
+    });
+
+    bench::run_bytes("hera::deserialize tick", tick_bytes, repetitions, [&] {
+        std::span<const std::byte> in{buffer.data(), tick_bytes};
+        tick                       t;
+        std::uint64_t              sum = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            in = in.subspan(*hera::deserialize(in, t));
+            sum += hera::get<2>(t);
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    bench::run_bytes("memcpy read tick", tick_bytes, repetitions, [&] {
+        const auto*   in = buffer.data();
+        tick          t;
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            in = read_tick(t, in);
+            sum += hera::get<2>(t);
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    constexpr auto order_bytes = count * hera::serialized_size_v<order>;
+
+    bench::run_bytes("hera::serialize order", order_bytes, repetitions, [&] {
+        std::span<std::byte> out{buffer};
+        for (const auto& o : orders)
+        {
+            out = out.subspan(*hera::serialize(o, out));
+        }
+        bench::do_not_optimize(out);
+    });
+
+    bench::run_bytes("memcpy order", order_bytes, repetitions, [&] {
+        auto* out = buffer.data();
+        for (const auto& o : orders)
+        {
+            out = write_order(o, out);
+        }
+        bench::do_not_optimize(out);
+    });
+
+    std::size_t message_bytes = 0;
+    for (const auto& m : messages)
+    {
+        message_bytes += hera::serialized_size(m);
+    }
+
+    bench::run_bytes(
+        "hera::serialize message", message_bytes, repetitions, [&] {
+            std::span<std::byte> out{buffer};
+            for (const auto& m : messages)
+            {
+                out = out.subspan(*hera::serialize(m, out));
+            }
+            bench::do_not_optimize(out);
+        });
+
+    bench::run_bytes("memcpy message", message_bytes, repetitions, [&] {
+        auto* out = buffer.data();
+        for (const auto& m : messages)
+        {
+            out = write_message(m, out);
+        }
+        bench::do_not_optimize(out);
+    });
+
+    bench::run_bytes(
+        "hera::deserialize message", message_bytes, repetitions, [&] {
+            std::span<const std::byte> in{buffer.data(), message_bytes};
+            message                    m;
+            std::size_t                sum = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                in = in.subspan(*hera::deserialize(in, m));
+                sum += hera::get<1>(m).size();
+            }
+            bench::do_not_optimize(sum);
+        });
+
+    bench::run_bytes("memcpy read message", message_bytes, repetitions, [&] {
+        const auto* in   = buffer.data();
+        const auto* last = in + message_bytes;
+        message     m;
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            in = read_message(m, in, last);
+            sum += hera::get<1>(m).size();
+        }
+        bench::do_not_optimize(sum);
+    });
+}
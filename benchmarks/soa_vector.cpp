@@ -0,0 +1,89 @@
+#include <cstdint>
+#include <vector>
+
+#include "bench.hpp"
+#include "hera/container/soa_vector.hpp"
+
+namespace
+{
+// a typical wide row, scans only look at one or two members
+struct order
+{
+    std::uint64_t id;
+    std::uint64_t account;
+    std::uint64_t timestamp;
+    double        price;
+    double        limit;
+    double        fee;
+    std::int64_t  quantity;
+    std::int64_t  filled;
+    std::uint32_t venue;
+    std::uint32_t flags;
+    std::uint16_t side;
+    std::uint16_t kind;
+};
+} // namespace
+
+int main()
+{
+    constexpr std::size_t rows        = 1 << 22;
+    constexpr std::size_t repetitions = 20;
+
+    std::vector<order> aos;
+    aos.reserve(rows);
+    for (std::uint64_t i = 0; i != rows; ++i)
+    {
+        aos.push_back(order{i,
+                            i % 1009,
+                            i * 3,
+                            static_cast<double>(i * 7919 % 10007) / 100,
+                            0,
+                            0,
+                            static_cast<std::int64_t>(i % 500),
+                            0,
+                            static_cast<std::uint32_t>(i % 7),
+                            0,
+                            static_cast<std::uint16_t>(i & 1),
+                            0});
+    }
+
+    const auto soa = hera::to_soa(aos);
+
+    bench::run("AoS filter price", rows, repetitions, [&] {
+        std::size_t count = 0;
+        for (const auto& o : aos)
+        {
+            count += o.price > 50.0;
+        }
+        bench::do_not_optimize(count);
+    });
+
+    bench::run("SoA filter price", rows, repetitions, [&] {
+        std::size_t count = 0;
+        for (const double price : soa.column<3>())
+        {
+            count += price > 50.0;
+        }
+        bench::do_not_optimize(count);
+    });
+
+    bench::run("AoS sum quantity where venue", rows, repetitions, [&] {
+        std::int64_t sum = 0;
+        for (const auto& o : aos)
+        {
+            sum += o.venue == 3 ? o.quantity : 0;
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    bench::run("SoA sum quantity where venue", rows, repetitions, [&] {
+        const auto   venues     = soa.column<8>();
+        const auto   quantities = soa.column<6>();
+        std::int64_t sum        = 0;
+        for (std::size_t i = 0; i != venues.size(); ++i)
+        {
+            sum += venues[i] == 3 ? quantities[i] : 0;
+        }
+        bench::do_not_optimize(sum);
+    });
+}
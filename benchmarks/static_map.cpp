@@ -0,0 +1,144 @@
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "bench.hpp"
+#include "hera/container/static_map.hpp"
+
+using namespace hera::literals;
+
+namespace
+{
+constexpr std::string_view header_names[]{"accept",
+                                          "accept-encoding",
+                                          "authorization",
+                                          "cache-control",
+                                          "connection",
+                                          "content-length",
+                                          "content-type",
+                                          "cookie",
+                                          "host",
+                                          "if-none-match",
+                                          "origin",
+                                          "referer",
+                                          "user-agent",
+                                          "x-forwarded-for",
+                                          "x-request-id",
+                                          "x-unknown-header"};
+
+int if_chain(std::string_view key)
+{
+    if (key == "accept")
+        return 0;
+    if (key == "accept-encoding")
+        return 1;
+    if (key == "authorization")
+        return 2;
+    if (key == "cache-control")
+        return 3;
+    if (key == "connection")
+        return 4;
+    if (key == "content-length")
+        return 5;
+    if (key == "content-type")
+        return 6;
+    if (key == "cookie")
+        return 7;
+    if (key == "host")
+        return 8;
+    if (key == "if-none-match")
+        return 9;
+    if (key == "origin")
+        return 10;
+    if (key == "referer")
+        return 11;
+    if (key == "user-agent")
+        return 12;
+    if (key == "x-forwarded-for")
+        return 13;
+    if (key == "x-request-id")
+        return 14;
+    return -1;
+}
+} // namespace
+
+int main()
+{
+    const auto map = hera::static_map{hera::pair{"accept"_s, 0},
+                                      hera::pair{"accept-encoding"_s, 1},
+                                      hera::pair{"authorization"_s, 2},
+                                      hera::pair{"cache-control"_s, 3},
+                                      hera::pair{"connection"_s, 4},
+                                      hera::pair{"content-length"_s, 5},
+                                      hera::pair{"content-type"_s, 6},
+                                      hera::pair{"cookie"_s, 7},
+                                      hera::pair{"host"_s, 8},
+                                      hera::pair{"if-none-match"_s, 9},
+                                      hera::pair{"origin"_s, 10},
+                                      hera::pair{"referer"_s, 11},
+                                      hera::pair{"user-agent"_s, 12},
+                                      hera::pair{"x-forwarded-for"_s, 13},
+                                      hera::pair{"x-request-id"_s, 14}};
+
+    const std::unordered_map<std::string_view, int> unordered{
+        {"accept", 0},
+        {"accept-encoding", 1},
+        {"authorization", 2},
+        {"cache-control", 3},
+        {"connection", 4},
+        {"content-length", 5},
+        {"content-type", 6},
+        {"cookie", 7},
+        {"host", 8},
+        {"if-none-match", 9},
+        {"origin", 10},
+        {"referer", 11},
+        {"user-agent", 12},
+        {"x-forwarded-for", 13},
+        {"x-request-id", 14}};
+
+    // copy the queries into separate storage so no lookup can compare
+    // pointers only
+    std::mt19937             rng{42};
+    std::vector<std::string> storage;
+    for (std::size_t i = 0; i < 1 << 16; ++i)
+    {
+        storage.emplace_back(header_names[rng() % std::size(header_names)]);
+    }
+
+    const std::vector<std::string_view> queries(storage.begin(),
+                                                storage.end());
+
+    constexpr std::size_t repetitions = 50;
+
+    bench::run("hera::static_map", queries.size(), repetitions, [&] {
+        int sum = 0;
+        for (auto query : queries)
+        {
+            const auto* value = map.find(query);
+            sum += value != nullptr ? *value : -1;
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    bench::run("std::unordered_map", queries.size(), repetitions, [&] {
+        int sum = 0;
+        for (auto query : queries)
+        {
+            const auto it = unordered.find(query);
+            sum += it != unordered.end() ? it->second : -1;
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    bench::run("if chain", queries.size(), repetitions, [&] {
+        int sum = 0;
+        for (auto query : queries)
+        {
+            sum += if_chain(query);
+        }
+        bench::do_not_optimize(sum);
+    });
+}
@@ -0,0 +1,149 @@
+#include <cstdint>
+#include <vector>
+
+#include "bench.hpp"
+#include "hera/table.hpp"
+
+namespace
+{
+// the columns of the TPC-H lineitem table the queries below look at, dates
+// are days since 1992-01-01
+struct lineitem
+{
+    double        quantity;
+    double        extendedprice;
+    double        discount;
+    double        tax;
+    std::uint8_t  returnflag;
+    std::uint8_t  linestatus;
+    std::int32_t  shipdate;
+    std::uint64_t orderkey;
+};
+
+using lineitem_table = hera::table<double,
+                                   double,
+                                   double,
+                                   double,
+                                   std::uint8_t,
+                                   std::uint8_t,
+                                   std::int32_t,
+                                   std::uint64_t>;
+
+// 1994-01-01 and 1995-01-01
+constexpr std::int32_t q6_from = 731;
+constexpr std::int32_t q6_to   = 1096;
+// 1998-09-02
+constexpr std::int32_t q1_until = 2436;
+} // namespace
+
+int main()
+{
+    constexpr std::size_t rows        = 1 << 22;
+    constexpr std::size_t repetitions = 10;
+
+    std::vector<lineitem> aos;
+    lineitem_table        tbl;
+    aos.reserve(rows);
+    tbl.reserve(rows);
+
+    std::uint64_t state = 42;
+    const auto    next  = [&] {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return state >> 33;
+    };
+
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        const lineitem item{static_cast<double>(next() % 50 + 1),
+                            static_cast<double>(next() % 100000) / 10,
+                            static_cast<double>(next() % 11) / 100,
+                            static_cast<double>(next() % 9) / 100,
+                            static_cast<std::uint8_t>("ANR"[next() % 3]),
+                            static_cast<std::uint8_t>("FO"[next() % 2]),
+                            static_cast<std::int32_t>(next() % 2526),
+                            i / 4};
+        aos.push_back(item);
+        tbl.push_back(item.quantity,
+                      item.extendedprice,
+                      item.discount,
+                      item.tax,
+                      item.returnflag,
+                      item.linestatus,
+                      item.shipdate,
+                      item.orderkey);
+    }
+
+    // Q6: revenue of discounted small orders shipped in one year
+    bench::run("Q6 hera::table", rows, repetitions, [&] {
+        const auto res =
+            tbl.query()
+                .where<6>([](std::int32_t d) { return d >= q6_from; })
+                .where<6>([](std::int32_t d) { return d < q6_to; })
+                .where<2>([](double d) { return d >= 0.05 && d <= 0.07; })
+                .where<0>([](double q) { return q < 24; })
+                .aggregate(hera::tuple{hera::sum_of<1, 2>(
+                    [](double price, double discount) {
+                        return price * discount;
+                    })});
+        bench::do_not_optimize(hera::get<0>(res));
+    });
+
+    bench::run("Q6 vector of structs", rows, repetitions, [&] {
+        double revenue = 0;
+        for (const auto& item : aos)
+        {
+            if (item.shipdate >= q6_from && item.shipdate < q6_to &&
+                item.discount >= 0.05 && item.discount <= 0.07 &&
+                item.quantity < 24)
+            {
+                revenue += item.extendedprice * item.discount;
+            }
+        }
+        bench::do_not_optimize(revenue);
+    });
+
+    // Q1 without the grouping: pricing summary of almost all rows
+    bench::run("Q1 hera::table", rows, repetitions, [&] {
+        const auto res =
+            tbl.query()
+                .where<6>([](std::int32_t d) { return d <= q1_until; })
+                .aggregate(hera::tuple{
+                    hera::sum<0>,
+                    hera::sum<1>,
+                    hera::sum_of<1, 2>([](double price, double discount) {
+                        return price * (1 - discount);
+                    }),
+                    hera::sum_of<1, 2, 3>(
+                        [](double price, double discount, double tax) {
+                            return price * (1 - discount) * (1 + tax);
+                        }),
+                    hera::avg<0>,
+                    hera::avg<2>,
+                    hera::count});
+        bench::do_not_optimize(hera::get<6>(res));
+    });
+
+    bench::run("Q1 vector of structs", rows, repetitions, [&] {
+        double      quantity   = 0;
+        double      price      = 0;
+        double      disc_price = 0;
+        double      charge     = 0;
+        double      discount   = 0;
+        std::size_t count      = 0;
+        for (const auto& item : aos)
+        {
+            if (item.shipdate <= q1_until)
+            {
+                quantity += item.quantity;
+                price += item.extendedprice;
+                disc_price += item.extendedprice * (1 - item.discount);
+                charge += item.extendedprice * (1 - item.discount) *
+                          (1 + item.tax);
+                discount += item.discount;
+                ++count;
+            }
+        }
+        bench::do_not_optimize(quantity + price + disc_price + charge +
+                               discount / count);
+    });
+}
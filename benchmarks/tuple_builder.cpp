@@ -0,0 +1,114 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "bench.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/container/tuple_builder.hpp"
+
+namespace
+{
+// copied and moved alike
+using payload = std::array<std::uint64_t, 32>;
+
+constexpr std::size_t elements = 16;
+
+template<std::size_t N, typename Tuple>
+auto push_back_chain(Tuple&& tup, const payload& value)
+{
+    if constexpr (N == 0)
+    {
+        return std::forward<Tuple>(tup);
+    }
+    else
+    {
+        return push_back_chain<N - 1>(std::move(tup).push_back(value), value);
+    }
+}
+
+template<std::size_t N, typename Builder>
+auto builder_chain(Builder&& builder, const payload& value)
+{
+    if constexpr (N == 0)
+    {
+        return std::move(builder).build();
+    }
+    else
+    {
+        return builder_chain<N - 1>(std::move(builder).push_back(value), value);
+    }
+}
+
+template<std::size_t N>
+auto filled(const payload& value)
+{
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+    {
+        return hera::tuple<std::enable_if_t<(Is >= 0), payload>...>{
+            (static_cast<void>(Is), value)...};
+    }
+    (std::make_index_sequence<N>{});
+}
+} // namespace
+
+int main()
+{
+    constexpr std::size_t tuples      = 1 << 16;
+    constexpr std::size_t repetitions = 10;
+
+    payload value{};
+    value[0] = 42;
+
+    std::uint64_t sum = 0;
+
+    bench::run("push_back chain", tuples, repetitions, [&] {
+        for (std::size_t i = 0; i != tuples; ++i)
+        {
+            value[1]       = i;
+            const auto tup = push_back_chain<elements>(hera::tuple<>{}, value);
+            sum += hera::get<elements - 1>(tup)[1];
+            bench::do_not_optimize(tup);
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    bench::run("hera::tuple_builder", tuples, repetitions, [&] {
+        for (std::size_t i = 0; i != tuples; ++i)
+        {
+            value[1]       = i;
+            const auto tup =
+                builder_chain<elements>(hera::tuple_builder{}, value);
+            sum += hera::get<elements - 1>(tup)[1];
+            bench::do_not_optimize(tup);
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    auto front = filled<elements / 2>(value);
+    auto back  = filled<elements / 2>(value);
+
+    bench::run("push_back chain onto a tuple", tuples, repetitions, [&] {
+        for (std::size_t i = 0; i != tuples; ++i)
+        {
+            hera::get<0>(back)[1] = i;
+            const auto tup =
+                push_back_chain<elements / 2>(front, hera::get<0>(back));
+            sum += hera::get<elements - 1>(tup)[1];
+            bench::do_not_optimize(tup);
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    bench::run("hera::tuple_cat", tuples, repetitions, [&] {
+        for (std::size_t i = 0; i != tuples; ++i)
+        {
+            hera::get<0>(back)[1] = i;
+            const auto tup        = hera::tuple_cat(front, back);
+            sum += hera::get<elements / 2>(tup)[1];
+            bench::do_not_optimize(tup);
+        }
+        bench::do_not_optimize(sum);
+    });
+}
@@ -0,0 +1,28 @@
+#include <cstdio>
+
+#include "hera/log.hpp"
+
+// turns a binary log written by hera::log_backend back into text
+//
+//   log_decode [input [output]]
+//
+// reads from stdin and writes to stdout if no files are given
+int main(int argc, char** argv)
+{
+    std::FILE* in  = argc > 1 ? std::fopen(argv[1], "rb") : stdin;
+    std::FILE* out = argc > 2 ? std::fopen(argv[2], "w") : stdout;
+
+    if (in == nullptr || out == nullptr)
+    {
+        std::perror("log_decode");
+        return 1;
+    }
+
+    if (!hera::log_decode(in, out))
+    {
+        std::fputs("log_decode: malformed log\n", stderr);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#include "hera/utility/detail/byteswap.hpp"
+#include "hera/utility/detail/simd.hpp"
+#include "hera/view/array.hpp"
+
+namespace hera
+{
+/// writes the values of `from` with their bytes reversed to `to`, which is at
+/// least as large and either the same as or disjoint from `from`
+///
+/// Whole blocks of 16 bytes are swapped with a vector shuffle.
+template<detail::byteswappable T>
+void byteswap_copy(std::span<const T> from, std::span<T> to) noexcept
+{
+    if constexpr (sizeof(T) == 1)
+    {
+        if (from.data() != to.data() && !from.empty())
+        {
+            std::memcpy(to.data(), from.data(), from.size_bytes());
+        }
+    }
+    else
+    {
+        constexpr std::size_t per_block = detail::simd_width / sizeof(T);
+
+        const auto* src  = reinterpret_cast<const std::byte*>(from.data());
+        auto*       dest = reinterpret_cast<std::byte*>(to.data());
+
+        std::size_t i = 0;
+        for (; i + per_block <= from.size(); i += per_block)
+        {
+            detail::byteswap16<sizeof(T)>(src + i * sizeof(T),
+                                          dest + i * sizeof(T));
+        }
+
+        for (; i < from.size(); ++i)
+        {
+            to[i] = detail::byteswap(from[i]);
+        }
+    }
+}
+
+/// reverses the bytes of every value in `values`
+template<detail::byteswappable T>
+void byteswap(std::span<T> values) noexcept
+{
+    hera::byteswap_copy(std::span<const T>{values}, values);
+}
+
+template<detail::byteswappable T, std::size_t N> // clang-format off
+    requires (!std::is_const_v<T>)
+void byteswap(hera::array_view<T, N> values) noexcept // clang-format on
+{
+    hera::byteswap(std::span<T>{values.data(), N});
+}
+} // namespace hera
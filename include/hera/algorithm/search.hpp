@@ -0,0 +1,374 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+#include "hera/container/string.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/utility/detail/automaton.hpp"
+#include "hera/utility/detail/simd.hpp"
+
+namespace hera
+{
+namespace detail
+{
+enum class search_strategy
+{
+    empty,
+    single_byte,
+    probe_filter,
+    horspool,
+};
+
+template<hera::constant_string Needle>
+struct needle_searcher
+{
+    static constexpr std::string_view needle =
+        static_cast<std::string_view>(Needle{});
+    static constexpr std::size_t size = needle.size();
+
+    static constexpr search_strategy strategy =
+        size == 0 ? search_strategy::empty
+                  : size == 1 ? search_strategy::single_byte
+                              : size <= 64 ? search_strategy::probe_filter
+                                           : search_strategy::horspool;
+
+    // the second byte compared by the filter, the last one which differs
+    // from the first byte so that runs of the same character are filtered as
+    // well
+    static constexpr std::size_t probe = [] {
+        for (std::size_t i = size; i-- > 1;)
+        {
+            if (needle[i] != needle[0])
+            {
+                return i;
+            }
+        }
+
+        return size == 0 ? 0 : size - 1;
+    }();
+
+    // bad character shifts of the last byte of each window
+    static constexpr auto shifts = [] {
+        std::array<std::size_t, 256> table{};
+
+        for (auto& shift : table)
+        {
+            shift = size;
+        }
+
+        for (std::size_t i = 0; i + 1 < size; ++i)
+        {
+            table[static_cast<unsigned char>(needle[i])] = size - 1 - i;
+        }
+
+        return table;
+    }();
+
+    static std::size_t find_filtered(std::string_view haystack) noexcept
+    {
+        const char* data = haystack.data();
+        const auto  last = haystack.size() - size;
+
+        std::size_t pos = 0;
+
+        for (; pos + detail::simd_width <= last + 1;
+             pos += detail::simd_width)
+        {
+            auto mask = detail::eq_mask16(data + pos, needle[0]) &
+                        detail::eq_mask16(data + pos + probe, needle[probe]);
+
+            while (mask != 0)
+            {
+                const auto candidate = pos + std::countr_zero(mask);
+
+                if (std::memcmp(data + candidate, needle.data(), size) == 0)
+                {
+                    return candidate;
+                }
+
+                mask &= mask - 1;
+            }
+        }
+
+        for (; pos <= last; ++pos)
+        {
+            if (data[pos] == needle[0] && data[pos + probe] == needle[probe] &&
+                std::memcmp(data + pos, needle.data(), size) == 0)
+            {
+                return pos;
+            }
+        }
+
+        return std::string_view::npos;
+    }
+
+    static std::size_t find_horspool(std::string_view haystack) noexcept
+    {
+        const char* data = haystack.data();
+        const auto  last = haystack.size() - size;
+
+        std::size_t pos = 0;
+
+        while (pos <= last)
+        {
+            const auto back = data[pos + size - 1];
+
+            if (back == needle[size - 1] &&
+                std::memcmp(data + pos, needle.data(), size - 1) == 0)
+            {
+                return pos;
+            }
+
+            pos += shifts[static_cast<unsigned char>(back)];
+        }
+
+        return std::string_view::npos;
+    }
+
+    static constexpr std::size_t find(std::string_view haystack) noexcept
+    {
+        if (std::is_constant_evaluated())
+        {
+            return haystack.find(needle);
+        }
+
+        if constexpr (strategy == search_strategy::empty)
+        {
+            return 0;
+        }
+        else if constexpr (strategy == search_strategy::single_byte)
+        {
+            const auto* found = static_cast<const char*>(
+                std::memchr(haystack.data(), needle[0], haystack.size()));
+
+            return found != nullptr
+                       ? static_cast<std::size_t>(found - haystack.data())
+                       : std::string_view::npos;
+        }
+        else
+        {
+            if (haystack.size() < size)
+            {
+                return std::string_view::npos;
+            }
+
+            if constexpr (strategy == search_strategy::probe_filter)
+            {
+                return find_filtered(haystack);
+            }
+            else
+            {
+                return find_horspool(haystack);
+            }
+        }
+    }
+};
+
+// a trie of all needles with a looping start state, the determinized
+// automaton is the Aho-Corasick automaton of the needles
+template<hera::constant_string... Needles>
+struct needle_set
+{
+    static constexpr std::array<std::string_view, sizeof...(Needles)> needles{
+        static_cast<std::string_view>(Needles{})...};
+
+    static constexpr detail::nfa make_nfa()
+    {
+        detail::nfa automaton{};
+        automaton.start = automaton.add_state();
+        automaton.add_edge(automaton.start, 0x00, 0xff, automaton.start);
+
+        for (std::size_t index = 0; index < needles.size(); ++index)
+        {
+            auto state = automaton.start;
+
+            for (char ch : needles[index])
+            {
+                const auto next = automaton.add_state();
+                automaton.add_edge(state, static_cast<unsigned char>(ch), next);
+                state = next;
+            }
+
+            if (state == automaton.start)
+            {
+                // an empty needle matches right away
+                const auto next = automaton.add_state();
+                automaton.add_epsilon(state, next);
+                state = next;
+            }
+
+            automaton.states[state].accept = static_cast<int>(index);
+        }
+
+        return automaton;
+    }
+
+    // distinct first bytes of the needles, while the automaton sits in its
+    // start state only these bytes can make progress
+    static constexpr auto first_bytes = [] {
+        std::array<char, sizeof...(Needles)> bytes{};
+        std::size_t                          count = 0;
+
+        for (auto needle : needles)
+        {
+            if (needle.empty())
+            {
+                return std::pair{bytes, std::size_t{0}};
+            }
+
+            bool seen = false;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                seen = seen || bytes[i] == needle[0];
+            }
+
+            if (!seen)
+            {
+                bytes[count++] = needle[0];
+            }
+        }
+
+        return std::pair{bytes, count};
+    }();
+
+    static constexpr bool prefilter =
+        first_bytes.second != 0 && first_bytes.second <= 4;
+
+    /// position of the next byte starting any needle at or after pos
+    static std::size_t skip(std::string_view haystack, std::size_t pos) noexcept
+    {
+        return skip(haystack, pos, std::make_index_sequence<first_bytes.second>{});
+    }
+
+    template<std::size_t... Is>
+    static std::size_t skip(std::string_view haystack,
+                            std::size_t      pos,
+                            std::index_sequence<Is...>) noexcept
+    {
+        const char* data = haystack.data();
+
+        for (; pos + detail::simd_width <= haystack.size();
+             pos += detail::simd_width)
+        {
+            if (const auto mask =
+                    detail::eq_mask16(data + pos, first_bytes.first[Is]...);
+                mask != 0)
+            {
+                return pos + std::countr_zero(mask);
+            }
+        }
+
+        for (; pos < haystack.size(); ++pos)
+        {
+            if (((data[pos] == first_bytes.first[Is]) || ...))
+            {
+                return pos;
+            }
+        }
+
+        return pos;
+    }
+};
+} // namespace detail
+
+struct search_result
+{
+    /// start of the match or npos
+    std::size_t position = std::string_view::npos;
+    /// index of the matching needle
+    std::size_t index = 0;
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return position != std::string_view::npos;
+    }
+};
+
+namespace search_impl
+{
+struct fn
+{
+    /// position of the first occurrence of `needle` within `haystack` or npos
+    ///
+    /// The search strategy is selected from the needle at compile time: a
+    /// memchr for single bytes, a vectorized filter on two bytes of the needle
+    /// for short needles and Horspool with a precomputed shift table for long
+    /// ones.
+    template<hera::constant_string Needle>
+    constexpr std::size_t operator()(std::string_view haystack, Needle) const
+        noexcept
+    {
+        return detail::needle_searcher<Needle>::find(haystack);
+    }
+};
+} // namespace search_impl
+
+namespace search_any_impl
+{
+struct fn
+{
+    /// finds the occurrence of any of the needles which ends first, ties are
+    /// resolved in favour of the needle listed first.
+    template<hera::constant_string... Needles>
+    constexpr search_result operator()(std::string_view haystack,
+                                       const hera::tuple<Needles...>&) const
+        noexcept
+    {
+        using needle_set = detail::needle_set<Needles...>;
+
+        constexpr auto& table = automaton<Needles...>;
+
+        auto state = table.start;
+
+        if (const auto accept = table.accept[state]; accept >= 0)
+        {
+            return search_result{0, static_cast<std::size_t>(accept)};
+        }
+
+        for (std::size_t pos = 0; pos < haystack.size();)
+        {
+            if constexpr (needle_set::prefilter)
+            {
+                if (state == table.start && !std::is_constant_evaluated())
+                {
+                    pos = needle_set::skip(haystack, pos);
+
+                    if (pos == haystack.size())
+                    {
+                        break;
+                    }
+                }
+            }
+
+            state =
+                table.step(state, static_cast<unsigned char>(haystack[pos++]));
+
+            if (const auto accept = table.accept[state]; accept >= 0)
+            {
+                const auto index = static_cast<std::size_t>(accept);
+                return search_result{pos - needle_set::needles[index].size(),
+                                     index};
+            }
+        }
+
+        return {};
+    }
+
+private:
+    template<hera::constant_string... Needles>
+    static constexpr auto automaton =
+        detail::make_dfa_table<detail::needle_set<Needles...>>();
+};
+} // namespace search_any_impl
+
+inline namespace cpo
+{
+inline constexpr auto search = hera::search_impl::fn{};
+
+inline constexpr auto search_any = hera::search_any_impl::fn{};
+} // namespace cpo
+} // namespace hera
@@ -0,0 +1,344 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "hera/container/integer_sequence.hpp"
+#include "hera/get.hpp"
+#include "hera/ranges.hpp"
+#include "hera/size.hpp"
+#include "hera/utility/detail/packed.hpp"
+
+namespace hera
+{
+template<typename... Ts>
+class tuple;
+
+template<typename T, typename U>
+class pair;
+
+namespace detail
+{
+/// `<=>` where the operands have it, otherwise a weak ordering built from `<`
+struct synth_three_way_fn
+{
+    template<typename T, typename U> // clang-format off
+        requires requires (const T& t, const U& u)
+        {
+            { t < u } -> std::convertible_to<bool>;
+            { u < t } -> std::convertible_to<bool>;
+        }
+    constexpr auto operator()(const T& t, const U& u) const // clang-format on
+    {
+        if constexpr (std::three_way_comparable_with<T, U>)
+        {
+            return t <=> u;
+        }
+        else
+        {
+            if (t < u)
+            {
+                return std::weak_ordering::less;
+            }
+            if (u < t)
+            {
+                return std::weak_ordering::greater;
+            }
+            return std::weak_ordering::equivalent;
+        }
+    }
+};
+
+inline constexpr synth_three_way_fn synth_three_way{};
+
+template<typename R, std::size_t I>
+using compare_element_t = decltype(hera::get<I>(std::declval<const R&>()));
+
+template<typename L, typename R, std::size_t I>
+concept equality_comparable_element = // clang-format off
+    requires (compare_element_t<L, I> l, compare_element_t<R, I> r)
+    {
+        { l == r } -> std::convertible_to<bool>;
+    }; // clang-format on
+
+template<typename L, typename R, std::size_t I>
+concept three_way_comparable_element = // clang-format off
+    requires (compare_element_t<L, I> l, compare_element_t<R, I> r)
+    {
+        detail::synth_three_way(l, r);
+    }; // clang-format on
+
+template<typename L, typename R, typename Is>
+inline constexpr bool equality_comparable_at_v = false;
+
+template<typename L, typename R, std::size_t... Is>
+inline constexpr bool
+    equality_comparable_at_v<L, R, std::index_sequence<Is...>> =
+        (equality_comparable_element<L, R, Is> && ...);
+
+template<typename L, typename R, typename Is>
+inline constexpr bool three_way_comparable_at_v = false;
+
+template<typename L, typename R, std::size_t... Is>
+inline constexpr bool
+    three_way_comparable_at_v<L, R, std::index_sequence<Is...>> =
+        (three_way_comparable_element<L, R, Is> && ...);
+
+template<typename L, typename R, std::size_t... Is>
+using compare_result_t =
+    std::common_comparison_category_t<decltype(detail::synth_three_way(
+        std::declval<compare_element_t<L, Is>>(),
+        std::declval<compare_element_t<R, Is>>()))...>;
+
+/// types which are equal exactly when their bytes are: integers, enums,
+/// pointers and tuples and arrays of them without padding
+template<typename T>
+struct bytes_equal
+    : std::bool_constant<(std::is_integral_v<T> || std::is_enum_v<T> ||
+                          std::is_pointer_v<T>) &&
+                         std::has_unique_object_representations_v<T>>
+{};
+
+template<typename T, std::size_t N>
+struct bytes_equal<std::array<T, N>> : bytes_equal<T>
+{};
+
+template<typename... Ts>
+struct bytes_equal<hera::tuple<Ts...>>
+    : std::bool_constant<packed_range_v<bytes_equal, hera::tuple<Ts...>>>
+{};
+
+template<typename T, typename U>
+struct bytes_equal<hera::pair<T, U>>
+    : std::bool_constant<packed_range_v<bytes_equal, hera::pair<T, U>>>
+{};
+
+/// types whose order is the one of their bytes: single byte unsigned
+/// integers, any unsigned integer on big endian targets, and tuples and
+/// arrays of them without padding
+template<typename T>
+struct bytes_ordered
+    : std::bool_constant<std::is_same_v<T, std::byte> ||
+                         (std::is_unsigned_v<T> &&
+                          (sizeof(T) == 1 ||
+                           std::endian::native == std::endian::big))>
+{};
+
+template<typename T, std::size_t N>
+struct bytes_ordered<std::array<T, N>> : bytes_ordered<T>
+{};
+
+template<typename... Ts>
+struct bytes_ordered<hera::tuple<Ts...>>
+    : std::bool_constant<packed_range_v<bytes_ordered, hera::tuple<Ts...>>>
+{};
+
+template<typename T, typename U>
+struct bytes_ordered<hera::pair<T, U>>
+    : std::bool_constant<packed_range_v<bytes_ordered, hera::pair<T, U>>>
+{};
+
+/// up to this many bytes are compared word by word without branches,
+/// larger objects call `memcmp`, which stops at the first difference
+inline constexpr std::size_t equal_words_max_size = 64;
+
+/// whether the `N` bytes at `lhs` and `rhs` are equal
+template<std::size_t N>
+bool equal_bytes(const void* lhs, const void* rhs) noexcept
+{
+    if constexpr (N > equal_words_max_size)
+    {
+        return std::memcmp(lhs, rhs, N) == 0;
+    }
+    else
+    {
+        const auto* l = static_cast<const unsigned char*>(lhs);
+        const auto* r = static_cast<const unsigned char*>(rhs);
+
+        const auto word_xor = [&]<typename Word>(std::size_t offset) {
+            Word a;
+            Word b;
+            std::memcpy(&a, l + offset, sizeof(Word));
+            std::memcpy(&b, r + offset, sizeof(Word));
+            return static_cast<std::uint64_t>(a ^ b);
+        };
+
+        std::uint64_t res = 0;
+        std::size_t   i   = 0;
+        for (; i + 8 <= N; i += 8)
+        {
+            res |= word_xor.template operator()<std::uint64_t>(i);
+        }
+        if constexpr (N % 8 >= 4)
+        {
+            res |= word_xor.template operator()<std::uint32_t>(i);
+            i += 4;
+        }
+        if constexpr (N % 4 >= 2)
+        {
+            res |= word_xor.template operator()<std::uint16_t>(i);
+            i += 2;
+        }
+        if constexpr (N % 2 == 1)
+        {
+            res |= word_xor.template operator()<std::uint8_t>(i);
+        }
+
+        return res == 0;
+    }
+}
+
+template<std::size_t... Is, typename L, typename R>
+constexpr bool equal_at(const L& lhs, const R& rhs)
+{
+    return ((hera::get<Is>(lhs) == hera::get<Is>(rhs)) && ...);
+}
+
+template<std::size_t... Is, typename L, typename R>
+constexpr auto compare_at(const L& lhs, const R& rhs)
+{
+    compare_result_t<L, R, Is...> res = std::strong_ordering::equal;
+
+    // stops at the first element which isn't equivalent
+    static_cast<void>((((res = detail::synth_three_way(hera::get<Is>(lhs),
+                                                       hera::get<Is>(rhs))) ==
+                        0) &&
+                       ...));
+
+    return res;
+}
+} // namespace detail
+
+/// whether the elements of two bounded ranges of the same size are pairwise
+/// equal, or only the ones at the positions of a `hera::index_sequence`
+///
+/// Stops at the first element which differs. Tuples, pairs and arrays of
+/// integers without padding are compared as raw bytes instead, a machine
+/// word at a time for small ones and with `memcmp` for large ones.
+struct equal_fn
+{
+    template<typename L, typename R> // clang-format off
+        requires hera::bounded_range<const L&> &&
+                 hera::bounded_range<const R&> &&
+                 (hera::size_v<const L&> == hera::size_v<const R&>) &&
+                 detail::equality_comparable_at_v<
+                    L, R, std::make_index_sequence<hera::size_v<const L&>>>
+    constexpr bool operator()(const L& lhs, const R& rhs) const // clang-format on
+    {
+        if constexpr (std::is_same_v<L, R> && detail::bytes_equal<L>::value)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return detail::equal_bytes<sizeof(L)>(std::addressof(lhs),
+                                                      std::addressof(rhs));
+            }
+        }
+
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return detail::equal_at<Is...>(lhs, rhs);
+        }
+        (std::make_index_sequence<hera::size_v<const L&>>{});
+    }
+
+    template<typename L, typename R, std::size_t... Is> // clang-format off
+        requires hera::bounded_range<const L&> &&
+                 hera::bounded_range<const R&> &&
+                 detail::equality_comparable_at_v<
+                    L, R, std::index_sequence<Is...>>
+    constexpr bool operator()(const L& lhs,
+                              const R& rhs,
+                              hera::index_sequence<Is...>) const // clang-format on
+    {
+        return detail::equal_at<Is...>(lhs, rhs);
+    }
+};
+
+inline constexpr equal_fn equal{};
+
+/// the lexicographic order of two bounded ranges of the same size, or of
+/// only their elements at the positions of a `hera::index_sequence`
+///
+/// Elements are compared with `<=>`, or with `<` where they lack it, up to
+/// the first one which isn't equivalent. The result is the common comparison
+/// category of all of them. Tuples, pairs and arrays of single byte unsigned
+/// integers without padding are compared with a single `memcmp`.
+struct compare_fn
+{
+    template<typename L, typename R> // clang-format off
+        requires hera::bounded_range<const L&> &&
+                 hera::bounded_range<const R&> &&
+                 (hera::size_v<const L&> == hera::size_v<const R&>) &&
+                 detail::three_way_comparable_at_v<
+                    L, R, std::make_index_sequence<hera::size_v<const L&>>>
+    constexpr auto operator()(const L& lhs, const R& rhs) const // clang-format on
+    {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            using result_type = detail::compare_result_t<L, R, Is...>;
+
+            if constexpr (std::is_same_v<L, R> &&
+                          detail::bytes_ordered<L>::value)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    return result_type{std::memcmp(std::addressof(lhs),
+                                                   std::addressof(rhs),
+                                                   sizeof(L)) <=> 0};
+                }
+            }
+
+            return detail::compare_at<Is...>(lhs, rhs);
+        }
+        (std::make_index_sequence<hera::size_v<const L&>>{});
+    }
+
+    template<typename L, typename R, std::size_t... Is> // clang-format off
+        requires hera::bounded_range<const L&> &&
+                 hera::bounded_range<const R&> &&
+                 detail::three_way_comparable_at_v<
+                    L, R, std::index_sequence<Is...>>
+    constexpr auto operator()(const L& lhs,
+                              const R& rhs,
+                              hera::index_sequence<Is...>) const // clang-format on
+    {
+        return detail::compare_at<Is...>(lhs, rhs);
+    }
+};
+
+inline constexpr compare_fn compare{};
+
+/// whether `lhs` orders before `rhs` by `hera::compare`, usable as the
+/// comparator of standard algorithms and containers
+struct less_fn
+{
+    template<typename L, typename R> // clang-format off
+        requires std::invocable<const compare_fn&, const L&, const R&>
+    constexpr bool operator()(const L& lhs, const R& rhs) const // clang-format on
+    {
+        return hera::compare(lhs, rhs) < 0;
+    }
+
+    template<typename L, typename R, std::size_t... Is> // clang-format off
+        requires std::invocable<const compare_fn&,
+                                const L&,
+                                const R&,
+                                hera::index_sequence<Is...>>
+    constexpr bool operator()(const L&                    lhs,
+                              const R&                    rhs,
+                              hera::index_sequence<Is...> positions) const // clang-format on
+    {
+        return hera::compare(lhs, rhs, positions) < 0;
+    }
+};
+
+inline constexpr less_fn less{};
+} // namespace hera
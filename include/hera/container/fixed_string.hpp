@@ -0,0 +1,421 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "hera/container/string.hpp"
+#include "hera/view/interface.hpp"
+
+namespace hera
+{
+/// a string of `N` characters usable as a class non-type template parameter
+///
+/// Unlike `basic_string`, which spells out every character as a template
+/// argument, the characters live in an array, so manipulating them is
+/// ordinary constexpr array code and only the length is part of the type.
+template<typename CharT, std::size_t N>
+struct basic_fixed_string
+{
+    using value_type      = CharT;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using const_reference = const value_type&;
+    using const_pointer   = const value_type*;
+
+    static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+    // public so the type stays structural
+    value_type chars[N + 1]{};
+
+    constexpr basic_fixed_string() noexcept = default;
+
+    constexpr basic_fixed_string(const value_type (&str)[N + 1]) noexcept
+    {
+        std::copy_n(str, N, chars);
+    }
+
+    /// the first `N` characters of `str`, which must be at least that long
+    constexpr explicit basic_fixed_string(
+        std::basic_string_view<value_type> str) noexcept
+    {
+        std::copy_n(str.data(), N, chars);
+    }
+
+    constexpr operator std::basic_string_view<value_type>() const noexcept
+    {
+        return std::basic_string_view<value_type>(chars, N);
+    }
+
+    constexpr const_pointer data() const noexcept
+    {
+        return chars;
+    }
+
+    constexpr const_pointer c_str() const noexcept
+    {
+        return chars;
+    }
+
+    std::basic_string<value_type> str() const
+    {
+        return std::basic_string<value_type>(chars, N);
+    }
+
+    static constexpr size_type size() noexcept
+    {
+        return N;
+    }
+
+    static constexpr bool empty() noexcept
+    {
+        return N == 0;
+    }
+
+    constexpr value_type operator[](size_type idx) const noexcept
+    {
+        return chars[idx];
+    }
+
+    [[nodiscard]] constexpr basic_fixed_string<value_type, 0>
+    clear() const noexcept
+    {
+        return {};
+    }
+
+    [[nodiscard]] constexpr basic_fixed_string<value_type, N - 1>
+    pop_back() const noexcept requires(N > 0)
+    {
+        basic_fixed_string<value_type, N - 1> res;
+        std::copy_n(chars, N - 1, res.chars);
+        return res;
+    }
+
+    [[nodiscard]] constexpr basic_fixed_string<value_type, N - 1>
+    pop_front() const noexcept requires(N > 0)
+    {
+        basic_fixed_string<value_type, N - 1> res;
+        std::copy_n(chars + 1, N - 1, res.chars);
+        return res;
+    }
+
+    [[nodiscard]] constexpr basic_fixed_string<value_type, N + 1>
+    push_back(value_type ch) const noexcept
+    {
+        basic_fixed_string<value_type, N + 1> res;
+        std::copy_n(chars, N, res.chars);
+        res.chars[N] = ch;
+        return res;
+    }
+
+    [[nodiscard]] constexpr basic_fixed_string<value_type, N + 1>
+    push_front(value_type ch) const noexcept
+    {
+        basic_fixed_string<value_type, N + 1> res;
+        res.chars[0] = ch;
+        std::copy_n(chars, N, res.chars + 1);
+        return res;
+    }
+
+    template<size_type Pos, size_type Count = npos> // clang-format off
+        requires (Pos <= N)
+    [[nodiscard]] constexpr auto substr() const noexcept // clang-format on
+    {
+        constexpr auto count = std::min(Count, N - Pos);
+
+        basic_fixed_string<value_type, count> res;
+        std::copy_n(chars + Pos, count, res.chars);
+        return res;
+    }
+
+    /// the string without the character at `idx`
+    [[nodiscard]] constexpr basic_fixed_string<value_type, N - 1>
+    erase(size_type idx) const noexcept requires(N > 0)
+    {
+        basic_fixed_string<value_type, N - 1> res;
+        std::copy_n(chars, idx, res.chars);
+        std::copy_n(chars + idx + 1, N - idx - 1, res.chars + idx);
+        return res;
+    }
+
+    template<std::size_t M>
+    [[nodiscard]] constexpr basic_fixed_string<value_type, N + M>
+    append(const basic_fixed_string<value_type, M>& other) const noexcept
+    {
+        basic_fixed_string<value_type, N + M> res;
+        std::copy_n(chars, N, res.chars);
+        std::copy_n(other.chars, M, res.chars + N);
+        return res;
+    }
+
+    template<std::size_t M>
+    [[nodiscard]] constexpr int
+    compare(const basic_fixed_string<value_type, M>& other) const noexcept
+    {
+        return static_cast<std::basic_string_view<value_type>>(*this).compare(
+            static_cast<std::basic_string_view<value_type>>(other));
+    }
+
+    template<std::size_t M>
+    [[nodiscard]] friend constexpr basic_fixed_string<value_type, N + M>
+    operator+(const basic_fixed_string&                    lhs,
+              const basic_fixed_string<value_type, M>& rhs) noexcept
+    {
+        return lhs.append(rhs);
+    }
+
+    template<std::size_t M>
+    [[nodiscard]] friend constexpr bool
+    operator==(const basic_fixed_string&                    lhs,
+               const basic_fixed_string<value_type, M>& rhs) noexcept
+    {
+        return lhs.compare(rhs) == 0;
+    }
+};
+
+template<typename CharT, std::size_t N>
+basic_fixed_string(const CharT (&)[N]) -> basic_fixed_string<CharT, N - 1>;
+
+template<std::size_t N>
+using fixed_string = basic_fixed_string<char, N>;
+
+template<std::size_t N>
+using fixed_wstring = basic_fixed_string<wchar_t, N>;
+
+template<std::size_t N>
+using fixed_u8string = basic_fixed_string<char8_t, N>;
+
+template<std::size_t N>
+using fixed_u16string = basic_fixed_string<char16_t, N>;
+
+template<std::size_t N>
+using fixed_u32string = basic_fixed_string<char32_t, N>;
+
+/// a `basic_fixed_string` lifted into the type system
+///
+/// Provides the interface of `basic_string`, every character is a constant,
+/// so it models the same `constant_string` concepts and can be used wherever
+/// a `basic_string` is expected. Manipulations are carried out on the
+/// underlying `basic_fixed_string`.
+template<basic_fixed_string S>
+class fixed_string_constant
+    : public view_interface<fixed_string_constant<S>>
+{
+private:
+    using fixed_type_ = std::remove_cvref_t<decltype(S)>;
+
+public:
+    using value_type      = typename fixed_type_::value_type;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = value_type*;
+    using const_pointer   = const value_type*;
+
+    static constexpr size_type npos = fixed_type_::npos;
+
+    static constexpr const fixed_type_& value = S;
+
+    fixed_string_constant() = default;
+
+    constexpr operator std::basic_string_view<value_type>() const
+    {
+        return static_cast<std::basic_string_view<value_type>>(S);
+    }
+
+    template<basic_fixed_string U>
+    [[nodiscard]] constexpr auto operator==(fixed_string_constant<U>) const
+    {
+        return std::bool_constant<(S == U)>{};
+    }
+
+    template<basic_fixed_string U>
+    [[nodiscard]] constexpr auto operator!=(fixed_string_constant<U>) const
+    {
+        return std::bool_constant<!(S == U)>{};
+    }
+
+    static constexpr const_pointer data()
+    {
+        return S.data();
+    }
+
+    static std::basic_string<value_type> str() noexcept
+    {
+        return S.str();
+    }
+
+    constexpr std::integral_constant<size_type, S.size()> size() const
+    {
+        return {};
+    }
+
+    constexpr std::bool_constant<S.empty()> empty() const
+    {
+        return {};
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < S.size())
+    constexpr auto get() const // clang-format on
+    {
+        return std::integral_constant<value_type, S[I]>{};
+    }
+
+    constexpr value_type operator[](std::size_t idx) const
+    {
+        return S[idx];
+    }
+
+    [[nodiscard]] constexpr fixed_string_constant<S.clear()> clear() const
+    {
+        return {};
+    }
+
+    [[nodiscard]] constexpr auto pop_back() const requires(!S.empty())
+    {
+        return fixed_string_constant<S.pop_back()>{};
+    }
+
+    [[nodiscard]] constexpr auto pop_front() const requires(!S.empty())
+    {
+        return fixed_string_constant<S.pop_front()>{};
+    }
+
+    template<value_type Char>
+    [[nodiscard]] constexpr fixed_string_constant<S.push_back(Char)>
+    push_back() const
+    {
+        return {};
+    }
+
+    template<value_type Char>
+    [[nodiscard]] constexpr fixed_string_constant<S.push_front(Char)>
+    push_front() const
+    {
+        return {};
+    }
+
+    template<size_type Pos, size_type Count = npos> // clang-format off
+        requires (Pos <= S.size())
+    constexpr auto substr() const // clang-format on
+    {
+        return fixed_string_constant<S.template substr<Pos, Count>()>{};
+    }
+
+    template<basic_fixed_string U>
+    [[nodiscard]] constexpr auto compare(fixed_string_constant<U>) const
+    {
+        return std::integral_constant<int, S.compare(U)>{};
+    }
+
+    template<basic_fixed_string U>
+    [[nodiscard]] constexpr fixed_string_constant<S.append(U)>
+        append(fixed_string_constant<U>) const
+    {
+        return {};
+    }
+
+    template<size_type I> // clang-format off
+        requires (I < S.size())
+    constexpr auto erase() const // clang-format on
+    {
+        return fixed_string_constant<S.erase(I)>{};
+    }
+};
+
+/// the `basic_fixed_string` holding the characters of a `basic_string`
+template<typename CharT, CharT... Chs>
+constexpr basic_fixed_string<CharT, sizeof...(Chs)>
+to_fixed_string(hera::basic_string<CharT, Chs...>) noexcept
+{
+    return {{Chs..., CharT{}}};
+}
+
+template<basic_fixed_string S>
+constexpr const auto& to_fixed_string(fixed_string_constant<S>) noexcept
+{
+    return S;
+}
+
+namespace detail
+{
+template<basic_fixed_string S, std::size_t... Is>
+constexpr auto to_basic_string_impl(std::index_sequence<Is...>) noexcept
+{
+    return hera::basic_string<typename decltype(S)::value_type, S[Is]...>{};
+}
+} // namespace detail
+
+/// the `basic_string` spelling out the characters of `S`
+template<basic_fixed_string S>
+constexpr auto to_basic_string() noexcept
+{
+    return detail::to_basic_string_impl<S>(
+        std::make_index_sequence<S.size()>{});
+}
+
+template<basic_fixed_string S>
+constexpr auto to_basic_string(fixed_string_constant<S>) noexcept
+{
+    return hera::to_basic_string<S>();
+}
+
+template<basic_fixed_string S, typename CharT, CharT... Chs>
+[[nodiscard]] constexpr auto operator==(fixed_string_constant<S>,
+                                        hera::basic_string<CharT, Chs...> str)
+{
+    return std::bool_constant<(S == hera::to_fixed_string(str))>{};
+}
+
+template<basic_fixed_string S, typename CharT, CharT... Chs>
+[[nodiscard]] constexpr auto operator==(hera::basic_string<CharT, Chs...> str,
+                                        fixed_string_constant<S>)
+{
+    return std::bool_constant<(S == hera::to_fixed_string(str))>{};
+}
+
+template<basic_fixed_string S, typename CharT, CharT... Chs>
+[[nodiscard]] constexpr auto operator!=(fixed_string_constant<S>,
+                                        hera::basic_string<CharT, Chs...> str)
+{
+    return std::bool_constant<!(S == hera::to_fixed_string(str))>{};
+}
+
+template<basic_fixed_string S, typename CharT, CharT... Chs>
+[[nodiscard]] constexpr auto operator!=(hera::basic_string<CharT, Chs...> str,
+                                        fixed_string_constant<S>)
+{
+    return std::bool_constant<!(S == hera::to_fixed_string(str))>{};
+}
+
+namespace literals
+{
+template<basic_fixed_string S>
+constexpr fixed_string_constant<S> operator""_fs() noexcept
+{
+    return {};
+}
+} // namespace literals
+} // namespace hera
+
+namespace std
+{
+template<hera::basic_fixed_string S>
+struct tuple_size<hera::fixed_string_constant<S>>
+    : std::integral_constant<std::size_t, S.size()>
+{};
+
+template<std::size_t I, hera::basic_fixed_string S>
+struct tuple_element<I, hera::fixed_string_constant<S>>
+{
+    using type = std::integral_constant<typename decltype(S)::value_type, S[I]>;
+};
+} // namespace std
@@ -3,6 +3,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "hera/compare.hpp"
 #include "hera/concepts.hpp"
 #include "hera/constant.hpp"
 #include "hera/optional.hpp"
@@ -141,6 +142,28 @@ public:
 template<typename T, typename U>
 pair(T&&, U &&) -> pair<std::decay_t<T>, std::decay_t<U>>;
 
+/// elementwise equality, see `hera::equal`
+template<typename T1, typename U1, typename T2, typename U2> // clang-format off
+    requires std::invocable<const equal_fn&,
+                            const hera::pair<T1, U1>&,
+                            const hera::pair<T2, U2>&>
+constexpr bool operator==(const hera::pair<T1, U1>& lhs,
+                          const hera::pair<T2, U2>& rhs) // clang-format on
+{
+    return hera::equal(lhs, rhs);
+}
+
+/// lexicographic order, see `hera::compare`
+template<typename T1, typename U1, typename T2, typename U2> // clang-format off
+    requires std::invocable<const compare_fn&,
+                            const hera::pair<T1, U1>&,
+                            const hera::pair<T2, U2>&>
+constexpr auto operator<=>(const hera::pair<T1, U1>& lhs,
+                           const hera::pair<T2, U2>& rhs) // clang-format on
+{
+    return hera::compare(lhs, rhs);
+}
+
 // basically deduce the decayed type of each entry
 template<pair_like P>
 pair(P&& p) -> pair<std::decay_t<decltype(hera::get<0>(static_cast<P&&>(p)))>,
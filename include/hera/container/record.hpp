@@ -0,0 +1,220 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "hera/container/string.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/nth_element.hpp"
+#include "hera/type_in_pack.hpp"
+#include "hera/utility/detail/perfect_hash.hpp"
+
+namespace hera
+{
+/// declares a member of a `record` named `Key` holding a `T`
+template<hera::constant_string auto Key, typename T>
+struct field
+{
+    using key_type   = std::remove_cv_t<decltype(Key)>;
+    using value_type = T;
+
+    static constexpr key_type key{};
+};
+
+namespace detail
+{
+template<typename F>
+struct is_record_field : std::false_type
+{};
+
+template<auto Key, typename T>
+struct is_record_field<hera::field<Key, T>> : std::true_type
+{};
+} // namespace detail
+
+template<typename F>
+concept record_field = detail::is_record_field<F>::value;
+
+/// a `hera::tuple` whose elements are also named by compile time strings
+///
+/// Elements are accessed by index like any bounded range or by key, the
+/// index of a key is found by overload resolution instead of a recursion
+/// over the fields. Runtime names are mapped onto indices through a perfect
+/// hash, like the keys of `static_map`.
+template<typename... Fields> // clang-format off
+    requires (hera::record_field<Fields> && ...) &&
+             hera::unique_types<typename Fields::key_type...>
+class record // clang-format on
+{
+public:
+    using values_type = hera::tuple<typename Fields::value_type...>;
+
+    static constexpr std::size_t npos = sizeof...(Fields);
+
+private:
+    static constexpr std::array<std::string_view, sizeof...(Fields)> keys_{
+        static_cast<std::string_view>(Fields::key)...};
+
+    static constexpr auto hash_ = detail::make_perfect_hash(keys_);
+
+    values_type values_;
+
+public:
+    record() = default;
+
+    constexpr record(typename Fields::value_type... values) // clang-format off
+        requires (sizeof...(Fields) != 0) // clang-format on
+        : values_{std::move(values)...}
+    {}
+
+    constexpr explicit record(values_type values) : values_{std::move(values)}
+    {}
+
+    constexpr std::integral_constant<std::size_t, sizeof...(Fields)> size() const
+        noexcept
+    {
+        return {};
+    }
+
+    constexpr std::bool_constant<sizeof...(Fields) == 0> empty() const noexcept
+    {
+        return {};
+    }
+
+    /// names of the fields in declaration order
+    static constexpr const std::array<std::string_view, sizeof...(Fields)>&
+    keys() noexcept
+    {
+        return keys_;
+    }
+
+    /// index of the field named `key` or npos
+    static constexpr std::size_t index_of(std::string_view key) noexcept
+    {
+        if constexpr (sizeof...(Fields) == 0)
+        {
+            return npos;
+        }
+        else
+        {
+            const auto index = hash_.candidate(key);
+
+            if (index != npos && keys_[index] == key)
+            {
+                return index;
+            }
+
+            return npos;
+        }
+    }
+
+    /// index of the field named `K`
+    template<hera::constant_string K> // clang-format off
+        requires hera::type_in_pack_unique<K, typename Fields::key_type...>
+    static constexpr std::size_t index_of(K) noexcept // clang-format on
+    {
+        return hera::type_in_pack_index_v<K, typename Fields::key_type...>;
+    }
+
+    constexpr values_type& values() & noexcept
+    {
+        return values_;
+    }
+
+    constexpr const values_type& values() const& noexcept
+    {
+        return values_;
+    }
+
+    constexpr values_type&& values() && noexcept
+    {
+        return std::move(values_);
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Fields))
+    constexpr decltype(auto) get() & noexcept // clang-format on
+    {
+        return values_.template get<I>();
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Fields))
+    constexpr decltype(auto) get() const & noexcept // clang-format on
+    {
+        return values_.template get<I>();
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Fields))
+    constexpr decltype(auto) get() && noexcept // clang-format on
+    {
+        return std::move(values_).template get<I>();
+    }
+
+    template<hera::constant_string auto K> // clang-format off
+        requires hera::type_in_pack_unique<std::remove_cv_t<decltype(K)>,
+                                           typename Fields::key_type...>
+    constexpr decltype(auto) get() & noexcept // clang-format on
+    {
+        return get<index_of(K)>();
+    }
+
+    template<hera::constant_string auto K> // clang-format off
+        requires hera::type_in_pack_unique<std::remove_cv_t<decltype(K)>,
+                                           typename Fields::key_type...>
+    constexpr decltype(auto) get() const & noexcept // clang-format on
+    {
+        return get<index_of(K)>();
+    }
+
+    template<hera::constant_string auto K> // clang-format off
+        requires hera::type_in_pack_unique<std::remove_cv_t<decltype(K)>,
+                                           typename Fields::key_type...>
+    constexpr decltype(auto) get() && noexcept // clang-format on
+    {
+        return std::move(*this).template get<index_of(K)>();
+    }
+
+    template<hera::constant_string K> // clang-format off
+        requires hera::type_in_pack_unique<K, typename Fields::key_type...>
+    constexpr decltype(auto) operator[](K) noexcept // clang-format on
+    {
+        return get<index_of(K{})>();
+    }
+
+    template<hera::constant_string K> // clang-format off
+        requires hera::type_in_pack_unique<K, typename Fields::key_type...>
+    constexpr decltype(auto) operator[](K) const noexcept // clang-format on
+    {
+        return get<index_of(K{})>();
+    }
+
+    friend constexpr bool operator==(const record& lhs, const record& rhs)
+    {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return ((lhs.template get<Is>() == rhs.template get<Is>()) && ...);
+        }
+        (std::index_sequence_for<Fields...>{});
+    }
+};
+} // namespace hera
+
+namespace std
+{
+template<typename... Fields>
+struct tuple_size<hera::record<Fields...>>
+    : std::integral_constant<std::size_t, sizeof...(Fields)>
+{};
+
+template<std::size_t I, typename... Fields>
+struct tuple_element<I, hera::record<Fields...>>
+{
+    using type = typename hera::nth_element_t<I, Fields...>::value_type;
+};
+} // namespace std
@@ -0,0 +1,549 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hera/container/tuple.hpp"
+#include "hera/utility/detail/aggregate.hpp"
+#include "hera/view/interface.hpp"
+
+namespace hera
+{
+namespace detail
+{
+template<typename Agg, std::size_t I>
+using aggregate_member_t = std::remove_cvref_t<decltype(
+    detail::aggregate_get<I>(std::declval<Agg&>()))>;
+
+template<typename Agg,
+         typename = std::make_index_sequence<aggregate_size_v<Agg>>>
+struct soa_pointers;
+
+template<typename Agg, std::size_t... Is>
+struct soa_pointers<Agg, std::index_sequence<Is...>>
+{
+    using type = hera::tuple<aggregate_member_t<Agg, Is>*...>;
+};
+} // namespace detail
+
+/// aggregates which can be split into columns
+template<typename T>
+concept soa_aggregate = // clang-format off
+    detail::reflectable_aggregate<T> &&
+    (detail::aggregate_size_v<T> != 0); // clang-format on
+
+template<hera::soa_aggregate Agg>
+class soa_vector;
+
+template<hera::soa_aggregate Agg>
+class soa_builder;
+
+/// the members of a row of a `soa_vector` as a bounded range of references
+template<typename Agg, bool Const>
+class soa_row : public view_interface<soa_row<Agg, Const>>
+{
+public:
+    static constexpr std::size_t fields = detail::aggregate_size_v<Agg>;
+
+private:
+    using owner_type =
+        std::conditional_t<Const, const soa_vector<Agg>, soa_vector<Agg>>;
+
+    owner_type* owner_;
+    std::size_t index_;
+
+public:
+    constexpr soa_row(owner_type& owner, std::size_t index) noexcept
+        : owner_{std::addressof(owner)}, index_{index}
+    {}
+
+    constexpr std::integral_constant<std::size_t, fields> size() const noexcept
+    {
+        return {};
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < fields)
+    constexpr auto& get() const noexcept // clang-format on
+    {
+        return owner_->template column<I>()[index_];
+    }
+
+    /// copies all members back into an `Agg`
+    Agg materialize() const
+    {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return Agg{get<Is>()...};
+        }
+        (std::make_index_sequence<fields>{});
+    }
+};
+
+/// the members of a sequence of aggregates stored column by column
+///
+/// Every member is kept in an array of its own, so a scan over a single
+/// member only touches the memory of that member. Rows are accessed through
+/// `soa_row` proxies and only rebuilt into an `Agg` on request. The number of
+/// rows is fixed once built by `soa_builder` or `to_soa`, the values can still
+/// be modified.
+template<hera::soa_aggregate Agg>
+class soa_vector
+{
+public:
+    using value_type      = Agg;
+    using reference       = soa_row<Agg, false>;
+    using const_reference = soa_row<Agg, true>;
+
+    static constexpr std::size_t fields = detail::aggregate_size_v<Agg>;
+
+    template<std::size_t I>
+    using member_type = detail::aggregate_member_t<Agg, I>;
+
+private:
+    friend class soa_builder<Agg>;
+
+    typename detail::soa_pointers<Agg>::type columns_{};
+    std::size_t                              size_     = 0;
+    std::size_t                              capacity_ = 0;
+
+    template<typename F>
+    void for_each_column(F&& fn)
+    {
+        [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            (fn(hera::get<Is>(columns_)), ...);
+        }
+        (std::make_index_sequence<fields>{});
+    }
+
+    void release() noexcept
+    {
+        for_each_column([&]<typename T>(T*& column) {
+            std::destroy_n(column, size_);
+            std::allocator<T>{}.deallocate(column, capacity_);
+            column = nullptr;
+        });
+
+        size_     = 0;
+        capacity_ = 0;
+    }
+
+    /// columns which are released with the `rows` rows of the `filled` ones
+    /// unless they are handed over
+    struct column_buffer
+    {
+        typename detail::soa_pointers<Agg>::type columns{};
+        std::size_t                              capacity = 0;
+        std::size_t                              rows     = 0;
+        std::array<bool, fields>                 filled{};
+
+        ~column_buffer()
+        {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>)
+            {
+                (release<Is>(), ...);
+            }
+            (std::make_index_sequence<fields>{});
+        }
+
+        template<std::size_t I>
+        void release() noexcept
+        {
+            auto*& column = hera::get<I>(columns);
+            if (column == nullptr)
+            {
+                return;
+            }
+
+            if (filled[I])
+            {
+                std::destroy_n(column, rows);
+            }
+            std::allocator<member_type<I>>{}.deallocate(column, capacity);
+        }
+    };
+
+    /// like `std::vector`, rows are only moved if that can't throw
+    template<std::size_t I>
+    void transfer(column_buffer& to)
+    {
+        using T = member_type<I>;
+
+        if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                      !std::is_copy_constructible_v<T>)
+        {
+            std::uninitialized_move_n(
+                hera::get<I>(columns_), size_, hera::get<I>(to.columns));
+        }
+        else
+        {
+            std::uninitialized_copy_n(
+                hera::get<I>(columns_), size_, hera::get<I>(to.columns));
+        }
+
+        to.filled[I] = true;
+    }
+
+    /// all columns are allocated and filled before any of them is replaced,
+    /// the ones whose transfer may throw first, so the vector is unchanged
+    /// if that happens
+    void reserve(std::size_t capacity)
+    {
+        if (capacity <= capacity_)
+        {
+            return;
+        }
+
+        column_buffer fresh{.capacity = capacity, .rows = size_};
+
+        [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            ((hera::get<Is>(fresh.columns) =
+                  std::allocator<member_type<Is>>{}.allocate(capacity)),
+             ...);
+
+            ((std::is_nothrow_move_constructible_v<member_type<Is>>
+                  ? void()
+                  : transfer<Is>(fresh)),
+             ...);
+            ((std::is_nothrow_move_constructible_v<member_type<Is>>
+                  ? transfer<Is>(fresh)
+                  : void()),
+             ...);
+        }
+        (std::make_index_sequence<fields>{});
+
+        // the old columns are released with `fresh`
+        std::swap(columns_, fresh.columns);
+        fresh.capacity = std::exchange(capacity_, capacity);
+    }
+
+    template<typename Row>
+    void push_back(Row&& row)
+    {
+        if (size_ == capacity_)
+        {
+            reserve(capacity_ < 8 ? 8 : capacity_ * 2);
+        }
+
+        // destroys the members of the new row constructed so far if a later
+        // one throws
+        struct partial_row
+        {
+            soa_vector& owner;
+            std::size_t constructed = 0;
+
+            ~partial_row()
+            {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>)
+                {
+                    ((Is < constructed
+                          ? std::destroy_at(hera::get<Is>(owner.columns_) +
+                                            owner.size_)
+                          : void()),
+                     ...);
+                }
+                (std::make_index_sequence<fields>{});
+            }
+        } partial{*this};
+
+        [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            ((std::construct_at(
+                  hera::get<Is>(columns_) + size_,
+                  static_cast<std::conditional_t<std::is_lvalue_reference_v<Row>,
+                                                 const member_type<Is>&,
+                                                 member_type<Is>&&>>(
+                      detail::aggregate_get<Is>(row))),
+              ++partial.constructed),
+             ...);
+        }
+        (std::make_index_sequence<fields>{});
+
+        partial.constructed = 0;
+        ++size_;
+    }
+
+public:
+    soa_vector() = default;
+
+    soa_vector(soa_vector&& other) noexcept
+        : columns_{std::exchange(other.columns_, {})},
+          size_{std::exchange(other.size_, 0)},
+          capacity_{std::exchange(other.capacity_, 0)}
+    {}
+
+    soa_vector& operator=(soa_vector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            columns_  = std::exchange(other.columns_, {});
+            size_     = std::exchange(other.size_, 0);
+            capacity_ = std::exchange(other.capacity_, 0);
+        }
+
+        return *this;
+    }
+
+    ~soa_vector()
+    {
+        release();
+    }
+
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    /// all values of the `I`th member
+    template<std::size_t I> // clang-format off
+        requires (I < fields)
+    std::span<member_type<I>> column() noexcept // clang-format on
+    {
+        return {hera::get<I>(columns_), size_};
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < fields)
+    std::span<const member_type<I>> column() const noexcept // clang-format on
+    {
+        return {hera::get<I>(columns_), size_};
+    }
+
+    reference operator[](std::size_t index) noexcept
+    {
+        return {*this, index};
+    }
+
+    const_reference operator[](std::size_t index) const noexcept
+    {
+        return {*this, index};
+    }
+
+    /// copies the rows back into aggregates
+    std::vector<Agg> to_aos() const
+    {
+        std::vector<Agg> res;
+        res.reserve(size_);
+
+        for (std::size_t i = 0; i != size_; ++i)
+        {
+            res.push_back((*this)[i].materialize());
+        }
+
+        return res;
+    }
+
+    template<bool Const>
+    class basic_iterator
+    {
+    private:
+        using owner_type =
+            std::conditional_t<Const, const soa_vector, soa_vector>;
+
+        owner_type* owner_ = nullptr;
+        std::size_t index_ = 0;
+
+    public:
+        using iterator_concept  = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = soa_row<Agg, Const>;
+        using difference_type   = std::ptrdiff_t;
+
+        basic_iterator() = default;
+
+        constexpr basic_iterator(owner_type& owner, std::size_t index) noexcept
+            : owner_{std::addressof(owner)}, index_{index}
+        {}
+
+        constexpr value_type operator*() const noexcept
+        {
+            return {*owner_, index_};
+        }
+
+        constexpr value_type operator[](difference_type n) const noexcept
+        {
+            return {*owner_, index_ + static_cast<std::size_t>(n)};
+        }
+
+        constexpr basic_iterator& operator++() noexcept
+        {
+            ++index_;
+            return *this;
+        }
+
+        constexpr basic_iterator operator++(int) noexcept
+        {
+            auto res = *this;
+            ++*this;
+            return res;
+        }
+
+        constexpr basic_iterator& operator--() noexcept
+        {
+            --index_;
+            return *this;
+        }
+
+        constexpr basic_iterator operator--(int) noexcept
+        {
+            auto res = *this;
+            --*this;
+            return res;
+        }
+
+        constexpr basic_iterator& operator+=(difference_type n) noexcept
+        {
+            index_ += static_cast<std::size_t>(n);
+            return *this;
+        }
+
+        constexpr basic_iterator& operator-=(difference_type n) noexcept
+        {
+            index_ -= static_cast<std::size_t>(n);
+            return *this;
+        }
+
+        friend constexpr basic_iterator operator+(basic_iterator  it,
+                                                  difference_type n) noexcept
+        {
+            return it += n;
+        }
+
+        friend constexpr basic_iterator operator+(difference_type n,
+                                                  basic_iterator  it) noexcept
+        {
+            return it += n;
+        }
+
+        friend constexpr basic_iterator operator-(basic_iterator  it,
+                                                  difference_type n) noexcept
+        {
+            return it -= n;
+        }
+
+        friend constexpr difference_type operator-(basic_iterator lhs,
+                                                   basic_iterator rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs.index_) -
+                   static_cast<difference_type>(rhs.index_);
+        }
+
+        friend constexpr bool operator==(basic_iterator lhs,
+                                         basic_iterator rhs) noexcept
+        {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend constexpr auto operator<=>(basic_iterator lhs,
+                                          basic_iterator rhs) noexcept
+        {
+            return lhs.index_ <=> rhs.index_;
+        }
+    };
+
+    using iterator       = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    iterator begin() noexcept
+    {
+        return {*this, 0};
+    }
+
+    iterator end() noexcept
+    {
+        return {*this, size_};
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return {*this, 0};
+    }
+
+    const_iterator end() const noexcept
+    {
+        return {*this, size_};
+    }
+};
+
+/// appends aggregates to the columns of a `soa_vector`
+template<hera::soa_aggregate Agg>
+class soa_builder
+{
+private:
+    soa_vector<Agg> result_;
+
+public:
+    /// preallocates every column for `rows` rows
+    void reserve(std::size_t rows)
+    {
+        result_.reserve(rows);
+    }
+
+    std::size_t size() const noexcept
+    {
+        return result_.size();
+    }
+
+    void push_back(const Agg& row)
+    {
+        result_.push_back(row);
+    }
+
+    /// moves the members of `row` into the columns
+    void push_back(Agg&& row)
+    {
+        result_.push_back(std::move(row));
+    }
+
+    soa_vector<Agg> build() &&
+    {
+        return std::move(result_);
+    }
+};
+
+/// splits a range of aggregates into columns, members are moved out of
+/// containers passed as rvalues
+template<std::ranges::input_range R> // clang-format off
+    requires hera::soa_aggregate<std::ranges::range_value_t<R>>
+auto to_soa(R&& rows) // clang-format on
+{
+    using aggregate_type = std::ranges::range_value_t<R>;
+
+    soa_builder<aggregate_type> builder;
+
+    if constexpr (std::ranges::sized_range<R>)
+    {
+        builder.reserve(std::ranges::size(rows));
+    }
+
+    for (auto&& row : rows)
+    {
+        if constexpr (std::is_lvalue_reference_v<R> ||
+                      std::ranges::view<std::remove_cvref_t<R>>)
+        {
+            builder.push_back(row);
+        }
+        else
+        {
+            builder.push_back(std::move(row));
+        }
+    }
+
+    return std::move(builder).build();
+}
+} // namespace hera
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "hera/container/pair.hpp"
+#include "hera/container/string.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/container/type_list.hpp"
+#include "hera/nth_element.hpp"
+#include "hera/type_in_pack.hpp"
+#include "hera/utility/detail/perfect_hash.hpp"
+
+namespace hera
+{
+template<typename Keys, typename... Vs>
+class static_map;
+
+namespace detail
+{
+template<bool Homogeneous, typename... Vs>
+struct static_map_storage
+{
+    using type = hera::tuple<Vs...>;
+};
+
+template<typename V, typename... Vs>
+struct static_map_storage<true, V, Vs...>
+{
+    using type = std::array<V, 1 + sizeof...(Vs)>;
+};
+} // namespace detail
+
+/// maps a fixed set of compile time strings onto values
+///
+/// The keys are hashed perfectly at compile time, a runtime lookup hashes the
+/// queried string once, compares it against the single candidate key and
+/// dispatches on its index.
+template<hera::constant_string... Ks, typename... Vs> // clang-format off
+    requires (sizeof...(Ks) == sizeof...(Vs))
+class static_map<hera::type_list<Ks...>, Vs...> // clang-format on
+{
+public:
+    static constexpr std::size_t npos = sizeof...(Ks);
+
+private:
+    static constexpr std::array<std::string_view, sizeof...(Ks)> keys_{
+        static_cast<std::string_view>(Ks{})...};
+
+    static_assert(!detail::has_duplicate_keys(keys_),
+                  "the keys of a static_map must be distinct");
+
+    static constexpr auto hash_ = detail::make_perfect_hash(keys_);
+
+    static constexpr bool homogeneous_ =
+        sizeof...(Vs) != 0 && (hera::same_as<nth_element_t<0, Vs...>, Vs> && ...);
+
+    using storage_type_ =
+        typename detail::static_map_storage<homogeneous_, Vs...>::type;
+
+    [[no_unique_address]] storage_type_ values_;
+
+public:
+    static_map() = default;
+
+    constexpr static_map(hera::pair<Ks, Vs>... entries)
+        : values_{std::move(entries.second)...}
+    {}
+
+    constexpr std::integral_constant<std::size_t, sizeof...(Ks)> size() const
+        noexcept
+    {
+        return {};
+    }
+
+    constexpr std::bool_constant<sizeof...(Ks) == 0> empty() const noexcept
+    {
+        return {};
+    }
+
+    static constexpr const std::array<std::string_view, sizeof...(Ks)>&
+    keys() noexcept
+    {
+        return keys_;
+    }
+
+    /// index of `key` in declaration order or npos
+    static constexpr std::size_t index_of(std::string_view key) noexcept
+    {
+        if constexpr (sizeof...(Ks) == 0)
+        {
+            return npos;
+        }
+        else
+        {
+            const auto index = hash_.candidate(key);
+
+            if (index != npos && keys_[index] == key)
+            {
+                return index;
+            }
+
+            return npos;
+        }
+    }
+
+    static constexpr bool contains(std::string_view key) noexcept
+    {
+        return index_of(key) != npos;
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Vs))
+    constexpr decltype(auto) get() & noexcept // clang-format on
+    {
+        return (hera::get<I>(values_));
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Vs))
+    constexpr decltype(auto) get() const & noexcept // clang-format on
+    {
+        return (hera::get<I>(values_));
+    }
+
+    /// lookup resolved at compile time
+    template<hera::constant_string K> // clang-format off
+        requires hera::type_in_pack_unique<K, Ks...>
+    constexpr decltype(auto) operator[](K) noexcept // clang-format on
+    {
+        return get<hera::type_in_pack_index_v<K, Ks...>>();
+    }
+
+    template<hera::constant_string K> // clang-format off
+        requires hera::type_in_pack_unique<K, Ks...>
+    constexpr decltype(auto) operator[](K) const noexcept // clang-format on
+    {
+        return get<hera::type_in_pack_index_v<K, Ks...>>();
+    }
+
+    /// pointer to the value stored for `key` or nullptr, requires all values
+    /// to share the same type
+    constexpr auto find(std::string_view key) noexcept requires homogeneous_
+    {
+        const auto index = index_of(key);
+        return index != npos ? values_.data() + index : nullptr;
+    }
+
+    constexpr auto find(std::string_view key) const noexcept
+        requires homogeneous_
+    {
+        const auto index = index_of(key);
+        return index != npos ? values_.data() + index : nullptr;
+    }
+
+private:
+    template<typename Self, typename F, std::size_t... Is>
+    static constexpr decltype(auto)
+    dispatch(Self& self, std::size_t index, F& fn, std::index_sequence<Is...>)
+    {
+        using result_type = std::common_type_t<
+            std::invoke_result_t<F&, decltype(self.template get<Is>())>...>;
+        using fn_ptr = result_type (*)(Self&, F&);
+
+        constexpr fn_ptr table[]{+[](Self& s, F& f) -> result_type {
+            return std::invoke(f, s.template get<Is>());
+        }...};
+
+        return table[index](self, fn);
+    }
+
+    template<typename Self, typename F>
+    static constexpr auto visit_impl(Self& self, std::string_view key, F& fn)
+    {
+        using indices = std::index_sequence_for<Vs...>;
+        using result_type =
+            decltype(dispatch(self, std::size_t{}, fn, indices{}));
+
+        const auto index = index_of(key);
+
+        if constexpr (std::is_void_v<result_type>)
+        {
+            if (index == npos)
+            {
+                return false;
+            }
+
+            dispatch(self, index, fn, indices{});
+            return true;
+        }
+        else
+        {
+            if (index == npos)
+            {
+                return std::optional<result_type>{};
+            }
+
+            return std::optional<result_type>{
+                dispatch(self, index, fn, indices{})};
+        }
+    }
+
+public:
+    /// invokes `fn` with the value stored for `key` through a jump table.
+    ///
+    /// Returns whether `key` was found, or an optional holding the common
+    /// result of `fn` if it returns a value.
+    template<typename F> // clang-format off
+        requires (hera::invocable<F&, Vs&> && ...) && (sizeof...(Vs) != 0)
+    constexpr auto visit(std::string_view key, F fn) // clang-format on
+    {
+        return visit_impl(*this, key, fn);
+    }
+
+    template<typename F> // clang-format off
+        requires (hera::invocable<F&, const Vs&> && ...) && (sizeof...(Vs) != 0)
+    constexpr auto visit(std::string_view key, F fn) const // clang-format on
+    {
+        return visit_impl(*this, key, fn);
+    }
+};
+
+template<typename... Ks, typename... Vs>
+static_map(hera::pair<Ks, Vs>...)
+    -> static_map<hera::type_list<Ks...>, Vs...>;
+
+template<typename... Ks, typename... Vs>
+constexpr auto make_static_map(hera::pair<Ks, Vs>... entries)
+{
+    return hera::static_map<hera::type_list<Ks...>, Vs...>{
+        std::move(entries)...};
+}
+} // namespace hera
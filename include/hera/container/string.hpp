@@ -1,6 +1,7 @@
 #pragma once
 
 #include <iterator>
+#include <limits>
 
 #include "hera/algorithm/accumulate.hpp"
 #include "hera/algorithm/unpack.hpp"
@@ -207,22 +208,13 @@ public:
         constexpr auto strv = static_cast<std::basic_string_view<value_type>>(
             hera::basic_string<value_type, Chs...>{});
 
-        constexpr auto seq = hera::make_index_sequence<strv.size()>{};
-
-        return hera::accumulate(
-            seq, hera::basic_string<value_type>{}, [&](auto str, auto index) {
-                constexpr auto index_const = decltype(index)::value;
+        constexpr auto seq = hera::make_index_sequence<strv.size() - 1>{};
 
-                if constexpr (index_const != I)
-                {
-                    return str.template push_back<(
-                        decltype(get<index_const>())::value)>();
-                }
-                else
-                {
-                    return str;
-                }
-            });
+        return hera::unpack(seq, [&](auto... is) {
+            return hera::basic_string<
+                value_type,
+                strv[decltype(is)::value + (decltype(is)::value >= I)]...>{};
+        });
     }
 };
 
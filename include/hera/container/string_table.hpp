@@ -0,0 +1,211 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#include "hera/container/string.hpp"
+#include "hera/utility/detail/perfect_hash.hpp"
+
+namespace hera
+{
+namespace detail
+{
+template<std::size_t N>
+struct string_table_layout
+{
+    std::array<std::uint32_t, N> offset{};
+    std::array<std::uint32_t, N> length{};
+    std::size_t                  size = 0;
+};
+
+/// places every string in one buffer, strings which are the suffix of an
+/// already placed string share its characters so that every entry stays null
+/// terminated
+template<std::size_t N>
+constexpr string_table_layout<N>
+make_string_table_layout(const std::array<std::string_view, N>& strings) noexcept
+{
+    string_table_layout<N> layout{};
+
+    // longer strings first, each one can only end in a longer or equal one
+    std::array<std::size_t, N> order{};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        std::size_t pos = i;
+        while (pos > 0 && strings[order[pos - 1]].size() < strings[i].size())
+        {
+            order[pos] = order[pos - 1];
+            --pos;
+        }
+        order[pos] = i;
+    }
+
+    std::array<std::size_t, N> placed{};
+    std::size_t                count = 0;
+
+    for (auto index : order)
+    {
+        const auto str = strings[index];
+        layout.length[index] = static_cast<std::uint32_t>(str.size());
+
+        bool shared = false;
+        for (std::size_t i = 0; i < count && !shared; ++i)
+        {
+            const auto other = strings[placed[i]];
+
+            if (other.ends_with(str))
+            {
+                layout.offset[index] = static_cast<std::uint32_t>(
+                    layout.offset[placed[i]] + other.size() - str.size());
+                shared = true;
+            }
+        }
+
+        if (!shared)
+        {
+            layout.offset[index] = static_cast<std::uint32_t>(layout.size);
+            layout.size += str.size() + 1;
+            placed[count++] = index;
+        }
+    }
+
+    // an empty table still holds the terminator of the empty string
+    if (layout.size == 0)
+    {
+        layout.size = 1;
+    }
+
+    return layout;
+}
+
+template<std::size_t Size, std::size_t N>
+constexpr std::array<char, Size>
+make_string_table_blob(const std::array<std::string_view, N>& strings,
+                       const string_table_layout<N>&          layout) noexcept
+{
+    std::array<char, Size> blob{};
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        for (std::size_t c = 0; c < strings[i].size(); ++c)
+        {
+            blob[layout.offset[i] + c] = strings[i][c];
+        }
+    }
+
+    return blob;
+}
+} // namespace detail
+
+/// interns a fixed set of compile time strings in a single buffer
+///
+/// All strings live in one contiguous, null terminated block of characters in
+/// which strings that end another one share its storage. Ids are the indices
+/// in declaration order, turning an id into a string is an array lookup and
+/// the reverse goes through a perfect hash computed at compile time.
+template<auto... Strings> // clang-format off
+    requires (hera::constant_string<std::remove_cvref_t<decltype(Strings)>> && ...)
+class string_table // clang-format on
+{
+public:
+    static constexpr std::size_t npos = sizeof...(Strings);
+
+private:
+    static constexpr std::array<std::string_view, sizeof...(Strings)> strings_{
+        static_cast<std::string_view>(Strings)...};
+
+    static_assert(!detail::has_duplicate_keys(strings_),
+                  "the strings of a string_table must be distinct");
+
+    static constexpr auto layout_ = detail::make_string_table_layout(strings_);
+
+    static constexpr auto blob_ =
+        detail::make_string_table_blob<layout_.size>(strings_, layout_);
+
+    static constexpr auto hash_ = detail::make_perfect_hash(strings_);
+
+public:
+    constexpr std::integral_constant<std::size_t, sizeof...(Strings)> size() const
+        noexcept
+    {
+        return {};
+    }
+
+    constexpr std::bool_constant<sizeof...(Strings) == 0> empty() const noexcept
+    {
+        return {};
+    }
+
+    /// all characters of the table including the terminators
+    static constexpr std::string_view blob() noexcept
+    {
+        return std::string_view(blob_.data(), blob_.size());
+    }
+
+    /// the string with the given id
+    static constexpr std::string_view view(std::size_t id) noexcept
+    {
+        return std::string_view(blob_.data() + layout_.offset[id],
+                                layout_.length[id]);
+    }
+
+    static constexpr const char* c_str(std::size_t id) noexcept
+    {
+        return blob_.data() + layout_.offset[id];
+    }
+
+    constexpr std::string_view operator[](std::size_t id) const noexcept
+    {
+        return view(id);
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Strings))
+    static constexpr std::string_view get() noexcept // clang-format on
+    {
+        return view(I);
+    }
+
+    /// id of `str` or npos
+    static constexpr std::size_t id_of(std::string_view str) noexcept
+    {
+        if constexpr (sizeof...(Strings) == 0)
+        {
+            return npos;
+        }
+        else
+        {
+            const auto id = hash_.candidate(str);
+
+            if (id != npos && view(id) == str)
+            {
+                return id;
+            }
+
+            return npos;
+        }
+    }
+
+    /// id resolved at compile time
+    template<hera::constant_string S> // clang-format off
+        requires (hera::same_as<S, std::remove_cvref_t<decltype(Strings)>> || ...)
+    static constexpr std::size_t id_of(S) noexcept // clang-format on
+    {
+        constexpr auto id = id_of(static_cast<std::string_view>(S{}));
+        return id;
+    }
+
+    static constexpr bool contains(std::string_view str) noexcept
+    {
+        return id_of(str) != npos;
+    }
+};
+
+template<hera::constant_string... Ss>
+constexpr hera::string_table<Ss{}...> make_string_table(Ss...) noexcept
+{
+    return {};
+}
+} // namespace hera
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <array>
 #include <utility>
 
 #include "hera/algorithm/unpack.hpp"
+#include "hera/compare.hpp"
 #include "hera/concepts.hpp"
 #include "hera/optional.hpp"
 #include "hera/ranges.hpp"
@@ -13,6 +15,15 @@ namespace hera
 {
 namespace detail
 {
+/// selects the constructor of `tuple` which initializes every element with
+/// the result of calling the matching argument
+struct tuple_construct_t
+{
+    explicit tuple_construct_t() = default;
+};
+
+inline constexpr tuple_construct_t tuple_construct{};
+
 template<std::size_t, typename T>
 struct tuple_box
 {
@@ -35,6 +46,14 @@ public:
             (std::is_nothrow_constructible_v<Ts, Us> && ...))
         : tuple_box<Is, Ts>{.value = Ts(std::forward<Us>(us))}...
     {}
+
+    /// the elements are the prvalues returned by `fs`, so they are
+    /// constructed in place without being moved
+    template<typename... Fs> // clang-format off
+        requires (sizeof...(Ts) == sizeof...(Fs))
+    constexpr tuple_impl(tuple_construct_t, Fs&&... fs) // clang-format on
+        : tuple_box<Is, Ts>{.value = std::forward<Fs>(fs)()}...
+    {}
 };
 } // namespace detail
 
@@ -151,12 +170,19 @@ public:
 
     // push_back & emplace_back variants
 
+    // the new element is constructed in place, the others are copied or
+    // moved once, see `hera::tuple_builder` for building tuples one element
+    // at a time
+
     template<typename T, typename... Args>
     [[nodiscard]] constexpr hera::tuple<Ts..., T>
     emplace_back(Args&&... args) const&
     {
         return hera::unpack(*this, [&](const Ts&... xs) {
-            return hera::tuple<Ts..., T>{xs..., T(std::forward<Args>(args)...)};
+            return hera::tuple<Ts..., T>{
+                detail::tuple_construct,
+                [&]() -> Ts { return Ts(xs); }...,
+                [&]() -> T { return T(std::forward<Args>(args)...); }};
         });
     }
 
@@ -165,8 +191,10 @@ public:
     emplace_back(Args&&... args) &&
     {
         return hera::unpack(std::move(*this), [&](Ts&&... xs) {
-            return hera::tuple<Ts..., T>{std::forward<Ts>(xs)...,
-                                         T(std::forward<Args>(args)...)};
+            return hera::tuple<Ts..., T>{
+                detail::tuple_construct,
+                [&]() -> Ts { return Ts(std::forward<Ts>(xs)); }...,
+                [&]() -> T { return T(std::forward<Args>(args)...); }};
         });
     }
 
@@ -201,7 +229,10 @@ public:
     emplace_front(Args&&... args) const&
     {
         return hera::unpack(*this, [&](const Ts&... xs) {
-            return hera::tuple<T, Ts...>{T(std::forward<Args>(args)...), xs...};
+            return hera::tuple<T, Ts...>{
+                detail::tuple_construct,
+                [&]() -> T { return T(std::forward<Args>(args)...); },
+                [&]() -> Ts { return Ts(xs); }...};
         });
     }
 
@@ -210,8 +241,10 @@ public:
     emplace_front(Args&&... args) &&
     {
         return hera::unpack(std::move(*this), [&](Ts&&... xs) {
-            return hera::tuple<T, Ts...>{T(std::forward<Args>(args)...),
-                                         std::forward<Ts>(xs)...};
+            return hera::tuple<T, Ts...>{
+                detail::tuple_construct,
+                [&]() -> T { return T(std::forward<Args>(args)...); },
+                [&]() -> Ts { return Ts(std::forward<Ts>(xs)); }...};
         });
     }
 
@@ -318,6 +351,28 @@ public:
 template<typename... Ts>
 tuple(Ts&&...) -> tuple<std::decay_t<Ts>...>;
 
+/// elementwise equality, see `hera::equal`
+template<typename... Ts, typename... Us> // clang-format off
+    requires std::invocable<const equal_fn&,
+                            const hera::tuple<Ts...>&,
+                            const hera::tuple<Us...>&>
+constexpr bool operator==(const hera::tuple<Ts...>& lhs,
+                          const hera::tuple<Us...>& rhs) // clang-format on
+{
+    return hera::equal(lhs, rhs);
+}
+
+/// lexicographic order, see `hera::compare`
+template<typename... Ts, typename... Us> // clang-format off
+    requires std::invocable<const compare_fn&,
+                            const hera::tuple<Ts...>&,
+                            const hera::tuple<Us...>&>
+constexpr auto operator<=>(const hera::tuple<Ts...>& lhs,
+                           const hera::tuple<Us...>& rhs) // clang-format on
+{
+    return hera::compare(lhs, rhs);
+}
+
 template<typename... Ts,
          typename... Us,
          template<typename>
@@ -348,6 +403,91 @@ constexpr hera::tuple<std::decay_t<Ts>...> make_tuple(Ts&&... ts) noexcept(
     return hera::tuple<std::decay_t<Ts>...>{static_cast<Ts&&>(ts)...};
 }
 
+namespace detail
+{
+/// the range and the position in it of every element of the concatenation
+/// of ranges of `Sizes` elements
+template<std::size_t... Sizes>
+struct tuple_cat_indices
+{
+    static constexpr std::size_t size = (Sizes + ... + 0);
+
+    static constexpr std::array<std::size_t, sizeof...(Sizes)> sizes{Sizes...};
+
+    static constexpr auto outer = [] {
+        std::array<std::size_t, size> res{};
+
+        std::size_t i = 0;
+        for (std::size_t range = 0; range != sizes.size(); ++range)
+        {
+            for (std::size_t j = 0; j != sizes[range]; ++j)
+            {
+                res[i++] = range;
+            }
+        }
+
+        return res;
+    }();
+
+    static constexpr auto inner = [] {
+        std::array<std::size_t, size> res{};
+
+        std::size_t i = 0;
+        for (std::size_t range = 0; range != sizes.size(); ++range)
+        {
+            for (std::size_t j = 0; j != sizes[range]; ++j)
+            {
+                res[i++] = j;
+            }
+        }
+
+        return res;
+    }();
+};
+
+/// the type of element `I` of `R` in a concatenation, the element types of
+/// tuples are kept as they are, other elements are copied
+template<typename R, std::size_t I>
+struct tuple_cat_element
+{
+    using type =
+        std::remove_cvref_t<decltype(hera::get<I>(std::declval<R&>()))>;
+};
+
+template<typename... Ts, std::size_t I>
+struct tuple_cat_element<hera::tuple<Ts...>, I>
+{
+    using type = std::tuple_element_t<I, std::tuple<Ts...>>;
+};
+
+template<typename R, std::size_t I>
+using tuple_cat_element_t =
+    typename tuple_cat_element<std::remove_cvref_t<R>, I>::type;
+} // namespace detail
+
+/// a `hera::tuple` of the elements of all of `ranges` in order
+///
+/// The range and position of every element are looked up in tables built at
+/// compile time, so the result is constructed at once and every element is
+/// copied or, from rvalue ranges, moved exactly once.
+template<typename... Rs> // clang-format off
+    requires (hera::bounded_range<Rs> && ...)
+constexpr auto tuple_cat(Rs&&... ranges) // clang-format on
+{
+    using indices = detail::tuple_cat_indices<hera::size_v<Rs>...>;
+
+    hera::tuple<Rs&&...> refs{static_cast<Rs&&>(ranges)...};
+
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+    {
+        return hera::tuple<detail::tuple_cat_element_t<
+            std::tuple_element_t<indices::outer[Is], std::tuple<Rs...>>,
+            indices::inner[Is]>...>{hera::get<indices::inner[Is]>(
+            hera::get<indices::outer[Is]>(std::move(refs)))...};
+    }
+    (std::make_index_sequence<indices::size>{});
+}
+
 template<typename T, typename... Ts> // clang-format off
     requires (std::is_object_v<T>) && hera::constructible_from<T, Ts&...>
 constexpr T make_from_tuple(hera::tuple<Ts...>& tup) // clang-format on
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "hera/algorithm/unpack.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/get.hpp"
+#include "hera/ranges.hpp"
+#include "hera/size.hpp"
+
+namespace hera
+{
+namespace detail
+{
+/// an element of type `T` which is constructed from `args` once the tuple
+/// is built
+template<typename T, typename... Args>
+struct tuple_pending
+{
+    using type = T;
+
+    hera::tuple<Args&&...> args;
+
+    constexpr T operator()() &&
+    {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)->T
+        {
+            return T(hera::get<Is>(std::move(args))...);
+        }
+        (std::index_sequence_for<Args...>{});
+    }
+};
+
+/// element `I` of `range`, read once the tuple is built
+template<typename T, std::size_t I, typename R>
+struct tuple_pending_element
+{
+    using type = T;
+
+    R&& range;
+
+    constexpr T operator()() &&
+    {
+        return T(hera::get<I>(static_cast<R&&>(range)));
+    }
+};
+} // namespace detail
+
+/// collects the elements of a `hera::tuple` and constructs it once
+///
+/// Every call only records where the new elements come from, `build`
+/// constructs all of them in place in the final tuple. The builder refers to
+/// the arguments of its calls, which have to outlive `build`, as they do when
+/// the whole chain is a single expression:
+///
+///     auto t = hera::tuple_builder{}
+///                  .push_back(id)
+///                  .emplace_back<std::string>(3, 'x')
+///                  .append(std::move(rest))
+///                  .build();
+template<typename... Pending>
+class tuple_builder
+{
+private:
+    template<typename...>
+    friend class tuple_builder;
+
+    hera::tuple<Pending...> pending_;
+
+    constexpr explicit tuple_builder(hera::tuple<Pending...>&& pending)
+        : pending_{std::move(pending)}
+    {}
+
+    template<typename R, std::size_t I>
+    using element_pending_t =
+        detail::tuple_pending_element<detail::tuple_cat_element_t<R, I>, I, R>;
+
+public:
+    constexpr tuple_builder() requires(sizeof...(Pending) == 0) = default;
+
+    /// adds a `T` constructed from `args` at the back
+    template<typename T, typename... Args>
+    [[nodiscard]] constexpr auto emplace_back(Args&&... args) &&
+    {
+        return hera::unpack(std::move(pending_), [&](Pending&&... ps) {
+            using pending_type = detail::tuple_pending<T, Args...>;
+
+            return tuple_builder<Pending..., pending_type>{
+                hera::tuple<Pending..., pending_type>{
+                    std::move(ps)...,
+                    pending_type{{std::forward<Args>(args)...}}}};
+        });
+    }
+
+    /// adds a `T` constructed from `args` at the front
+    template<typename T, typename... Args>
+    [[nodiscard]] constexpr auto emplace_front(Args&&... args) &&
+    {
+        return hera::unpack(std::move(pending_), [&](Pending&&... ps) {
+            using pending_type = detail::tuple_pending<T, Args...>;
+
+            return tuple_builder<pending_type, Pending...>{
+                hera::tuple<pending_type, Pending...>{
+                    pending_type{{std::forward<Args>(args)...}},
+                    std::move(ps)...}};
+        });
+    }
+
+    /// adds a copy of `value` at the back, moved from rvalues
+    template<typename T>
+    [[nodiscard]] constexpr auto push_back(T&& value) &&
+    {
+        return std::move(*this).template emplace_back<std::decay_t<T>>(
+            std::forward<T>(value));
+    }
+
+    /// adds a copy of `value` at the front, moved from rvalues
+    template<typename T>
+    [[nodiscard]] constexpr auto push_front(T&& value) &&
+    {
+        return std::move(*this).template emplace_front<std::decay_t<T>>(
+            std::forward<T>(value));
+    }
+
+    /// adds the elements of `range` at the back, like `hera::tuple_cat`
+    template<hera::bounded_range R>
+    [[nodiscard]] constexpr auto append(R&& range) &&
+    {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return hera::unpack(std::move(pending_), [&](Pending&&... ps) {
+                return tuple_builder<Pending..., element_pending_t<R, Is>...>{
+                    hera::tuple<Pending..., element_pending_t<R, Is>...>{
+                        std::move(ps)...,
+                        element_pending_t<R, Is>{static_cast<R&&>(range)}...}};
+            });
+        }
+        (std::make_index_sequence<hera::size_v<R>>{});
+    }
+
+    /// constructs the tuple, every element in place
+    [[nodiscard]] constexpr hera::tuple<typename Pending::type...> build() &&
+    {
+        return hera::unpack(std::move(pending_), [](Pending&&... ps) {
+            return hera::tuple<typename Pending::type...>{
+                detail::tuple_construct, std::move(ps)...};
+        });
+    }
+};
+} // namespace hera
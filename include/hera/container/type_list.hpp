@@ -2,13 +2,42 @@
 
 #include "hera/algorithm/unpack.hpp"
 #include "hera/metafunction.hpp"
+#include "hera/nth_element.hpp"
 #include "hera/optional.hpp"
 #include "hera/type.hpp"
+#include "hera/utility/detail/type_set.hpp"
 #include "hera/view/detail/closure.hpp"
 #include "hera/view/interface.hpp"
 
 namespace hera
 {
+template<typename... Ts>
+class type_list;
+
+namespace detail
+{
+template<auto Selection, typename... Ts, std::size_t... Is>
+constexpr auto select_type_list(hera::type_list<Ts...>,
+                                std::index_sequence<Is...>) noexcept
+{
+    return hera::type_list<
+        hera::nth_element_t<Selection.indices[Is], Ts...>...>{};
+}
+
+template<type_set_op Op, typename... Ts, typename... Us>
+constexpr auto apply_type_set_op(hera::type_list<Ts...> lhs,
+                                 hera::type_list<Us...>) noexcept
+{
+    using keys = detail::type_keys<Ts..., Us...>;
+
+    constexpr auto selection = detail::select_types<Op>(
+        keys::template of<Ts...>, keys::template of<Us...>);
+
+    return detail::select_type_list<selection>(
+        lhs, std::make_index_sequence<selection.count>{});
+}
+} // namespace detail
+
 template<typename... Ts>
 class type_list : public hera::view_interface<type_list<Ts...>>
 {
@@ -59,6 +88,42 @@ public:
 
         return hera::type_<type>{};
     }
+
+    // set operations, the results keep the order of the first occurrence of
+    // each type
+
+    template<typename U>
+    constexpr std::bool_constant<detail::type_keys_contain<U, Ts...>()>
+    contains(hera::type_<U>) const noexcept
+    {
+        return {};
+    }
+
+    constexpr auto unique() const noexcept
+    {
+        return detail::apply_type_set_op<detail::type_set_op::unique>(
+            *this, hera::type_list<>{});
+    }
+
+    template<typename... Us>
+    constexpr auto union_(hera::type_list<Us...>) const noexcept
+    {
+        return hera::type_list<Ts..., Us...>{}.unique();
+    }
+
+    template<typename... Us>
+    constexpr auto intersection(hera::type_list<Us...> other) const noexcept
+    {
+        return detail::apply_type_set_op<detail::type_set_op::intersection>(
+            *this, other);
+    }
+
+    template<typename... Us>
+    constexpr auto difference(hera::type_list<Us...> other) const noexcept
+    {
+        return detail::apply_type_set_op<detail::type_set_op::difference>(
+            *this, other);
+    }
 };
 
 template<hera::metafunction... Ms>
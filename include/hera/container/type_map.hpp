@@ -0,0 +1,158 @@
+#pragma once
+
+#include <utility>
+
+#include "hera/container/tuple.hpp"
+#include "hera/nth_element.hpp"
+#include "hera/type.hpp"
+#include "hera/type_in_pack.hpp"
+
+namespace hera
+{
+namespace detail
+{
+// deduce the index of the box holding T, the lookup is resolved by overload
+// resolution against the bases of tuple_impl and therefore doesn't recurse
+template<typename T, std::size_t I>
+constexpr tuple_box<I, T>& type_map_box(tuple_box<I, T>& box) noexcept
+{
+    return box;
+}
+
+template<typename T, std::size_t I>
+constexpr const tuple_box<I, T>&
+type_map_box(const tuple_box<I, T>& box) noexcept
+{
+    return box;
+}
+} // namespace detail
+
+/// a tuple whose elements are additionally addressable by their type
+///
+/// All types must be distinct, this is checked once when the map type is
+/// instantiated rather than on each access.
+template<typename... Ts> // clang-format off
+    requires hera::unique_types<Ts...>
+class type_map // clang-format on
+    : private detail::tuple_impl<std::index_sequence_for<Ts...>, Ts...>
+{
+private:
+    using base_type_ =
+        detail::tuple_impl<std::index_sequence_for<Ts...>, Ts...>;
+
+    using indexer_type_ = detail::indexer_for<Ts...>;
+
+public:
+    using base_type_::base_type_;
+
+    constexpr std::integral_constant<std::size_t, sizeof...(Ts)>
+    size() const noexcept
+    {
+        return {};
+    }
+
+    constexpr std::bool_constant<sizeof...(Ts) == 0> empty() const noexcept
+    {
+        return {};
+    }
+
+    template<typename T>
+    static constexpr std::bool_constant<
+        detail::uniquely_indexed_by<T, indexer_type_>>
+    contains(hera::type_<T> = {}) noexcept
+    {
+        return {};
+    }
+
+    template<typename T> // clang-format off
+        requires detail::uniquely_indexed_by<T, indexer_type_>
+    static constexpr auto index_of(hera::type_<T> = {}) noexcept // clang-format on
+    {
+        return detail::type_in_pack_index_of<T>(indexer_type_{});
+    }
+
+    // access by type
+
+    template<typename T> // clang-format off
+        requires detail::uniquely_indexed_by<T, indexer_type_>
+    constexpr T& get() & noexcept // clang-format on
+    {
+        return (detail::type_map_box<T>(*this).value);
+    }
+
+    template<typename T> // clang-format off
+        requires detail::uniquely_indexed_by<T, indexer_type_>
+    constexpr const T& get() const & noexcept // clang-format on
+    {
+        return (detail::type_map_box<T>(*this).value);
+    }
+
+    template<typename T> // clang-format off
+        requires detail::uniquely_indexed_by<T, indexer_type_>
+    constexpr T&& get() && noexcept // clang-format on
+    {
+        return static_cast<T&&>(detail::type_map_box<T>(*this).value);
+    }
+
+    template<typename T> // clang-format off
+        requires detail::uniquely_indexed_by<T, indexer_type_>
+    constexpr const T&& get() const && noexcept // clang-format on
+    {
+        return static_cast<const T&&>(detail::type_map_box<T>(*this).value);
+    }
+
+    // access by index, makes the map a bounded range
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Ts))
+    constexpr auto element_type() noexcept // clang-format on
+    {
+        return hera::type_<hera::nth_element_t<I, Ts...>>{};
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Ts))
+    constexpr auto element_type() const noexcept // clang-format on
+    {
+        return hera::type_<const hera::nth_element_t<I, Ts...>>{};
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Ts))
+    constexpr decltype(auto) get() & noexcept // clang-format on
+    {
+        return get<hera::nth_element_t<I, Ts...>>();
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Ts))
+    constexpr decltype(auto) get() const & noexcept // clang-format on
+    {
+        return get<hera::nth_element_t<I, Ts...>>();
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Ts))
+    constexpr decltype(auto) get() && noexcept // clang-format on
+    {
+        return std::move(*this).template get<hera::nth_element_t<I, Ts...>>();
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Ts))
+    constexpr decltype(auto) get() const && noexcept // clang-format on
+    {
+        return std::move(*this).template get<hera::nth_element_t<I, Ts...>>();
+    }
+};
+
+template<typename... Ts>
+type_map(Ts&&...) -> type_map<std::decay_t<Ts>...>;
+
+template<typename... Ts>
+constexpr hera::type_map<std::decay_t<Ts>...> make_type_map(Ts&&... ts) noexcept(
+    std::is_nothrow_constructible_v<hera::type_map<std::decay_t<Ts>...>, Ts...>)
+{
+    return hera::type_map<std::decay_t<Ts>...>{static_cast<Ts&&>(ts)...};
+}
+} // namespace hera
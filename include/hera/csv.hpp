@@ -0,0 +1,520 @@
+#pragma once
+
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "hera/container/integer_sequence.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/size.hpp"
+#include "hera/utility/detail/simd.hpp"
+
+namespace hera
+{
+struct csv_options
+{
+    /// separates the fields of a row, ',' for CSV and '\t' for TSV
+    char delimiter = ',';
+    /// the first line holds column names and is skipped
+    bool header = false;
+};
+
+namespace detail
+{
+template<typename T>
+struct csv_is_optional : std::false_type
+{};
+
+template<typename T>
+struct csv_is_optional<std::optional<T>> : std::true_type
+{};
+
+template<typename T>
+concept csv_value = // clang-format off
+    std::is_same_v<T, bool> ||
+    std::is_same_v<T, char> ||
+    std::is_integral_v<T> ||
+    std::is_floating_point_v<T> ||
+    std::is_same_v<T, std::string_view> ||
+    std::is_same_v<T, std::string>; // clang-format on
+
+/// a type a field can be parsed into, optional columns are empty for empty
+/// fields
+template<typename T>
+concept csv_column = // clang-format off
+    csv_value<T> ||
+    (csv_is_optional<T>::value && csv_value<typename T::value_type>); // clang-format on
+
+template<typename T>
+bool csv_parse_number(std::string_view field, T& out) noexcept
+{
+    const auto* last = field.data() + field.size();
+    const auto [ptr, ec] = std::from_chars(field.data(), last, out);
+
+    return ec == std::errc{} && ptr == last;
+}
+
+/// `field` is the content of the field without surrounding quotes,
+/// `quoted` tells whether there were any
+template<typename T>
+bool csv_parse(std::string_view field, bool quoted, T& out)
+{
+    if constexpr (csv_is_optional<T>::value)
+    {
+        if (field.empty() && !quoted)
+        {
+            out.reset();
+            return true;
+        }
+
+        return csv_parse(field, quoted, out.emplace());
+    }
+    else if constexpr (std::is_same_v<T, std::string_view>)
+    {
+        // escaped quotes stay doubled, views can't drop them
+        out = field;
+        return true;
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        out.assign(field);
+
+        if (quoted)
+        {
+            std::size_t pos = 0;
+            while ((pos = out.find("\"\"", pos)) != std::string::npos)
+            {
+                out.erase(pos, 1);
+                ++pos;
+            }
+        }
+
+        return true;
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+        if (field == "1" || field == "true")
+        {
+            out = true;
+            return true;
+        }
+        else if (field == "0" || field == "false")
+        {
+            out = false;
+            return true;
+        }
+
+        return false;
+    }
+    else if constexpr (std::is_same_v<T, char>)
+    {
+        if (field.size() != 1)
+        {
+            return false;
+        }
+
+        out = field.front();
+        return true;
+    }
+    else
+    {
+        // from_chars rejects the leading '+' which some writers emit
+        if (!field.empty() && field.front() == '+')
+        {
+            field.remove_prefix(1);
+        }
+
+        return csv_parse_number(field, out);
+    }
+}
+
+/// finds delimiters and newlines 64 bytes at a time
+///
+/// Positions are handed out in increasing order, every one at most once.
+class csv_scanner
+{
+private:
+    const char* data_;
+    std::size_t size_;
+    char        delimiter_;
+
+    // the block `mask_` was computed for, bits of handed out positions are
+    // cleared
+    std::size_t   block_     = 0;
+    std::size_t   block_end_ = 0;
+    std::uint64_t mask_      = 0;
+
+    void load(std::size_t pos) noexcept
+    {
+        block_     = pos;
+        block_end_ = pos + 64;
+
+        if (size_ - pos >= 64)
+        {
+            mask_ = detail::eq_mask64(data_ + pos, delimiter_, '\n');
+        }
+        else
+        {
+            mask_ = 0;
+            for (std::size_t i = 0; i != size_ - pos; ++i)
+            {
+                const char ch = data_[pos + i];
+                mask_ |= std::uint64_t{ch == delimiter_ || ch == '\n'} << i;
+            }
+        }
+    }
+
+public:
+    constexpr csv_scanner(std::string_view data, char delimiter) noexcept
+        : data_{data.data()}, size_{data.size()}, delimiter_{delimiter}
+    {}
+
+    /// position of the next delimiter or newline at or after `pos`, the size
+    /// of the input if there is none
+    std::size_t find(std::size_t pos) noexcept
+    {
+        while (true)
+        {
+            if (mask_ == 0)
+            {
+                const auto next = pos > block_end_ ? pos : block_end_;
+                if (next >= size_)
+                {
+                    return size_;
+                }
+
+                load(next);
+                continue;
+            }
+
+            const auto sep = block_ + std::countr_zero(mask_);
+            mask_ &= mask_ - 1;
+
+            if (sep >= pos)
+            {
+                return sep;
+            }
+        }
+    }
+};
+} // namespace detail
+
+template<typename Row,
+         typename Projection =
+             hera::make_index_sequence<hera::size_v<Row>>>
+class csv_reader;
+
+/// reads rows of delimited text into `hera::tuple<Ts...>`
+///
+/// Element `i` of a row is parsed from column `Is[i]`, like `reorder_view`
+/// columns can be picked in any order. Columns past the largest index aren't
+/// looked at, others which aren't projected are only skipped over. The parser
+/// of every column is chosen from its type, `std::string_view` columns refer
+/// into the input which has to outlive the rows.
+///
+/// Fields may be quoted to contain delimiters, newlines and doubled quotes.
+/// Rows which can't be parsed are skipped and counted.
+template<typename... Ts, std::size_t... Is> // clang-format off
+    requires (detail::csv_column<Ts> && ...) &&
+             (sizeof...(Ts) == sizeof...(Is))
+class csv_reader<hera::tuple<Ts...>, hera::index_sequence<Is...>> // clang-format on
+{
+public:
+    using row_type = hera::tuple<Ts...>;
+
+    /// number of leading columns every row needs
+    static constexpr std::size_t columns = [] {
+        std::size_t res = 0;
+        ((res = Is + 1 > res ? Is + 1 : res), ...);
+        return res;
+    }();
+
+private:
+    std::string_view    data_;
+    char                delimiter_;
+    detail::csv_scanner scanner_;
+    std::size_t         pos_     = 0;
+    std::size_t         skipped_ = 0;
+
+    /// the position after the closing quote of the quoted field at `pos`, or
+    /// nothing if the quote isn't closed
+    std::optional<std::size_t> skip_quoted(std::size_t pos) const noexcept
+    {
+        ++pos;
+
+        while (true)
+        {
+            const auto* quote = static_cast<const char*>(std::memchr(
+                data_.data() + pos, '"', data_.size() - pos));
+
+            if (quote == nullptr)
+            {
+                return std::nullopt;
+            }
+
+            pos = static_cast<std::size_t>(quote - data_.data()) + 1;
+
+            if (pos == data_.size() || data_[pos] != '"')
+            {
+                return pos;
+            }
+
+            ++pos;
+        }
+    }
+
+    /// moves `pos` past the separator following the field at `pos`, returns
+    /// the field and whether it ended the line
+    struct field_type
+    {
+        std::string_view value;
+        bool             quoted;
+        bool             last;
+        bool             valid;
+    };
+
+    field_type next_field(std::size_t& pos) noexcept
+    {
+        field_type res{{}, false, false, true};
+
+        std::size_t sep;
+        if (pos < data_.size() && data_[pos] == '"') [[unlikely]]
+        {
+            const auto end = skip_quoted(pos);
+            if (!end)
+            {
+                pos = data_.size();
+                return {{}, true, true, false};
+            }
+
+            res.value  = data_.substr(pos + 1, *end - pos - 2);
+            res.quoted = true;
+
+            sep = *end;
+            if (sep + 1 < data_.size() && data_[sep] == '\r' &&
+                data_[sep + 1] == '\n')
+            {
+                ++sep;
+            }
+
+            if (sep < data_.size() && data_[sep] != delimiter_ &&
+                data_[sep] != '\n')
+            {
+                // garbage after the closing quote
+                res.valid = false;
+                sep       = scanner_.find(sep);
+            }
+        }
+        else
+        {
+            sep       = scanner_.find(pos);
+            res.value = data_.substr(pos, sep - pos);
+        }
+
+        res.last = sep == data_.size() || data_[sep] == '\n';
+        if (res.last && !res.quoted && !res.value.empty() &&
+            res.value.back() == '\r')
+        {
+            res.value.remove_suffix(1);
+        }
+
+        pos = sep == data_.size() ? sep : sep + 1;
+        return res;
+    }
+
+    void skip_line(std::size_t& pos) noexcept
+    {
+        while (pos < data_.size())
+        {
+            if (data_[pos] == '"')
+            {
+                pos = skip_quoted(pos).value_or(data_.size());
+            }
+
+            const auto sep = scanner_.find(pos);
+            if (sep == data_.size())
+            {
+                pos = sep;
+                return;
+            }
+
+            pos = sep + 1;
+            if (data_[sep] == '\n')
+            {
+                return;
+            }
+        }
+    }
+
+    template<std::size_t C>
+    bool parse_field(row_type& row, const field_type& field)
+    {
+        return [&]<std::size_t... Js>(std::index_sequence<Js...>)
+        {
+            return ((Is != C || detail::csv_parse(field.value,
+                                                  field.quoted,
+                                                  hera::get<Js>(row))) &&
+                    ...);
+        }
+        (std::index_sequence_for<Ts...>{});
+    }
+
+    template<std::size_t C>
+    bool parse_column(row_type& row, std::size_t& pos, bool& last)
+    {
+        if (last)
+        {
+            // too few columns
+            return false;
+        }
+
+        const auto field = next_field(pos);
+        last             = field.last;
+
+        return field.valid && parse_field<C>(row, field);
+    }
+
+    template<std::size_t... Cs>
+    bool parse_row(row_type& row, std::index_sequence<Cs...>)
+    {
+        auto pos  = pos_;
+        bool last = false;
+
+        const bool ok = (parse_column<Cs>(row, pos, last) && ...);
+
+        if (!last)
+        {
+            skip_line(pos);
+        }
+
+        pos_ = pos;
+        return ok;
+    }
+
+public:
+    csv_reader(std::string_view data, csv_options options = {}) noexcept
+        : data_{data}, delimiter_{options.delimiter},
+          scanner_{data, options.delimiter}
+    {
+        if (options.header)
+        {
+            skip_line(pos_);
+        }
+    }
+
+    /// parses the next row into `row`, false once the input is exhausted
+    bool read(row_type& row)
+    {
+        while (pos_ < data_.size())
+        {
+            // empty lines don't count as rows
+            if (data_[pos_] == '\n')
+            {
+                ++pos_;
+                continue;
+            }
+
+            if (data_[pos_] == '\r' && pos_ + 1 < data_.size() &&
+                data_[pos_ + 1] == '\n')
+            {
+                pos_ += 2;
+                continue;
+            }
+
+            if (parse_row(row, std::make_index_sequence<columns>{}))
+            {
+                return true;
+            }
+
+            ++skipped_;
+        }
+
+        return false;
+    }
+
+    /// the next row or nothing once the input is exhausted
+    std::optional<row_type> read()
+    {
+        std::optional<row_type> res{std::in_place};
+
+        if (!read(*res))
+        {
+            res.reset();
+        }
+
+        return res;
+    }
+
+    /// number of rows skipped because they couldn't be parsed
+    std::size_t skipped() const noexcept
+    {
+        return skipped_;
+    }
+
+    /// offset of the next row in the input
+    std::size_t position() const noexcept
+    {
+        return pos_;
+    }
+
+    class iterator
+    {
+    private:
+        csv_reader* reader_ = nullptr;
+        row_type    row_{};
+        bool        done_ = true;
+
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type       = row_type;
+        using difference_type  = std::ptrdiff_t;
+
+        iterator() = default;
+
+        explicit iterator(csv_reader& reader) : reader_{&reader}
+        {
+            ++*this;
+        }
+
+        const row_type& operator*() const noexcept
+        {
+            return row_;
+        }
+
+        iterator& operator++()
+        {
+            done_ = !reader_->read(row_);
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        friend bool operator==(const iterator& it, std::default_sentinel_t)
+        {
+            return it.done_;
+        }
+    };
+
+    iterator begin()
+    {
+        return iterator{*this};
+    }
+
+    std::default_sentinel_t end() const noexcept
+    {
+        return {};
+    }
+};
+} // namespace hera
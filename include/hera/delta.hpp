@@ -0,0 +1,249 @@
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hera/compare.hpp"
+#include "hera/get.hpp"
+#include "hera/ranges.hpp"
+#include "hera/serialize.hpp"
+#include "hera/size.hpp"
+#include "hera/utility/detail/aggregate.hpp"
+
+namespace hera
+{
+namespace detail
+{
+/// the smallest unsigned integer with a bit for each of `N` fields
+template<std::size_t N>
+using delta_mask_t = std::conditional_t<
+    (N <= 8),
+    std::uint8_t,
+    std::conditional_t<
+        (N <= 16),
+        std::uint16_t,
+        std::conditional_t<(N <= 32), std::uint32_t, std::uint64_t>>>;
+
+/// fields which changed when their bytes did, floats included so a record
+/// holding NaN doesn't differ from itself
+template<typename T>
+inline constexpr bool delta_bytes_v =
+    bytes_equal<T>::value || std::is_same_v<T, float> ||
+    std::is_same_v<T, double>;
+
+template<typename T>
+concept delta_field = // clang-format off
+    serializable<T> &&
+    deserializable<T> &&
+    (delta_bytes_v<T> || std::equality_comparable<T>); // clang-format on
+
+template<typename R, typename = std::make_index_sequence<hera::size_v<R>>>
+inline constexpr bool delta_record_v = false;
+
+template<typename R, std::size_t... Is> // clang-format off
+    requires (sizeof...(Is) != 0) && (sizeof...(Is) <= 64)
+inline constexpr bool delta_record_v<R, std::index_sequence<Is...>> = // clang-format on
+    (delta_field<serial_element_t<R, Is>> && ...);
+
+template<typename T>
+bool delta_equal(const T& lhs, const T& rhs) noexcept(delta_bytes_v<T>)
+{
+    if constexpr (delta_bytes_v<T>)
+    {
+        return detail::equal_bytes<sizeof(T)>(std::addressof(lhs),
+                                              std::addressof(rhs));
+    }
+    else
+    {
+        return lhs == rhs;
+    }
+}
+} // namespace detail
+
+/// records whose fields can be diffed: non-view bounded ranges of up to 64
+/// serializable fields, each comparable with `==` or as raw bytes
+template<typename R>
+concept delta_record = // clang-format off
+    hera::bounded_range<R&> &&
+    !std::is_base_of_v<view_base, R> &&
+    detail::delta_record_v<R>; // clang-format on
+
+/// the fields of a `R` which changed, as written by `hera::diff`
+///
+/// Bit `I` of `mask` is set when field `I` changed. `values` holds the new
+/// values of the changed fields in index order, each in the format of
+/// `hera::serialize`. A `delta` is a bounded range of both, so it is sent
+/// with `hera::serialize` and read back with `hera::deserialize`.
+template<delta_record R>
+struct delta
+{
+    using mask_type = detail::delta_mask_t<hera::size_v<R>>;
+
+    mask_type              mask = 0;
+    std::vector<std::byte> values;
+
+    /// whether no field changed
+    bool unchanged() const noexcept
+    {
+        return mask == 0;
+    }
+
+    /// the number of changed fields
+    std::size_t changed_fields() const noexcept
+    {
+        return static_cast<std::size_t>(std::popcount(mask));
+    }
+
+    /// whether field `index` changed
+    bool changed(std::size_t index) const noexcept
+    {
+        return ((mask >> index) & 1) != 0;
+    }
+};
+
+template<delta_record R>
+inline constexpr bool enable_aggregate_range<hera::delta<R>> = true;
+
+/// writes the fields of `next` which differ from `prev` to `res`
+///
+/// Fields of integers, enums, floats and tuples of them without padding are
+/// compared as raw bytes a word at a time, others with `==`. Records of such
+/// fields only are first compared as a whole, so unchanged ones cost a single
+/// comparison. The new values are written in a second pass into a buffer of
+/// exactly their size, `res` keeps its buffer so reusing one across calls
+/// doesn't allocate once it is large enough.
+template<delta_record R>
+void diff(const R& prev, const R& next, delta<R>& res)
+{
+    using mask_type = typename delta<R>::mask_type;
+
+    res.mask = 0;
+    res.values.clear();
+
+    if constexpr (detail::bytes_equal<R>::value)
+    {
+        if (detail::equal_bytes<sizeof(R)>(std::addressof(prev),
+                                           std::addressof(next)))
+        {
+            return;
+        }
+    }
+
+    std::size_t size = 0;
+
+    [&]<std::size_t... Is>(std::index_sequence<Is...>)
+    {
+        (
+            [&] {
+                if (!detail::delta_equal(hera::get<Is>(prev),
+                                         hera::get<Is>(next)))
+                {
+                    res.mask |= mask_type{1} << Is;
+                    size += detail::serial_size(hera::get<Is>(next));
+                }
+            }(),
+            ...);
+    }
+    (std::make_index_sequence<hera::size_v<R>>{});
+
+    if (res.mask == 0)
+    {
+        return;
+    }
+
+    res.values.resize(size);
+    std::byte* out = res.values.data();
+
+    [&]<std::size_t... Is>(std::index_sequence<Is...>)
+    {
+        (
+            [&] {
+                if (res.changed(Is))
+                {
+                    out = detail::serial_write(hera::get<Is>(next), out);
+                }
+            }(),
+            ...);
+    }
+    (std::make_index_sequence<hera::size_v<R>>{});
+}
+
+/// the fields of `next` which differ from `prev`
+template<delta_record R>
+delta<R> diff(const R& prev, const R& next)
+{
+    delta<R> res;
+    hera::diff(prev, next, res);
+    return res;
+}
+
+/// assigns the fields of `mask` in `record` the values read from `values`,
+/// written by `hera::diff`
+///
+/// Views over single byte elements like `std::string_view` refer into
+/// `values` instead of copying. Returns false if `values` ends early or is
+/// longer than the fields of `mask`, `record` is left partially patched in
+/// that case.
+template<delta_record R>
+bool apply_patch(R&                           record,
+                 typename delta<R>::mask_type mask,
+                 std::span<const std::byte>   values)
+{
+    using mask_type = typename delta<R>::mask_type;
+
+    if constexpr (hera::size_v<R> < sizeof(mask_type) * 8)
+    {
+        if ((mask >> hera::size_v<R>) != 0)
+        {
+            return false;
+        }
+    }
+
+    const std::byte* in   = values.data();
+    const std::byte* last = values.data() + values.size();
+
+    const bool complete = [&]<std::size_t... Is>(std::index_sequence<Is...>)
+    {
+        return (
+            [&] {
+                if (((mask >> Is) & 1) == 0)
+                {
+                    return true;
+                }
+
+                using field_type = detail::serial_element_t<R, Is>;
+
+                // only sequences are checked while reading
+                if constexpr (detail::serial_fixed<field_type>())
+                {
+                    if (static_cast<std::size_t>(last - in) <
+                        detail::serial_fixed_size<field_type>())
+                    {
+                        return false;
+                    }
+                }
+
+                in = detail::serial_read(hera::get<Is>(record), in, last);
+                return in != nullptr;
+            }() &&
+            ...);
+    }
+    (std::make_index_sequence<hera::size_v<R>>{});
+
+    return complete && in == last;
+}
+
+/// assigns the changed fields of `patch` in `record`
+template<delta_record R>
+bool apply_patch(R& record, const delta<R>& patch)
+{
+    return hera::apply_patch(record, patch.mask, patch.values);
+}
+} // namespace hera
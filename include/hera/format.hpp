@@ -0,0 +1,717 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hera/algorithm/for_each.hpp"
+#include "hera/container/string.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/nth_element.hpp"
+
+namespace hera
+{
+namespace detail
+{
+enum class format_align : char
+{
+    none,
+    left,
+    right,
+    center,
+};
+
+/// a parsed replacement field `{[arg-id][:[[fill]align][width][.precision][type]]}`
+struct format_spec
+{
+    char         fill      = ' ';
+    format_align align     = format_align::none;
+    std::size_t  width     = 0;
+    std::size_t  precision = static_cast<std::size_t>(-1);
+    char         type      = '\0';
+
+    constexpr bool has_precision() const noexcept
+    {
+        return precision != static_cast<std::size_t>(-1);
+    }
+};
+
+struct format_piece
+{
+    bool is_slot = false;
+    // literal text, a view into the format string
+    std::size_t offset = 0;
+    std::size_t length = 0;
+    // replacement field
+    std::size_t arg = 0;
+    format_spec spec{};
+};
+
+struct format_parse_result
+{
+    std::vector<format_piece> pieces{};
+    std::size_t               args  = 0;
+    bool                      valid = true;
+};
+
+constexpr bool format_digit(char ch) noexcept
+{
+    return ch >= '0' && ch <= '9';
+}
+
+constexpr format_align format_align_of(char ch) noexcept
+{
+    switch (ch)
+    {
+    case '<':
+        return format_align::left;
+    case '>':
+        return format_align::right;
+    case '^':
+        return format_align::center;
+    default:
+        return format_align::none;
+    }
+}
+
+constexpr format_parse_result parse_format(std::string_view fmt)
+{
+    format_parse_result result{};
+
+    std::size_t literal   = 0;
+    std::size_t next_arg  = 0;
+    bool        automatic = false;
+    bool        manual    = false;
+
+    const auto flush = [&](std::size_t end) {
+        if (end != literal)
+        {
+            result.pieces.push_back(
+                format_piece{false, literal, end - literal});
+        }
+    };
+
+    const auto number = [&](std::size_t& pos) {
+        std::size_t value = 0;
+        while (pos < fmt.size() && format_digit(fmt[pos]))
+        {
+            value = value * 10 + static_cast<std::size_t>(fmt[pos++] - '0');
+        }
+        return value;
+    };
+
+    for (std::size_t pos = 0; pos < fmt.size(); ++pos)
+    {
+        if (fmt[pos] == '}')
+        {
+            if (pos + 1 == fmt.size() || fmt[pos + 1] != '}')
+            {
+                result.valid = false;
+                return result;
+            }
+
+            // keep the first brace as part of the literal
+            flush(pos + 1);
+            literal = ++pos + 1;
+            continue;
+        }
+
+        if (fmt[pos] != '{')
+        {
+            continue;
+        }
+
+        if (pos + 1 < fmt.size() && fmt[pos + 1] == '{')
+        {
+            flush(pos + 1);
+            literal = ++pos + 1;
+            continue;
+        }
+
+        flush(pos);
+        ++pos;
+
+        format_piece slot{true};
+
+        if (pos < fmt.size() && format_digit(fmt[pos]))
+        {
+            slot.arg = number(pos);
+            manual   = true;
+        }
+        else
+        {
+            slot.arg  = next_arg++;
+            automatic = true;
+        }
+
+        if (pos < fmt.size() && fmt[pos] == ':')
+        {
+            ++pos;
+
+            auto& spec = slot.spec;
+
+            if (pos + 1 < fmt.size() &&
+                format_align_of(fmt[pos + 1]) != format_align::none &&
+                fmt[pos] != '{' && fmt[pos] != '}')
+            {
+                spec.fill  = fmt[pos];
+                spec.align = format_align_of(fmt[pos + 1]);
+                pos += 2;
+            }
+            else if (pos < fmt.size() &&
+                     format_align_of(fmt[pos]) != format_align::none)
+            {
+                spec.align = format_align_of(fmt[pos++]);
+            }
+
+            spec.width = number(pos);
+
+            if (pos < fmt.size() && fmt[pos] == '.')
+            {
+                ++pos;
+                if (pos == fmt.size() || !format_digit(fmt[pos]))
+                {
+                    result.valid = false;
+                    return result;
+                }
+
+                spec.precision = number(pos);
+            }
+
+            if (pos < fmt.size() && fmt[pos] != '}')
+            {
+                spec.type = fmt[pos++];
+            }
+        }
+
+        if (pos == fmt.size() || fmt[pos] != '}' || (automatic && manual))
+        {
+            result.valid = false;
+            return result;
+        }
+
+        result.args = std::max(result.args, slot.arg + 1);
+        result.pieces.push_back(slot);
+        literal = pos + 1;
+    }
+
+    flush(fmt.size());
+    return result;
+}
+
+template<auto Fmt>
+inline constexpr std::string_view format_string_v =
+    static_cast<std::string_view>(Fmt);
+
+/// `Fmt` is parsed twice, once to size the array and once to fill it
+template<auto Fmt>
+constexpr auto make_format_pieces()
+{
+    constexpr auto size =
+        detail::parse_format(format_string_v<Fmt>).pieces.size();
+
+    std::array<format_piece, size> pieces{};
+
+    const auto parsed = detail::parse_format(format_string_v<Fmt>);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        pieces[i] = parsed.pieces[i];
+    }
+
+    return pieces;
+}
+
+template<auto Fmt>
+inline constexpr auto format_pieces_v = detail::make_format_pieces<Fmt>();
+
+template<std::size_t Offset, std::size_t Length>
+struct format_literal
+{
+    static constexpr std::size_t offset = Offset;
+    static constexpr std::size_t length = Length;
+};
+
+template<std::size_t Arg, format_spec Spec>
+struct format_slot
+{
+    static constexpr std::size_t arg  = Arg;
+    static constexpr format_spec spec = Spec;
+};
+
+template<auto Fmt, std::size_t I>
+using format_piece_t = std::conditional_t<
+    format_pieces_v<Fmt>[I].is_slot,
+    format_slot<format_pieces_v<Fmt>[I].arg, format_pieces_v<Fmt>[I].spec>,
+    format_literal<format_pieces_v<Fmt>[I].offset,
+                   format_pieces_v<Fmt>[I].length>>;
+
+template<auto Fmt, typename Indices>
+struct format_pieces;
+
+template<auto Fmt, std::size_t... Is>
+struct format_pieces<Fmt, std::index_sequence<Is...>>
+{
+    using type = hera::tuple<format_piece_t<Fmt, Is>...>;
+};
+
+/// the format string as a tuple of `format_literal` and `format_slot` types
+template<auto Fmt>
+using format_pieces_t = typename format_pieces<
+    Fmt,
+    std::make_index_sequence<format_pieces_v<Fmt>.size()>>::type;
+
+// argument categories
+
+template<typename T>
+concept format_char = std::same_as<T, char>;
+
+template<typename T>
+concept format_bool = std::same_as<T, bool>;
+
+template<typename T>
+concept format_integer =
+    std::integral<T> && !format_char<T> && !format_bool<T> &&
+    !std::same_as<T, wchar_t> && !std::same_as<T, char8_t> &&
+    !std::same_as<T, char16_t> && !std::same_as<T, char32_t>;
+
+template<typename T>
+concept format_float = std::floating_point<T>;
+
+template<typename T>
+concept format_text = std::is_convertible_v<const T&, std::string_view> &&
+                      !std::same_as<T, std::nullptr_t>;
+
+template<typename T>
+constexpr bool format_accepts(const format_spec& spec) noexcept
+{
+    const auto type_in = [&](std::string_view types) {
+        return spec.type == '\0' || types.find(spec.type) != types.npos;
+    };
+
+    if constexpr (format_integer<T>)
+    {
+        return !spec.has_precision() && type_in("dxXboc");
+    }
+    else if constexpr (format_float<T>)
+    {
+        return type_in("feEgG");
+    }
+    else if constexpr (format_text<T>)
+    {
+        return type_in("s");
+    }
+    else if constexpr (format_char<T>)
+    {
+        return !spec.has_precision() && type_in("cd");
+    }
+    else if constexpr (format_bool<T>)
+    {
+        return !spec.has_precision() && type_in("sd");
+    }
+    else
+    {
+        return false;
+    }
+}
+
+template<auto Fmt, typename... Args, std::size_t... Is>
+constexpr bool format_slots_match(std::index_sequence<Is...>) noexcept
+{
+    constexpr auto& pieces = format_pieces_v<Fmt>;
+
+    const auto slot_matches = [&]<std::size_t I>(
+                                  std::integral_constant<std::size_t, I>) {
+        if constexpr (!pieces[I].is_slot)
+        {
+            return true;
+        }
+        else
+        {
+            return detail::format_accepts<std::remove_cvref_t<
+                hera::nth_element_t<pieces[I].arg, Args...>>>(
+                pieces[I].spec);
+        }
+    };
+
+    return (slot_matches(std::integral_constant<std::size_t, Is>{}) && ...);
+}
+
+template<auto Fmt, typename... Args>
+constexpr bool format_arguments_match() noexcept
+{
+    if constexpr (!detail::parse_format(format_string_v<Fmt>).valid)
+    {
+        return false;
+    }
+    else if constexpr (detail::parse_format(format_string_v<Fmt>).args !=
+                       sizeof...(Args))
+    {
+        return false;
+    }
+    else
+    {
+        return detail::format_slots_match<Fmt, Args...>(
+            std::make_index_sequence<format_pieces_v<Fmt>.size()>{});
+    }
+}
+
+// upper bounds of the characters written for one argument, text arguments are
+// only known at runtime
+
+template<typename T>
+constexpr std::size_t format_bound(const format_spec& spec) noexcept
+{
+    if constexpr (format_integer<T>)
+    {
+        constexpr std::size_t bits = std::numeric_limits<T>::digits;
+
+        switch (spec.type)
+        {
+        case 'b':
+            // sign and one more digit for the minimum of signed types
+            return bits + 2;
+        case 'o':
+            return bits / 3 + 2;
+        case 'x':
+        case 'X':
+            return bits / 4 + 2;
+        case 'c':
+            return 1;
+        default:
+            return std::numeric_limits<T>::digits10 + 2;
+        }
+    }
+    else if constexpr (format_float<T>)
+    {
+        using limits = std::numeric_limits<T>;
+
+        // sign, point, exponent with its sign and up to 4 digits
+        constexpr std::size_t shortest = limits::max_digits10 + 8;
+        constexpr std::size_t fixed =
+            limits::max_exponent10 + limits::max_digits10 + 3;
+
+        if (spec.type == '\0' && !spec.has_precision())
+        {
+            return shortest;
+        }
+
+        const auto precision = spec.has_precision() ? spec.precision : 6;
+
+        return spec.type == 'f' ? fixed + precision : precision + 8 + 2;
+    }
+    else if constexpr (format_char<T>)
+    {
+        return spec.type == 'd' ? 4 : 1;
+    }
+    else if constexpr (format_bool<T>)
+    {
+        return 5;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+template<typename T>
+constexpr std::size_t format_bound(const format_spec& spec,
+                                   const T&           value) noexcept
+{
+    std::size_t bound = detail::format_bound<T>(spec);
+
+    if constexpr (format_text<T>)
+    {
+        bound = static_cast<std::string_view>(value).size();
+    }
+
+    return std::max(bound, spec.width);
+}
+
+inline char* format_pad(char*              first,
+                        char*              last,
+                        const format_spec& spec,
+                        format_align       fallback) noexcept
+{
+    const auto length = static_cast<std::size_t>(last - first);
+
+    if (length >= spec.width)
+    {
+        return last;
+    }
+
+    const auto padding = spec.width - length;
+    const auto align =
+        spec.align == format_align::none ? fallback : spec.align;
+
+    const auto before = align == format_align::left
+                            ? 0
+                            : align == format_align::right ? padding
+                                                           : padding / 2;
+
+    std::memmove(first + before, first, length);
+    std::memset(first, spec.fill, before);
+    std::memset(first + before + length, spec.fill, padding - before);
+
+    return first + spec.width;
+}
+
+inline char* format_text_to(char* out, std::string_view text) noexcept
+{
+    std::memcpy(out, text.data(), text.size());
+    return out + text.size();
+}
+
+template<typename T>
+inline char* format_integer_to(char* out, T value, char type) noexcept
+{
+    const int base = type == 'b'   ? 2
+                     : type == 'o' ? 8
+                     : type == 'x' || type == 'X' ? 16
+                                                  : 10;
+
+    // binary needs the most, a sign and digits + 1 for the minimum of signed
+    // types
+    constexpr std::size_t length =
+        std::numeric_limits<T>::digits + (std::is_signed_v<T> ? 2 : 0);
+
+    const auto [last, ec] = std::to_chars(out, out + length, value, base);
+    if (ec != std::errc{})
+    {
+        return out;
+    }
+
+    if (type == 'X')
+    {
+        for (char* it = out; it != last; ++it)
+        {
+            if (*it >= 'a' && *it <= 'f')
+            {
+                *it = static_cast<char>(*it - 'a' + 'A');
+            }
+        }
+    }
+
+    return last;
+}
+
+template<typename T>
+inline char* format_float_to(char* out, T value, const format_spec& spec) noexcept
+{
+    auto* const end = out + detail::format_bound<T>(spec);
+
+    std::chars_format format = std::chars_format::general;
+    switch (spec.type)
+    {
+    case 'f':
+        format = std::chars_format::fixed;
+        break;
+    case 'e':
+    case 'E':
+        format = std::chars_format::scientific;
+        break;
+    case '\0':
+        if (!spec.has_precision())
+        {
+            const auto [last, ec] = std::to_chars(out, end, value);
+            return ec == std::errc{} ? last : out;
+        }
+        break;
+    default:
+        break;
+    }
+
+    // like std::format an explicit type defaults to a precision of 6
+    const auto precision = spec.has_precision() ? spec.precision : 6;
+
+    const auto [last, ec] =
+        std::to_chars(out, end, value, format, static_cast<int>(precision));
+    if (ec != std::errc{})
+    {
+        return out;
+    }
+
+    if (spec.type == 'E' || spec.type == 'G')
+    {
+        for (char* it = out; it != last; ++it)
+        {
+            if (*it == 'e')
+            {
+                *it = 'E';
+            }
+        }
+    }
+
+    return last;
+}
+
+template<typename T>
+inline char* format_arg_to(char* out, const T& value, const format_spec& spec) noexcept
+{
+    char*        first    = out;
+    format_align fallback = format_align::right;
+
+    if constexpr (format_integer<T>)
+    {
+        if (spec.type == 'c')
+        {
+            *out++ = static_cast<char>(value);
+        }
+        else
+        {
+            out = detail::format_integer_to(out, value, spec.type);
+        }
+    }
+    else if constexpr (format_float<T>)
+    {
+        out = detail::format_float_to(out, value, spec);
+    }
+    else if constexpr (format_text<T>)
+    {
+        auto text = static_cast<std::string_view>(value);
+        if (spec.has_precision())
+        {
+            text = text.substr(0, spec.precision);
+        }
+
+        out      = detail::format_text_to(out, text);
+        fallback = format_align::left;
+    }
+    else if constexpr (format_char<T>)
+    {
+        if (spec.type == 'd')
+        {
+            out = detail::format_integer_to(out, static_cast<int>(value), 'd');
+        }
+        else
+        {
+            *out++   = value;
+            fallback = format_align::left;
+        }
+    }
+    else if constexpr (format_bool<T>)
+    {
+        if (spec.type == 'd')
+        {
+            *out++ = value ? '1' : '0';
+        }
+        else
+        {
+            out      = detail::format_text_to(out, value ? "true" : "false");
+            fallback = format_align::left;
+        }
+    }
+
+    if (spec.width == 0)
+    {
+        return out;
+    }
+
+    return detail::format_pad(first, out, spec, fallback);
+}
+
+template<auto Fmt>
+inline constexpr std::size_t format_literal_size_v = [] {
+    std::size_t size = 0;
+    for (const auto& piece : format_pieces_v<Fmt>)
+    {
+        size += piece.is_slot ? 0 : piece.length;
+    }
+    return size;
+}();
+} // namespace detail
+
+/// `Fmt` is a valid format string whose replacement fields accept `Args`
+template<auto Fmt, typename... Args>
+concept format_string_for =
+    hera::constant_string<std::remove_cvref_t<decltype(Fmt)>> &&
+    detail::format_arguments_match<Fmt, std::remove_cvref_t<Args>...>();
+
+/// an upper bound of the characters written by `format_to`
+///
+/// Every argument except text has a bound known at compile time, only the
+/// sizes of text arguments are added at runtime.
+template<auto Fmt, typename... Args> // clang-format off
+    requires hera::format_string_for<Fmt, Args...>
+constexpr std::size_t format_size_hint(const Args&... args) noexcept // clang-format on
+{
+    std::size_t size = detail::format_literal_size_v<Fmt>;
+
+    hera::for_each(
+        detail::format_pieces_t<Fmt>{}, [&]<typename Piece>(Piece) {
+            if constexpr (requires { Piece::spec; })
+            {
+                size += detail::format_bound(
+                    Piece::spec,
+                    hera::get<Piece::arg>(hera::forward_as_tuple(args...)));
+            }
+        });
+
+    return size;
+}
+
+/// formats `args` into the buffer at `out`, which must hold at least
+/// `format_size_hint<Fmt>(args...)` characters. Returns the end of the output.
+///
+/// Replacement fields follow std::format: `{}`, `{0}`, `{:>8}`, `{:*^10}`,
+/// `{:x}`, `{:.3f}` and so on. Integers accept the types d x X b o c, floating
+/// point numbers f e E g G, text and bools s and characters c. Any mismatch
+/// between the format string and the arguments fails to compile.
+template<auto Fmt, typename... Args> // clang-format off
+    requires hera::format_string_for<Fmt, Args...>
+char* format_to(char* out, const Args&... args) noexcept // clang-format on
+{
+    constexpr auto fmt = detail::format_string_v<Fmt>;
+
+    const auto arguments = hera::forward_as_tuple(args...);
+
+    hera::for_each(detail::format_pieces_t<Fmt>{}, [&]<typename Piece>(Piece) {
+        if constexpr (requires { Piece::spec; })
+        {
+            out = detail::format_arg_to(
+                out, hera::get<Piece::arg>(arguments), Piece::spec);
+        }
+        else if constexpr (Piece::length == 1)
+        {
+            *out++ = fmt[Piece::offset];
+        }
+        else
+        {
+            std::memcpy(out, fmt.data() + Piece::offset, Piece::length);
+            out += Piece::length;
+        }
+    });
+
+    return out;
+}
+
+/// formats `args` into a string with a single allocation
+template<auto Fmt, typename... Args> // clang-format off
+    requires hera::format_string_for<Fmt, Args...>
+std::string format(const Args&... args) // clang-format on
+{
+    std::string result;
+
+#if defined(__cpp_lib_string_resize_and_overwrite)
+    result.resize_and_overwrite(
+        hera::format_size_hint<Fmt>(args...), [&](char* data, std::size_t) {
+            return static_cast<std::size_t>(
+                hera::format_to<Fmt>(data, args...) - data);
+        });
+#else
+    result.resize(hera::format_size_hint<Fmt>(args...));
+    result.resize(static_cast<std::size_t>(
+        hera::format_to<Fmt>(result.data(), args...) - result.data()));
+#endif
+
+    return result;
+}
+} // namespace hera
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "hera/constant.hpp"
+#include "hera/utility/detail/aggregate.hpp"
 #include "hera/utility/detail/priority_tag.hpp"
 
 namespace hera
@@ -28,6 +29,15 @@ private:
         return get<Idx>(static_cast<R&&>(r));
     }
 
+    // members of aggregates are always accessed by reference
+    template<typename R> // clang-format off
+        requires hera::detail::aggregate_range<std::remove_reference_t<R>> &&
+                 (Idx < hera::detail::aggregate_size_v<std::remove_cvref_t<R>>)
+    static constexpr auto& impl(hera::detail::priority_tag<2>, R&& r) noexcept // clang-format on
+    {
+        return hera::detail::aggregate_get<Idx>(r);
+    }
+
 public:
     template<typename R>
     constexpr auto operator()(R&& r) const
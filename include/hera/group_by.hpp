@@ -0,0 +1,409 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hera/algorithm/unpack.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/get.hpp"
+#include "hera/reducer.hpp"
+#include "hera/table.hpp"
+#include "hera/utility/detail/group_hash.hpp"
+
+namespace hera
+{
+namespace detail
+{
+/// keys of at most 16 bits index the slots directly instead of being hashed
+template<typename T>
+concept group_direct_key = // clang-format off
+    (std::is_integral_v<T> || std::is_enum_v<T>) &&
+    sizeof(T) <= 2; // clang-format on
+
+/// the key of rows of `R` grouped by `KeyIdxs`, a tuple for several elements
+template<typename R, std::size_t... KeyIdxs>
+using group_key_t =
+    std::conditional_t<sizeof...(KeyIdxs) == 1,
+                       group_element_t<R, nth_index_v<0, KeyIdxs...>>,
+                       hera::tuple<group_element_t<R, KeyIdxs>...>>;
+
+template<typename R, typename Reducer, typename = typename Reducer::inputs>
+struct group_state;
+
+template<typename R, typename Reducer, std::size_t... Is>
+struct group_state<R, Reducer, std::index_sequence<Is...>>
+{
+    using type = reducer_state_t<Reducer, group_element_t<R, Is>...>;
+};
+
+template<typename R, typename Reducer>
+using group_state_t = typename group_state<R, Reducer>::type;
+
+template<typename R, typename Reducer>
+using group_result_t =
+    std::remove_cvref_t<decltype(std::declval<const Reducer&>().result(
+        std::declval<const group_state_t<R, Reducer>&>()))>;
+
+/// an open addressing table of the groups seen so far
+///
+/// Groups are stored densely in the order they were inserted, with the key
+/// next to the states so a hit touches a single entry. Slots hold the high
+/// half of the hash of their group, which also picks the slot, and its index
+/// plus one. They are probed linearly. Keys of at most 16 bits index the
+/// slots directly and never collide.
+template<typename Key, typename States>
+class group_table
+{
+public:
+    struct entry
+    {
+        Key    key;
+        States states;
+    };
+
+private:
+    static constexpr bool direct = group_direct_key<Key>;
+
+    using slot_type =
+        std::conditional_t<direct, std::uint32_t, std::uint64_t>;
+
+    std::vector<entry>     entries_;
+    std::vector<slot_type> slots_;
+    std::size_t            mask_;
+
+    static std::size_t direct_slot(Key key) noexcept
+    {
+        using integral_type =
+            typename std::conditional_t<std::is_enum_v<Key>,
+                                        std::underlying_type<Key>,
+                                        std::type_identity<Key>>::type;
+
+        return static_cast<std::make_unsigned_t<integral_type>>(key);
+    }
+
+    void grow()
+    {
+        std::vector<slot_type> slots(slots_.size() * 2, 0);
+        mask_ = slots.size() - 1;
+
+        for (const auto slot : slots_)
+        {
+            if (slot != 0)
+            {
+                auto pos = (slot >> 32) & mask_;
+                while (slots[pos] != 0)
+                {
+                    pos = (pos + 1) & mask_;
+                }
+                slots[pos] = slot;
+            }
+        }
+
+        slots_ = std::move(slots);
+    }
+
+public:
+    group_table()
+        : slots_(direct ? std::size_t{1} << (8 * sizeof(Key)) : 64, 0),
+          mask_{slots_.size() - 1}
+    {}
+
+    /// the states of the group of `key`, a copy of `init` for new groups
+    ///
+    /// Composite keys may be looked up by a tuple of references, the owning
+    /// key is only built for new groups.
+    template<typename Probe>
+    States& find(const Probe& key, const States& init)
+    {
+        if constexpr (direct)
+        {
+            auto& slot = slots_[direct_slot(key)];
+
+            if (slot == 0) [[unlikely]]
+            {
+                entries_.push_back({key, init});
+                slot = static_cast<slot_type>(entries_.size());
+            }
+
+            return entries_[slot - 1].states;
+        }
+        else
+        {
+            const std::uint64_t tag = detail::group_hash(key) >> 32;
+            auto                pos = tag & mask_;
+
+            for (auto slot = slots_[pos]; slot != 0; slot = slots_[pos])
+            {
+                if ((slot >> 32) == tag)
+                {
+                    auto& candidate = entries_[(slot & 0xffffffff) - 1];
+                    if (detail::group_key_equal(candidate.key, key))
+                    {
+                        return candidate.states;
+                    }
+                }
+
+                pos = (pos + 1) & mask_;
+            }
+
+            if constexpr (std::is_same_v<Probe, Key>)
+            {
+                entries_.push_back({key, init});
+            }
+            else
+            {
+                entries_.push_back({hera::unpack(key,
+                                                 [](const auto&... elements) {
+                                                     return Key{elements...};
+                                                 }),
+                                    init});
+            }
+            slots_[pos] = (tag << 32) | entries_.size();
+
+            // at most half of the slots are used
+            if (entries_.size() * 2 > slots_.size())
+            {
+                grow();
+            }
+
+            return entries_.back().states;
+        }
+    }
+
+    std::size_t size() const noexcept
+    {
+        return entries_.size();
+    }
+
+    const std::vector<entry>& entries() const noexcept
+    {
+        return entries_;
+    }
+};
+
+/// partition of a key when merging into `partitions` tables, from the low
+/// bits of the hash as the high ones pick the slot
+template<typename Key>
+std::size_t group_partition(const Key& key, std::size_t partitions) noexcept
+{
+    return static_cast<std::size_t>(
+        ((detail::group_hash(key) & 0xffffffff) * partitions) >> 32);
+}
+} // namespace detail
+
+/// aggregates `rows` per distinct value of the elements `KeyIdxs` with every
+/// reducer in a single pass
+///
+/// The rows are hera ranges like `hera::tuple`s or the rows of a `soa_vector`,
+/// the reducers pick their inputs by element index, like
+/// `hera::tuple{hera::sum<2>, hera::min<3>, hera::count}`. Returns a
+/// `hera::table` with one column per key element followed by one column per
+/// reducer result. String views used as keys refer into the rows.
+///
+/// With several `threads`, every thread aggregates a slice of the rows into a
+/// table of its own. The groups of these partial tables are then partitioned
+/// by hash and every thread merges one partition. Groups are in the order of
+/// their first row on a single thread and unordered otherwise.
+template<std::size_t... KeyIdxs, std::ranges::random_access_range R, typename... Rs> // clang-format off
+    requires (sizeof...(KeyIdxs) != 0) &&
+             std::ranges::sized_range<R> &&
+             (detail::group_key<detail::group_element_t<R, KeyIdxs>> && ...) &&
+             (detail::reducer<Rs> && ...)
+auto group_by(R&&                       rows,
+              const hera::tuple<Rs...>& reducers,
+              std::size_t               threads = 1) // clang-format on
+{
+    using key_type    = detail::group_key_t<R, KeyIdxs...>;
+    using states_type = hera::tuple<detail::group_state_t<R, Rs>...>;
+    using table_type  = detail::group_table<key_type, states_type>;
+
+    constexpr auto reducer_indices = std::index_sequence_for<Rs...>{};
+
+    const auto init = [&]<std::size_t... Is>(std::index_sequence<Is...>)
+    {
+        return states_type{
+            [&]<typename Reducer, std::size_t... Cs>(
+                const Reducer& reducer, std::index_sequence<Cs...>) {
+                return reducer
+                    .template init<detail::group_element_t<R, Cs>...>();
+            }(hera::get<Is>(reducers), typename Rs::inputs{})...};
+    }
+    (reducer_indices);
+
+    // folds the rows [begin, end) into `groups`
+    const auto aggregate =
+        [&](table_type& groups, std::size_t begin, std::size_t end) {
+            auto it = std::ranges::begin(rows) +
+                      static_cast<std::ranges::range_difference_t<R>>(begin);
+
+            for (std::size_t i = begin; i != end; ++i, ++it)
+            {
+                auto&& row = *it;
+
+                auto& states = [&]() -> states_type& {
+                    if constexpr (sizeof...(KeyIdxs) == 1)
+                    {
+                        return groups.find(hera::get<KeyIdxs...>(row), init);
+                    }
+                    else
+                    {
+                        // no copies of string elements for existing groups
+                        return groups.find(
+                            hera::tuple<
+                                const detail::group_element_t<R, KeyIdxs>&...>{
+                                hera::get<KeyIdxs>(row)...},
+                            init);
+                    }
+                }();
+
+                [&]<std::size_t... Is>(std::index_sequence<Is...>)
+                {
+                    (
+                        [&]<std::size_t... Cs>(std::index_sequence<Cs...>) {
+                            hera::get<Is>(reducers).update(
+                                hera::get<Is>(states), hera::get<Cs>(row)...);
+                        }(typename Rs::inputs{}),
+                        ...);
+                }
+                (reducer_indices);
+            }
+        };
+
+    // merges the groups `selection` of `other` into `groups`
+    const auto merge = [&](table_type&                       groups,
+                           const table_type&                 other,
+                           const std::vector<std::uint32_t>& selection) {
+        for (const auto group : selection)
+        {
+            const auto& partial = other.entries()[group];
+            auto&       states  = groups.find(partial.key, init);
+
+            [&]<std::size_t... Is>(std::index_sequence<Is...>)
+            {
+                (hera::get<Is>(reducers).merge(hera::get<Is>(states),
+                                               hera::get<Is>(partial.states)),
+                 ...);
+            }
+            (reducer_indices);
+        }
+    };
+
+    const std::size_t size = std::ranges::size(rows);
+
+    // slices of less than a batch aren't worth a thread
+    threads = std::max<std::size_t>(std::min(threads, size / table_batch_size),
+                                    1);
+
+    std::vector<table_type> partitions(threads);
+
+    if (threads == 1)
+    {
+        aggregate(partitions[0], 0, size);
+    }
+    else
+    {
+        // invokes `fn(t)` for every thread `t`, one of them on this thread
+        const auto run = [&](auto fn) {
+            std::vector<std::thread> workers;
+            workers.reserve(threads - 1);
+
+            for (std::size_t t = 1; t != threads; ++t)
+            {
+                workers.emplace_back(fn, t);
+            }
+
+            fn(std::size_t{0});
+
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+        };
+
+        std::vector<table_type> partials(threads);
+        // the groups of every partial table per partition
+        std::vector<std::vector<std::vector<std::uint32_t>>> selections(
+            threads, std::vector<std::vector<std::uint32_t>>(threads));
+
+        run([&](std::size_t t) {
+            aggregate(partials[t], size * t / threads, size * (t + 1) / threads);
+
+            const auto& entries = partials[t].entries();
+            for (std::size_t group = 0; group != entries.size(); ++group)
+            {
+                const auto p =
+                    detail::group_partition(entries[group].key, threads);
+                selections[t][p].push_back(static_cast<std::uint32_t>(group));
+            }
+        });
+
+        run([&](std::size_t p) {
+            for (std::size_t t = 0; t != threads; ++t)
+            {
+                merge(partitions[p], partials[t], selections[t][p]);
+            }
+        });
+    }
+
+    // one column per key element followed by one per reducer
+    constexpr std::size_t key_columns = sizeof...(KeyIdxs);
+
+    hera::tuple<std::vector<detail::group_element_t<R, KeyIdxs>>...,
+                std::vector<detail::group_result_t<R, Rs>>...>
+        columns;
+
+    std::size_t groups = 0;
+    for (const auto& partition : partitions)
+    {
+        groups += partition.size();
+    }
+
+    [&]<std::size_t... Is>(std::index_sequence<Is...>)
+    {
+        (hera::get<Is>(columns).reserve(groups), ...);
+    }
+    (std::make_index_sequence<key_columns + sizeof...(Rs)>{});
+
+    for (const auto& partition : partitions)
+    {
+        for (const auto& [key, states] : partition.entries())
+        {
+            if constexpr (key_columns == 1)
+            {
+                hera::get<0>(columns).push_back(key);
+            }
+            else
+            {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>)
+                {
+                    (hera::get<Is>(columns).push_back(hera::get<Is>(key)),
+                     ...);
+                }
+                (std::make_index_sequence<key_columns>{});
+            }
+
+            [&]<std::size_t... Is>(std::index_sequence<Is...>)
+            {
+                (hera::get<key_columns + Is>(columns).push_back(
+                     hera::get<Is>(reducers).result(hera::get<Is>(states))),
+                 ...);
+            }
+            (reducer_indices);
+        }
+    }
+
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+    {
+        return table<detail::group_element_t<R, KeyIdxs>...,
+                     detail::group_result_t<R, Rs>...>{
+            std::move(hera::get<Is>(columns))...};
+    }
+    (std::make_index_sequence<key_columns + sizeof...(Rs)>{});
+}
+} // namespace hera
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hera/container/soa_vector.hpp"
+#include "hera/get.hpp"
+#include "hera/ranges.hpp"
+#include "hera/size.hpp"
+#include "hera/utility/detail/packed.hpp"
+#include "hera/utility/detail/perfect_hash.hpp"
+
+namespace hera
+{
+namespace detail
+{
+/// added to the seed of every scalar, so a chain of zeros doesn't hash to 0
+inline constexpr std::uint64_t hash_increment = 0x9e3779b97f4a7c15ull;
+
+template<typename T>
+concept hash_scalar = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+template<typename T>
+concept hash_string = std::is_convertible_v<const T&, std::string_view>;
+
+/// values whose object representations are equal exactly for equal values
+template<typename T>
+concept hash_bytes = // clang-format off
+    std::is_trivially_copyable_v<T> &&
+    std::has_unique_object_representations_v<T>; // clang-format on
+
+template<typename T>
+using hash_bytes_t = std::bool_constant<hash_bytes<T>>;
+
+/// contiguous ranges of such values, the element type is only named for
+/// ranges
+template<typename T>
+concept hash_byte_range = // clang-format off
+    std::ranges::contiguous_range<const T&> &&
+    std::ranges::sized_range<const T&> &&
+    hash_bytes<std::ranges::range_value_t<const T&>>; // clang-format on
+
+/// tuples of such values filling the whole object
+template<typename T>
+inline constexpr bool hash_packed_v = detail::packed_range_v<hash_bytes_t, T>;
+
+/// the bits of a scalar, equal for equal values
+template<hash_scalar T>
+constexpr std::uint64_t hash_bits(T value) noexcept
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        // -0.0 and 0.0 are equal and have to hash alike
+        const T normalized = value == T{} ? T{} : value;
+
+        if constexpr (sizeof(T) == sizeof(std::uint32_t))
+        {
+            return std::bit_cast<std::uint32_t>(normalized);
+        }
+        else
+        {
+            return std::bit_cast<std::uint64_t>(normalized);
+        }
+    }
+    else
+    {
+        return static_cast<std::uint64_t>(value);
+    }
+}
+
+constexpr std::uint64_t hash_scalar_step(std::uint64_t seed,
+                                         std::uint64_t bits) noexcept
+{
+    return detail::hash_mix((seed + hash_increment) ^ bits);
+}
+
+inline std::uint64_t hash_raw(const void*   data,
+                              std::size_t   size,
+                              std::uint64_t seed) noexcept
+{
+    return detail::string_hash(
+        std::string_view{static_cast<const char*>(data), size}, seed);
+}
+} // namespace detail
+
+/// a 64 bit hash of scalars, strings, hera ranges like `hera::tuple`,
+/// `hera::pair` and views, and standard ranges of any of them
+///
+/// Aggregates are hashed member by member once they are made hera ranges
+/// through `hera::enable_aggregate_range`.
+///
+/// Values of the same type which compare equal hash alike, hashes of values
+/// of different types are unrelated. Scalars go through the murmur3
+/// finalizer, the elements of ranges are chained through the seed. Tuples
+/// and contiguous ranges of trivially copyable types without padding are
+/// hashed as raw bytes with a single call instead. Usable as the hasher of
+/// standard unordered containers.
+struct hash_fn
+{
+    template<typename T>
+    std::uint64_t operator()(const T& value, std::uint64_t seed = 0) const
+        noexcept
+    {
+        if constexpr (detail::hash_scalar<T>)
+        {
+            return detail::hash_scalar_step(seed, detail::hash_bits(value));
+        }
+        else if constexpr (detail::hash_string<T>)
+        {
+            return detail::string_hash(std::string_view{value}, seed);
+        }
+        else if constexpr (hera::bounded_range<const T&>)
+        {
+            if constexpr (detail::hash_packed_v<T>)
+            {
+                return detail::hash_raw(
+                    std::addressof(value), sizeof(T), seed);
+            }
+            else
+            {
+                return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+                {
+                    ((seed = (*this)(hera::get<Is>(value), seed)), ...);
+                    return seed;
+                }
+                (std::make_index_sequence<hera::size_v<const T&>>{});
+            }
+        }
+        else if constexpr (detail::hash_byte_range<T>)
+        {
+            return detail::hash_raw(
+                std::ranges::data(value),
+                std::ranges::size(value) *
+                    sizeof(std::ranges::range_value_t<const T&>),
+                seed);
+        }
+        else if constexpr (std::ranges::input_range<const T&>)
+        {
+            // the length ends the chain, so nested ranges split differently
+            // hash differently
+            std::uint64_t length = 0;
+            for (const auto& element : value)
+            {
+                seed = (*this)(element, seed);
+                ++length;
+            }
+
+            return detail::hash_scalar_step(seed, length);
+        }
+        else
+        {
+            static_assert(std::ranges::input_range<const T&>,
+                          "hera::hash: unsupported type");
+            return seed;
+        }
+    }
+};
+
+inline constexpr hash_fn hash{};
+
+/// writes `hera::hash(rows[i], seed)` to `out[i]` for every row
+///
+/// The hash is built column by column over blocks of rows. The loops over a
+/// column of scalars have no dependencies between rows, so they are
+/// vectorized where the target has 64 bit multiplications and otherwise keep
+/// several multiplications in flight. Other columns hash element by element.
+template<hera::soa_aggregate Agg>
+void hash_many(const soa_vector<Agg>&   rows,
+               std::span<std::uint64_t> out,
+               std::uint64_t            seed = 0) noexcept
+{
+    constexpr std::size_t block = 1024;
+
+    const std::size_t size = rows.size() < out.size() ? rows.size()
+                                                      : out.size();
+
+    for (std::size_t begin = 0; begin < size; begin += block)
+    {
+        const std::size_t n = size - begin < block ? size - begin : block;
+        std::uint64_t*    hashes = out.data() + begin;
+
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            hashes[i] = seed;
+        }
+
+        [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            (
+                [&] {
+                    const auto* column =
+                        rows.template column<Is>().data() + begin;
+
+                    using member_type =
+                        typename soa_vector<Agg>::template member_type<Is>;
+
+                    if constexpr (detail::hash_scalar<member_type>)
+                    {
+                        for (std::size_t i = 0; i != n; ++i)
+                        {
+                            hashes[i] = detail::hash_scalar_step(
+                                hashes[i], detail::hash_bits(column[i]));
+                        }
+                    }
+                    else
+                    {
+                        for (std::size_t i = 0; i != n; ++i)
+                        {
+                            hashes[i] = hera::hash(column[i], hashes[i]);
+                        }
+                    }
+                }(),
+                ...);
+        }
+        (std::make_index_sequence<soa_vector<Agg>::fields>{});
+    }
+}
+
+/// the hashes of all rows of `rows`
+template<hera::soa_aggregate Agg>
+std::vector<std::uint64_t> hash_many(const soa_vector<Agg>& rows,
+                                     std::uint64_t          seed = 0)
+{
+    std::vector<std::uint64_t> res(rows.size());
+    hera::hash_many(rows, res, seed);
+    return res;
+}
+} // namespace hera
@@ -0,0 +1,450 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hera/container/integer_sequence.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/get.hpp"
+#include "hera/size.hpp"
+#include "hera/utility/detail/group_hash.hpp"
+#include "hera/view/interface.hpp"
+
+namespace hera
+{
+/// the indices of a left and a right row with equal keys
+struct join_match
+{
+    std::uint32_t left;
+    std::uint32_t right;
+
+    friend constexpr bool operator==(const join_match&,
+                                     const join_match&) noexcept = default;
+};
+
+namespace detail
+{
+/// rows probed per batch, the slots of all of them are prefetched before
+/// the first lookup
+inline constexpr std::size_t join_batch_size = 32;
+
+inline void prefetch(const void* address) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    static_cast<void>(address);
+#endif
+}
+
+/// the hash of the key elements `Ks` of `row`, the same for equal keys of
+/// different rows
+template<std::size_t... Ks, typename Row>
+std::uint64_t join_hash(const Row& row) noexcept
+{
+    std::uint64_t res = 0;
+    ((res = detail::hash_mix(res ^ detail::group_hash(hera::get<Ks>(row)))),
+     ...);
+    return res;
+}
+
+template<typename L, typename R, typename LeftKeys, typename RightKeys>
+inline constexpr bool join_keys_v = false;
+
+/// as many keys on both sides, pairwise hashed alike when equal
+template<typename L, typename R, std::size_t... Ls, std::size_t... Rs> // clang-format off
+    requires (sizeof...(Ls) == sizeof...(Rs)) && (sizeof...(Ls) != 0)
+inline constexpr bool join_keys_v<L, // clang-format on
+                                  R,
+                                  hera::index_sequence<Ls...>,
+                                  hera::index_sequence<Rs...>> =
+    ((group_key<group_element_t<L, Ls>> &&
+      (std::is_same_v<group_element_t<L, Ls>, group_element_t<R, Rs>> ||
+       (group_string_key<group_element_t<L, Ls>> &&
+        group_string_key<group_element_t<R, Rs>>))) &&
+     ...);
+
+/// builds an open addressing table over `build` and looks up every row of
+/// `probe`, invokes `emit(build_index, probe_index)` for every match
+///
+/// Slots hold the high half of the hash of their key, which also picks the
+/// slot, and the index plus one of the first row with that key. Further rows
+/// with the same key are chained through `next`, so duplicate keys take a
+/// single slot and a lookup only walks the rows it matches.
+template<std::size_t... Bs, std::size_t... Ps, typename B, typename P, typename F>
+void join_build_probe(const B& build,
+                      const P& probe,
+                      F&&      emit,
+                      hera::index_sequence<Bs...>,
+                      hera::index_sequence<Ps...>)
+{
+    const std::size_t build_size = std::ranges::size(build);
+    const std::size_t probe_size = std::ranges::size(probe);
+    const auto        build_rows = std::ranges::begin(build);
+    const auto        probe_rows = std::ranges::begin(probe);
+
+    const auto build_row = [&](std::size_t index) -> decltype(auto) {
+        return build_rows[static_cast<std::ranges::range_difference_t<B>>(
+            index)];
+    };
+    const auto probe_row = [&](std::size_t index) -> decltype(auto) {
+        return probe_rows[static_cast<std::ranges::range_difference_t<P>>(
+            index)];
+    };
+
+    // at most half of the slots are used
+    std::size_t capacity = 16;
+    while (capacity < build_size * 2)
+    {
+        capacity *= 2;
+    }
+
+    std::vector<std::uint64_t> slots(capacity, 0);
+    std::vector<std::uint32_t> next(build_size, 0);
+    const std::size_t          mask = capacity - 1;
+
+    const auto slot_row = [](std::uint64_t slot) noexcept -> std::size_t {
+        return (slot & 0xffffffff) - 1;
+    };
+
+    // backwards, so chains list their rows in ascending order
+    for (std::size_t i = build_size; i-- != 0;)
+    {
+        auto&&              row = build_row(i);
+        const std::uint64_t tag = detail::join_hash<Bs...>(row) >> 32;
+
+        auto pos = tag & mask;
+        for (; slots[pos] != 0; pos = (pos + 1) & mask)
+        {
+            if ((slots[pos] >> 32) == tag &&
+                ((hera::get<Bs>(build_row(slot_row(slots[pos]))) ==
+                  hera::get<Bs>(row)) &&
+                 ...))
+            {
+                next[i] = static_cast<std::uint32_t>(slots[pos]);
+                break;
+            }
+        }
+        slots[pos] = (tag << 32) | (i + 1);
+    }
+
+    std::uint64_t tags[join_batch_size];
+
+    for (std::size_t begin = 0; begin < probe_size; begin += join_batch_size)
+    {
+        const std::size_t n = probe_size - begin < join_batch_size
+                                  ? probe_size - begin
+                                  : join_batch_size;
+
+        // the slots are fetched in parallel while the batch is hashed
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            tags[i] = detail::join_hash<Ps...>(probe_row(begin + i)) >> 32;
+            detail::prefetch(slots.data() + (tags[i] & mask));
+        }
+
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            auto&& row = probe_row(begin + i);
+
+            for (auto pos = tags[i] & mask; slots[pos] != 0;
+                 pos      = (pos + 1) & mask)
+            {
+                if ((slots[pos] >> 32) != tags[i])
+                {
+                    continue;
+                }
+
+                auto&& other = build_row(slot_row(slots[pos]));
+
+                if (((hera::get<Bs>(other) == hera::get<Ps>(row)) && ...))
+                {
+                    // the rest of the chain has the same key
+                    for (auto link = slots[pos] & 0xffffffff; link != 0;
+                         link      = next[link - 1])
+                    {
+                        emit(link - 1, begin + i);
+                    }
+                    break;
+                }
+            }
+        }
+    }
+}
+} // namespace detail
+
+/// the elements of a left row followed by the ones of a right row, as a
+/// bounded range of references into both
+template<typename LeftRef, typename RightRef>
+class joined_row : public view_interface<joined_row<LeftRef, RightRef>>
+{
+private:
+    static constexpr std::size_t left_size =
+        hera::size_v<std::remove_cvref_t<LeftRef>>;
+
+    static constexpr std::size_t right_size =
+        hera::size_v<std::remove_cvref_t<RightRef>>;
+
+    LeftRef  left_;
+    RightRef right_;
+
+public:
+    constexpr joined_row(LeftRef left, RightRef right) noexcept
+        : left_(static_cast<LeftRef>(left)), right_(static_cast<RightRef>(right))
+    {}
+
+    constexpr std::integral_constant<std::size_t, left_size + right_size>
+    size() const noexcept
+    {
+        return {};
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < left_size + right_size)
+    constexpr decltype(auto) get() const noexcept // clang-format on
+    {
+        if constexpr (I < left_size)
+        {
+            return hera::get<I>(left_);
+        }
+        else
+        {
+            return hera::get<I - left_size>(right_);
+        }
+    }
+
+    /// copies all elements into a `hera::tuple`
+    auto materialize() const
+    {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return hera::tuple<std::remove_cvref_t<decltype(get<Is>())>...>{
+                get<Is>()...};
+        }
+        (std::make_index_sequence<left_size + right_size>{});
+    }
+};
+
+/// the matches of a hash join over the rows of `Left` and `Right`
+///
+/// Only the indices of matching rows are stored, elements are read from the
+/// joined ranges when a row is accessed, so both have to outlive the view.
+template<typename Left, typename Right>
+class hash_join_view
+{
+public:
+    using left_reference  = std::ranges::range_reference_t<Left&>;
+    using right_reference = std::ranges::range_reference_t<Right&>;
+    using reference       = joined_row<left_reference, right_reference>;
+
+private:
+    Left*                   left_;
+    Right*                  right_;
+    std::vector<join_match> matches_;
+
+public:
+    hash_join_view(Left& left, Right& right, std::vector<join_match> matches)
+        : left_{std::addressof(left)},
+          right_{std::addressof(right)},
+          matches_{std::move(matches)}
+    {}
+
+    std::size_t size() const noexcept
+    {
+        return matches_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return matches_.empty();
+    }
+
+    /// the row indices of every match
+    std::span<const join_match> matches() const noexcept
+    {
+        return matches_;
+    }
+
+    reference operator[](std::size_t index) const
+    {
+        const auto match = matches_[index];
+        return {std::ranges::begin(*left_)[static_cast<
+                    std::ranges::range_difference_t<Left>>(match.left)],
+                std::ranges::begin(*right_)[static_cast<
+                    std::ranges::range_difference_t<Right>>(match.right)]};
+    }
+
+    class iterator
+    {
+    private:
+        const hash_join_view* owner_ = nullptr;
+        std::size_t           index_ = 0;
+
+    public:
+        using iterator_concept  = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = reference;
+        using difference_type   = std::ptrdiff_t;
+
+        iterator() = default;
+
+        constexpr iterator(const hash_join_view& owner,
+                           std::size_t           index) noexcept
+            : owner_{std::addressof(owner)}, index_{index}
+        {}
+
+        value_type operator*() const
+        {
+            return (*owner_)[index_];
+        }
+
+        value_type operator[](difference_type n) const
+        {
+            return (*owner_)[index_ + static_cast<std::size_t>(n)];
+        }
+
+        constexpr iterator& operator++() noexcept
+        {
+            ++index_;
+            return *this;
+        }
+
+        constexpr iterator operator++(int) noexcept
+        {
+            auto res = *this;
+            ++*this;
+            return res;
+        }
+
+        constexpr iterator& operator--() noexcept
+        {
+            --index_;
+            return *this;
+        }
+
+        constexpr iterator operator--(int) noexcept
+        {
+            auto res = *this;
+            --*this;
+            return res;
+        }
+
+        constexpr iterator& operator+=(difference_type n) noexcept
+        {
+            index_ += static_cast<std::size_t>(n);
+            return *this;
+        }
+
+        constexpr iterator& operator-=(difference_type n) noexcept
+        {
+            index_ -= static_cast<std::size_t>(n);
+            return *this;
+        }
+
+        friend constexpr iterator operator+(iterator        it,
+                                            difference_type n) noexcept
+        {
+            return it += n;
+        }
+
+        friend constexpr iterator operator+(difference_type n,
+                                            iterator        it) noexcept
+        {
+            return it += n;
+        }
+
+        friend constexpr iterator operator-(iterator        it,
+                                            difference_type n) noexcept
+        {
+            return it -= n;
+        }
+
+        friend constexpr difference_type operator-(iterator lhs,
+                                                   iterator rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs.index_) -
+                   static_cast<difference_type>(rhs.index_);
+        }
+
+        friend constexpr bool operator==(iterator lhs, iterator rhs) noexcept
+        {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend constexpr auto operator<=>(iterator lhs, iterator rhs) noexcept
+        {
+            return lhs.index_ <=> rhs.index_;
+        }
+    };
+
+    iterator begin() const noexcept
+    {
+        return {*this, 0};
+    }
+
+    iterator end() const noexcept
+    {
+        return {*this, matches_.size()};
+    }
+};
+
+/// joins the rows of `left` and `right` whose elements `LeftKeys` and
+/// `RightKeys` are equal
+///
+/// The key positions are `hera::index_sequence`s of the same length, like
+/// `hera::hash_join<hera::index_sequence<0>, hera::index_sequence<2>>(l, r)`.
+/// An open addressing table is built over the smaller side and the other one
+/// probes it in batches, prefetching the slots of a batch before looking any
+/// of them up. Returns a `hash_join_view` whose rows are `joined_row`s of the
+/// left elements followed by the right ones. Matches are ordered by the rows
+/// of the larger side.
+template<typename LeftKeys,
+         typename RightKeys,
+         std::ranges::random_access_range L,
+         std::ranges::random_access_range R> // clang-format off
+    requires std::is_lvalue_reference_v<L> &&
+             std::is_lvalue_reference_v<R> &&
+             std::ranges::sized_range<L> &&
+             std::ranges::sized_range<R> &&
+             detail::join_keys_v<L, R, LeftKeys, RightKeys>
+auto hash_join(L&& left, R&& right) // clang-format on
+{
+    std::vector<join_match> matches;
+
+    if (std::ranges::size(left) <= std::ranges::size(right))
+    {
+        detail::join_build_probe(
+            left,
+            right,
+            [&](std::size_t l, std::size_t r) {
+                matches.push_back({static_cast<std::uint32_t>(l),
+                                   static_cast<std::uint32_t>(r)});
+            },
+            LeftKeys{},
+            RightKeys{});
+    }
+    else
+    {
+        detail::join_build_probe(
+            right,
+            left,
+            [&](std::size_t r, std::size_t l) {
+                matches.push_back({static_cast<std::uint32_t>(l),
+                                   static_cast<std::uint32_t>(r)});
+            },
+            RightKeys{},
+            LeftKeys{});
+    }
+
+    return hash_join_view<std::remove_reference_t<L>,
+                          std::remove_reference_t<R>>{
+        left, right, std::move(matches)};
+}
+} // namespace hera
@@ -0,0 +1,973 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "hera/container/record.hpp"
+#include "hera/get.hpp"
+#include "hera/ranges.hpp"
+#include "hera/size.hpp"
+
+// Values are mapped onto JSON as follows:
+//  - records are objects whose members are named by the keys of the fields
+//  - other bounded ranges, like `hera::tuple` and `std::array`, as well as
+//    sized ranges, like `std::vector`, are arrays
+//  - strings, string views and single characters are strings
+//  - bool, integers and floating point numbers are literals and numbers,
+//    non finite numbers are written as null
+//  - an empty optional is null
+// While reading, members with unknown keys are skipped and fields without a
+// member keep their value.
+
+namespace hera
+{
+/// a sink JSON is written to, like `std::string`
+template<typename Out>
+concept json_output = requires(Out& out, const char* str, std::size_t n, char ch)
+{
+    out.append(str, n);
+    out.push_back(ch);
+};
+
+namespace detail
+{
+template<typename T>
+struct json_is_record : std::false_type
+{};
+
+template<typename... Fields>
+struct json_is_record<hera::record<Fields...>> : std::true_type
+{};
+
+template<typename T>
+struct json_is_optional : std::false_type
+{};
+
+template<typename T>
+struct json_is_optional<std::optional<T>> : std::true_type
+{};
+
+template<typename T>
+concept json_string = std::is_same_v<T, std::string> ||
+                      std::is_same_v<T, std::string_view>;
+
+template<typename T>
+concept json_number = // clang-format off
+    (std::is_integral_v<T> &&
+     !std::is_same_v<T, bool> &&
+     !std::is_same_v<T, char>) ||
+    std::is_floating_point_v<T>; // clang-format on
+
+template<typename T>
+concept json_sequence = // clang-format off
+    !json_string<T> &&
+    !hera::bounded_range<T> &&
+    std::ranges::input_range<const T> &&
+    std::ranges::sized_range<const T>; // clang-format on
+
+/// sequences which can be read by appending elements
+template<typename T>
+concept json_growable_sequence = // clang-format off
+    json_sequence<T> &&
+    requires(T& t)
+    {
+        t.clear();
+        { t.emplace_back() } -> std::same_as<std::ranges::range_value_t<T>&>;
+    }; // clang-format on
+
+template<typename T, bool Read>
+constexpr bool json_supported() noexcept
+{
+    if constexpr (json_is_optional<T>::value)
+    {
+        return json_supported<typename T::value_type, Read>();
+    }
+    else if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, char> ||
+                       json_string<T> || json_number<T>)
+    {
+        return true;
+    }
+    else if constexpr (hera::bounded_range<T>)
+    {
+        return []<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return (json_supported<std::remove_cvref_t<decltype(
+                                       hera::get<Is>(std::declval<T&>()))>,
+                                   Read>() &&
+                    ...);
+        }
+        (std::make_index_sequence<hera::size_v<T>>{});
+    }
+    else if constexpr (json_sequence<T>)
+    {
+        return (!Read || json_growable_sequence<T>) &&
+               json_supported<std::ranges::range_value_t<const T>, Read>();
+    }
+    else
+    {
+        return false;
+    }
+}
+
+constexpr bool json_needs_escape(char ch) noexcept
+{
+    return static_cast<unsigned char>(ch) < 0x20 || ch == '"' || ch == '\\';
+}
+
+/// writes the escape sequence of `ch` to `out` and returns its length
+constexpr std::size_t json_escape(char ch, char* out) noexcept
+{
+    char short_form = 0;
+    switch (ch)
+    {
+    case '"':
+        short_form = '"';
+        break;
+    case '\\':
+        short_form = '\\';
+        break;
+    case '\b':
+        short_form = 'b';
+        break;
+    case '\f':
+        short_form = 'f';
+        break;
+    case '\n':
+        short_form = 'n';
+        break;
+    case '\r':
+        short_form = 'r';
+        break;
+    case '\t':
+        short_form = 't';
+        break;
+    default:
+        break;
+    }
+
+    out[0] = '\\';
+    if (short_form != 0)
+    {
+        out[1] = short_form;
+        return 2;
+    }
+
+    constexpr char hex[] = "0123456789abcdef";
+    const auto     code  = static_cast<unsigned char>(ch);
+
+    out[1] = 'u';
+    out[2] = '0';
+    out[3] = '0';
+    out[4] = hex[code >> 4];
+    out[5] = hex[code & 0xf];
+    return 6;
+}
+
+constexpr std::size_t json_escaped_size(std::string_view str) noexcept
+{
+    std::size_t res = 0;
+    for (const char ch : str)
+    {
+        char buffer[6]{};
+        res += json_needs_escape(ch) ? json_escape(ch, buffer) : 1;
+    }
+
+    return res;
+}
+
+/// the text written before every member of `R`, `{"key":` for the first and
+/// `,"key":` for every other one, escaped at compile time
+template<typename R>
+struct json_key_fragments
+{
+    static constexpr auto& keys = R::keys();
+
+    static constexpr std::size_t text_size = [] {
+        std::size_t res = 0;
+        for (const auto key : keys)
+        {
+            res += 4 + json_escaped_size(key);
+        }
+        return res;
+    }();
+
+    static constexpr std::array<std::size_t, keys.size() + 1> offsets = [] {
+        std::array<std::size_t, keys.size() + 1> res{};
+        for (std::size_t i = 0; i != keys.size(); ++i)
+        {
+            res[i + 1] = res[i] + 4 + json_escaped_size(keys[i]);
+        }
+        return res;
+    }();
+
+    static constexpr std::array<char, text_size> text = [] {
+        std::array<char, text_size> res{};
+        std::size_t                 pos = 0;
+
+        for (std::size_t i = 0; i != keys.size(); ++i)
+        {
+            res[pos++] = i == 0 ? '{' : ',';
+            res[pos++] = '"';
+
+            for (const char ch : keys[i])
+            {
+                if (json_needs_escape(ch))
+                {
+                    pos += json_escape(ch, res.data() + pos);
+                }
+                else
+                {
+                    res[pos++] = ch;
+                }
+            }
+
+            res[pos++] = '"';
+            res[pos++] = ':';
+        }
+        return res;
+    }();
+};
+
+template<typename Out>
+void json_write_string(Out& out, std::string_view str)
+{
+    out.push_back('"');
+
+    // unescaped runs are appended at once
+    const char* run  = str.data();
+    const char* last = run + str.size();
+    for (const char* pos = run; pos != last; ++pos)
+    {
+        if (json_needs_escape(*pos)) [[unlikely]]
+        {
+            out.append(run, static_cast<std::size_t>(pos - run));
+
+            char buffer[6];
+            out.append(buffer, json_escape(*pos, buffer));
+            run = pos + 1;
+        }
+    }
+
+    out.append(run, static_cast<std::size_t>(last - run));
+    out.push_back('"');
+}
+
+template<typename Out, typename T>
+void json_write(Out& out, const T& value)
+{
+    if constexpr (json_is_record<T>::value)
+    {
+        using fragments = json_key_fragments<T>;
+
+        if constexpr (hera::size_v<T> == 0)
+        {
+            out.append("{}", 2);
+        }
+        else
+        {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>)
+            {
+                ((out.append(fragments::text.data() + fragments::offsets[Is],
+                             fragments::offsets[Is + 1] -
+                                 fragments::offsets[Is]),
+                  detail::json_write(out, value.template get<Is>())),
+                 ...);
+            }
+            (std::make_index_sequence<hera::size_v<T>>{});
+
+            out.push_back('}');
+        }
+    }
+    else if constexpr (json_is_optional<T>::value)
+    {
+        if (value)
+        {
+            detail::json_write(out, *value);
+        }
+        else
+        {
+            out.append("null", 4);
+        }
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+        value ? out.append("true", 4) : out.append("false", 5);
+    }
+    else if constexpr (std::is_same_v<T, char>)
+    {
+        detail::json_write_string(out, std::string_view{&value, 1});
+    }
+    else if constexpr (json_string<T>)
+    {
+        detail::json_write_string(out, value);
+    }
+    else if constexpr (json_number<T>)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            if (!std::isfinite(value))
+            {
+                out.append("null", 4);
+                return;
+            }
+        }
+
+        // the shortest representation which reads back to the same value
+        char buffer[64];
+        const auto res = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, static_cast<std::size_t>(res.ptr - buffer));
+    }
+    else if constexpr (hera::bounded_range<T>)
+    {
+        out.push_back('[');
+        [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            ((Is != 0 ? out.push_back(',') : void(),
+              detail::json_write(out, hera::get<Is>(value))),
+             ...);
+        }
+        (std::make_index_sequence<hera::size_v<T>>{});
+        out.push_back(']');
+    }
+    else
+    {
+        out.push_back('[');
+
+        bool first = true;
+        for (const auto& element : value)
+        {
+            if (!first)
+            {
+                out.push_back(',');
+            }
+            first = false;
+
+            detail::json_write(out, element);
+        }
+
+        out.push_back(']');
+    }
+}
+
+constexpr bool json_hex4(const char* str, unsigned& out) noexcept
+{
+    out = 0;
+    for (int i = 0; i != 4; ++i)
+    {
+        const char ch = str[i];
+        unsigned   digit;
+
+        if (ch >= '0' && ch <= '9')
+        {
+            digit = static_cast<unsigned>(ch - '0');
+        }
+        else if (ch >= 'a' && ch <= 'f')
+        {
+            digit = static_cast<unsigned>(ch - 'a' + 10);
+        }
+        else if (ch >= 'A' && ch <= 'F')
+        {
+            digit = static_cast<unsigned>(ch - 'A' + 10);
+        }
+        else
+        {
+            return false;
+        }
+
+        out = out * 16 + digit;
+    }
+
+    return true;
+}
+
+/// replaces the escape sequences of `raw` and writes the result to `out`
+///
+/// The result is never longer than `raw`, `size` receives its length.
+constexpr bool
+json_unescape(std::string_view raw, char* out, std::size_t& size) noexcept
+{
+    std::size_t n = 0;
+
+    for (std::size_t i = 0; i != raw.size(); ++i)
+    {
+        if (raw[i] != '\\')
+        {
+            out[n++] = raw[i];
+            continue;
+        }
+
+        if (++i == raw.size())
+        {
+            return false;
+        }
+
+        switch (raw[i])
+        {
+        case '"':
+        case '\\':
+        case '/':
+            out[n++] = raw[i];
+            continue;
+        case 'b':
+            out[n++] = '\b';
+            continue;
+        case 'f':
+            out[n++] = '\f';
+            continue;
+        case 'n':
+            out[n++] = '\n';
+            continue;
+        case 'r':
+            out[n++] = '\r';
+            continue;
+        case 't':
+            out[n++] = '\t';
+            continue;
+        case 'u':
+            break;
+        default:
+            return false;
+        }
+
+        unsigned code;
+        if (raw.size() - i < 5 || !json_hex4(raw.data() + i + 1, code))
+        {
+            return false;
+        }
+        i += 4;
+
+        if (code >= 0xdc00 && code < 0xe000)
+        {
+            // a low surrogate without a high one
+            return false;
+        }
+
+        if (code >= 0xd800 && code < 0xdc00)
+        {
+            unsigned low;
+            if (raw.size() - i < 7 || raw[i + 1] != '\\' || raw[i + 2] != 'u' ||
+                !json_hex4(raw.data() + i + 3, low) || low < 0xdc00 ||
+                low >= 0xe000)
+            {
+                return false;
+            }
+            i += 6;
+
+            code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+        }
+
+        // UTF-8
+        if (code < 0x80)
+        {
+            out[n++] = static_cast<char>(code);
+        }
+        else if (code < 0x800)
+        {
+            out[n++] = static_cast<char>(0xc0 | (code >> 6));
+            out[n++] = static_cast<char>(0x80 | (code & 0x3f));
+        }
+        else if (code < 0x10000)
+        {
+            out[n++] = static_cast<char>(0xe0 | (code >> 12));
+            out[n++] = static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+            out[n++] = static_cast<char>(0x80 | (code & 0x3f));
+        }
+        else
+        {
+            out[n++] = static_cast<char>(0xf0 | (code >> 18));
+            out[n++] = static_cast<char>(0x80 | ((code >> 12) & 0x3f));
+            out[n++] = static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+            out[n++] = static_cast<char>(0x80 | (code & 0x3f));
+        }
+    }
+
+    size = n;
+    return true;
+}
+
+/// reads JSON text straight into typed values
+///
+/// There is no intermediate document, object keys are matched against the
+/// fields of a record by its perfect hash and dispatched through a jump table.
+/// Keys are only copied if they contain escape sequences, into a buffer on
+/// the stack.
+class json_parser
+{
+private:
+    const char* pos_;
+    const char* last_;
+
+    struct string_token
+    {
+        /// the contents between the quotes, escape sequences included
+        std::string_view raw;
+        bool             escaped;
+    };
+
+    void skip_whitespace() noexcept
+    {
+        while (pos_ != last_ &&
+               (*pos_ == ' ' || *pos_ == '\n' || *pos_ == '\r' || *pos_ == '\t'))
+        {
+            ++pos_;
+        }
+    }
+
+    bool consume(char ch) noexcept
+    {
+        skip_whitespace();
+
+        if (pos_ != last_ && *pos_ == ch)
+        {
+            ++pos_;
+            return true;
+        }
+
+        return false;
+    }
+
+    bool consume(std::string_view literal) noexcept
+    {
+        skip_whitespace();
+
+        if (static_cast<std::size_t>(last_ - pos_) >= literal.size() &&
+            std::memcmp(pos_, literal.data(), literal.size()) == 0)
+        {
+            pos_ += literal.size();
+            return true;
+        }
+
+        return false;
+    }
+
+    std::optional<string_token> next_string() noexcept
+    {
+        if (!consume('"'))
+        {
+            return std::nullopt;
+        }
+
+        const char* first   = pos_;
+        bool        escaped = false;
+
+        while (pos_ != last_)
+        {
+            const char ch = *pos_;
+
+            if (ch == '"')
+            {
+                return string_token{
+                    {first, static_cast<std::size_t>(pos_++ - first)}, escaped};
+            }
+
+            if (ch == '\\')
+            {
+                escaped = true;
+                ++pos_;
+            }
+            else if (static_cast<unsigned char>(ch) < 0x20)
+            {
+                return std::nullopt;
+            }
+
+            if (pos_ != last_)
+            {
+                ++pos_;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    /// the characters of a number or literal, not validated yet
+    std::string_view next_bare_token() noexcept
+    {
+        skip_whitespace();
+
+        const char* first = pos_;
+        while (pos_ != last_ &&
+               ((*pos_ >= '0' && *pos_ <= '9') ||
+                (*pos_ >= 'a' && *pos_ <= 'z') || *pos_ == '-' ||
+                *pos_ == '+' || *pos_ == '.' || *pos_ == 'E'))
+        {
+            ++pos_;
+        }
+
+        return {first, static_cast<std::size_t>(pos_ - first)};
+    }
+
+    template<typename T>
+    bool read_number(T& out) noexcept
+    {
+        const auto token = next_bare_token();
+
+        // from_chars would accept "inf" and "nan"
+        if (token.empty() ||
+            !(token[0] == '-' || (token[0] >= '0' && token[0] <= '9')))
+        {
+            return false;
+        }
+
+        const auto* last = token.data() + token.size();
+        const auto [ptr, ec] = std::from_chars(token.data(), last, out);
+
+        return ec == std::errc{} && ptr == last;
+    }
+
+    /// skips over any value, nested values are only checked lexically
+    bool skip_value() noexcept
+    {
+        std::size_t depth = 0;
+
+        while (true)
+        {
+            skip_whitespace();
+            if (pos_ == last_)
+            {
+                return false;
+            }
+
+            const char ch = *pos_;
+            if (ch == '{' || ch == '[')
+            {
+                ++depth;
+                ++pos_;
+                continue;
+            }
+            else if (ch == ',' || ch == ':')
+            {
+                if (depth == 0)
+                {
+                    return false;
+                }
+
+                ++pos_;
+                continue;
+            }
+            else if (ch == '}' || ch == ']')
+            {
+                if (depth == 0)
+                {
+                    return false;
+                }
+
+                --depth;
+                ++pos_;
+            }
+            else if (ch == '"')
+            {
+                if (!next_string())
+                {
+                    return false;
+                }
+            }
+            else if (next_bare_token().empty())
+            {
+                return false;
+            }
+
+            if (depth == 0)
+            {
+                return true;
+            }
+        }
+    }
+
+    /// the index of the field of `R` named `key`, npos if there is none
+    template<typename R>
+    static bool key_index(const string_token& key, std::size_t& index) noexcept
+    {
+        if (!key.escaped) [[likely]]
+        {
+            index = R::index_of(key.raw);
+            return true;
+        }
+
+        constexpr std::size_t longest_key = [] {
+            std::size_t res = 0;
+            for (const auto k : R::keys())
+            {
+                res = k.size() > res ? k.size() : res;
+            }
+            return res;
+        }();
+
+        // every character of a key may be spelled as "\uXXXX"
+        char        buffer[6 * longest_key + 1];
+        std::size_t size = 0;
+
+        if (key.raw.size() > sizeof(buffer))
+        {
+            // too long to be a key, its escapes are skipped like those of an
+            // unknown value
+            index = R::npos;
+            return true;
+        }
+
+        if (!detail::json_unescape(key.raw, buffer, size))
+        {
+            return false;
+        }
+
+        index = R::index_of(std::string_view{buffer, size});
+        return true;
+    }
+
+    template<typename R, std::size_t... Is>
+    bool read_field(R& out, std::size_t index, std::index_sequence<Is...>)
+    {
+        using fn_ptr = bool (*)(json_parser&, R&);
+
+        static constexpr fn_ptr table[]{+[](json_parser& parser, R& r) {
+            return parser.read(r.template get<Is>());
+        }...};
+
+        return table[index](*this, out);
+    }
+
+    template<typename R>
+    bool read_object(R& out)
+    {
+        if (!consume('{'))
+        {
+            return false;
+        }
+
+        if (consume('}'))
+        {
+            return true;
+        }
+
+        do
+        {
+            const auto  key = next_string();
+            std::size_t index;
+
+            if (!key || !consume(':') || !key_index<R>(*key, index))
+            {
+                return false;
+            }
+
+            if constexpr (hera::size_v<R> == 0)
+            {
+                if (!skip_value())
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                const bool ok =
+                    index == R::npos
+                        ? skip_value()
+                        : read_field(out,
+                                     index,
+                                     std::make_index_sequence<hera::size_v<R>>{});
+                if (!ok)
+                {
+                    return false;
+                }
+            }
+        } while (consume(','));
+
+        return consume('}');
+    }
+
+public:
+    constexpr explicit json_parser(std::string_view text) noexcept
+        : pos_{text.data()}, last_{text.data() + text.size()}
+    {}
+
+    template<typename T>
+    bool read(T& out)
+    {
+        if constexpr (json_is_record<T>::value)
+        {
+            return read_object(out);
+        }
+        else if constexpr (json_is_optional<T>::value)
+        {
+            if (consume(std::string_view{"null"}))
+            {
+                out.reset();
+                return true;
+            }
+
+            return read(out.emplace());
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            if (consume(std::string_view{"true"}))
+            {
+                out = true;
+                return true;
+            }
+
+            if (consume(std::string_view{"false"}))
+            {
+                out = false;
+                return true;
+            }
+
+            return false;
+        }
+        else if constexpr (std::is_same_v<T, char> || json_string<T>)
+        {
+            const auto token = next_string();
+            if (!token)
+            {
+                return false;
+            }
+
+            if constexpr (std::is_same_v<T, std::string_view>)
+            {
+                // views can only refer to unescaped text
+                out = token->raw;
+                return !token->escaped;
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                if (!token->escaped)
+                {
+                    out.assign(token->raw);
+                    return true;
+                }
+
+                std::size_t size = 0;
+                out.resize(token->raw.size());
+                if (!detail::json_unescape(token->raw, out.data(), size))
+                {
+                    return false;
+                }
+
+                out.resize(size);
+                return true;
+            }
+            else
+            {
+                // the longest escape of a single byte
+                char        buffer[6];
+                std::size_t size = 0;
+
+                if (token->raw.size() > sizeof(buffer) ||
+                    !detail::json_unescape(token->raw, buffer, size) ||
+                    size != 1)
+                {
+                    return false;
+                }
+
+                out = buffer[0];
+                return true;
+            }
+        }
+        else if constexpr (json_number<T>)
+        {
+            return read_number(out);
+        }
+        else if constexpr (hera::bounded_range<T>)
+        {
+            if (!consume('['))
+            {
+                return false;
+            }
+
+            return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+            {
+                return (((Is == 0 || consume(',')) && read(hera::get<Is>(out))) &&
+                        ...);
+            }
+            (std::make_index_sequence<hera::size_v<T>>{}) &&
+                consume(']');
+        }
+        else
+        {
+            out.clear();
+
+            if (!consume('['))
+            {
+                return false;
+            }
+
+            if (consume(']'))
+            {
+                return true;
+            }
+
+            do
+            {
+                if (!read(out.emplace_back()))
+                {
+                    return false;
+                }
+            } while (consume(','));
+
+            return consume(']');
+        }
+    }
+
+    /// whether only whitespace is left
+    bool done() noexcept
+    {
+        skip_whitespace();
+        return pos_ == last_;
+    }
+};
+} // namespace detail
+
+template<typename T>
+concept json_serializable = detail::json_supported<T, false>();
+
+template<typename T>
+concept json_deserializable = detail::json_supported<T, true>();
+
+/// appends `value` to `out` as JSON
+template<hera::json_output Out, hera::json_serializable T>
+void write_json(Out& out, const T& value)
+{
+    detail::json_write(out, value);
+}
+
+template<hera::json_serializable T>
+std::string to_json(const T& value)
+{
+    std::string res;
+    detail::json_write(res, value);
+    return res;
+}
+
+/// reads the single value in `text` into `out`
+///
+/// String views refer into `text` and can't hold strings with escape
+/// sequences. Returns false if `text` isn't valid JSON or doesn't match the
+/// type of `out`, which may be partially assigned then.
+template<hera::json_deserializable T>
+bool read_json(std::string_view text, T& out)
+{
+    detail::json_parser parser{text};
+    return parser.read(out) && parser.done();
+}
+
+template<hera::json_deserializable T>
+std::optional<T> from_json(std::string_view text)
+{
+    std::optional<T> res{std::in_place};
+
+    if (!hera::read_json(text, *res))
+    {
+        res.reset();
+    }
+
+    return res;
+}
+} // namespace hera
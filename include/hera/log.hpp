@@ -0,0 +1,832 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "hera/algorithm/unpack.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/container/type_list.hpp"
+#include "hera/format.hpp"
+#include "hera/utility/detail/hash.hpp"
+#include "hera/utility/detail/log_ring.hpp"
+
+namespace hera
+{
+/// how an argument is stored in a log record
+enum class log_arg_kind : std::uint8_t
+{
+    i8,
+    i16,
+    i32,
+    i64,
+    u8,
+    u16,
+    u32,
+    u64,
+    f32,
+    f64,
+    character,
+    boolean,
+    // a 32 bit length followed by the characters after all fixed size fields
+    text,
+};
+
+namespace detail
+{
+template<typename T>
+concept log_encodable =
+    (format_integer<T> && sizeof(T) <= 8) || std::same_as<T, float> || std::same_as<T, double> ||
+    format_char<T> || format_bool<T> || format_text<T>;
+
+template<typename T>
+constexpr log_arg_kind log_kind_of() noexcept
+{
+    if constexpr (format_integer<T>)
+    {
+        constexpr log_arg_kind kinds[2][4]{
+            {log_arg_kind::u8, log_arg_kind::u16, log_arg_kind::u32, log_arg_kind::u64},
+            {log_arg_kind::i8, log_arg_kind::i16, log_arg_kind::i32, log_arg_kind::i64}};
+
+        return kinds[std::is_signed_v<T>][std::countr_zero(sizeof(T))];
+    }
+    else if constexpr (std::same_as<T, float>)
+    {
+        return log_arg_kind::f32;
+    }
+    else if constexpr (std::same_as<T, double>)
+    {
+        return log_arg_kind::f64;
+    }
+    else if constexpr (format_char<T>)
+    {
+        return log_arg_kind::character;
+    }
+    else if constexpr (format_bool<T>)
+    {
+        return log_arg_kind::boolean;
+    }
+    else
+    {
+        return log_arg_kind::text;
+    }
+}
+
+constexpr std::size_t log_fixed_size(log_arg_kind kind) noexcept
+{
+    switch (kind)
+    {
+    case log_arg_kind::i16:
+    case log_arg_kind::u16:
+        return 2;
+    case log_arg_kind::i32:
+    case log_arg_kind::u32:
+    case log_arg_kind::f32:
+    case log_arg_kind::text:
+        return 4;
+    case log_arg_kind::i64:
+    case log_arg_kind::u64:
+    case log_arg_kind::f64:
+        return 8;
+    default:
+        return 1;
+    }
+}
+
+template<typename T>
+using log_decoded_t = std::conditional_t<format_text<T>, std::string_view, T>;
+
+template<typename List>
+struct log_layout;
+
+/// the encoding of a record's arguments, fixed size fields are packed at
+/// offsets known at compile time and followed by the characters of text
+/// arguments
+template<typename... Ts>
+struct log_layout<hera::type_list<Ts...>>
+{
+    static constexpr std::array<log_arg_kind, sizeof...(Ts)> kinds{
+        detail::log_kind_of<Ts>()...};
+
+    static constexpr auto offsets = [] {
+        std::array<std::size_t, sizeof...(Ts)> result{};
+        std::size_t                            offset = 0;
+
+        for (std::size_t i = 0; i < kinds.size(); ++i)
+        {
+            result[i] = offset;
+            offset += detail::log_fixed_size(kinds[i]);
+        }
+
+        return result;
+    }();
+
+    static constexpr std::size_t fixed_size =
+        (std::size_t{0} + ... + detail::log_fixed_size(detail::log_kind_of<Ts>()));
+
+    static std::size_t size(const Ts&... args) noexcept
+    {
+        std::size_t result = fixed_size;
+
+        const auto add = [&]<typename T>(const T& arg) {
+            if constexpr (format_text<T>)
+            {
+                result += static_cast<std::string_view>(arg).size();
+            }
+        };
+
+        (add(args), ...);
+        return result;
+    }
+
+    static void encode(std::byte* out, const Ts&... args) noexcept
+    {
+        encode_impl(out, std::index_sequence_for<Ts...>{}, args...);
+    }
+
+    static hera::tuple<log_decoded_t<Ts>...> decode(const std::byte* in) noexcept
+    {
+        return decode_impl(in, std::index_sequence_for<Ts...>{});
+    }
+
+private:
+    template<std::size_t... Is>
+    static void
+    encode_impl(std::byte* out, std::index_sequence<Is...>, const Ts&... args) noexcept
+    {
+        std::byte* text = out + fixed_size;
+
+        const auto encode_one = [&]<typename T>(std::size_t offset, const T& arg) {
+            if constexpr (format_text<T>)
+            {
+                const auto str    = static_cast<std::string_view>(arg);
+                const auto length = static_cast<std::uint32_t>(str.size());
+
+                std::memcpy(out + offset, &length, sizeof(length));
+                std::memcpy(text, str.data(), str.size());
+                text += str.size();
+            }
+            else
+            {
+                std::memcpy(out + offset, &arg, sizeof(T));
+            }
+        };
+
+        (encode_one(offsets[Is], args), ...);
+    }
+
+    template<typename T>
+    static log_decoded_t<T>
+    decode_one(const std::byte* in, std::size_t offset, const std::byte*& text) noexcept
+    {
+        if constexpr (format_text<T>)
+        {
+            std::uint32_t length;
+            std::memcpy(&length, in + offset, sizeof(length));
+
+            const auto* first = reinterpret_cast<const char*>(text);
+            text += length;
+            return std::string_view(first, length);
+        }
+        else
+        {
+            T value;
+            std::memcpy(&value, in + offset, sizeof(T));
+            return value;
+        }
+    }
+
+    template<std::size_t... Is>
+    static hera::tuple<log_decoded_t<Ts>...>
+    decode_impl(const std::byte* in, std::index_sequence<Is...>) noexcept
+    {
+        const std::byte* text = in + fixed_size;
+
+        // braced initialization evaluates the text fields in order
+        return hera::tuple<log_decoded_t<Ts>...>{
+            decode_one<Ts>(in, offsets[Is], text)...};
+    }
+};
+
+/// everything the backend needs to know about one log statement
+struct log_descriptor
+{
+    std::uint64_t       id;
+    std::string_view    format;
+    const log_arg_kind* kinds;
+    std::size_t         arity;
+    // appends the formatted record to `out`
+    void (*write)(const std::byte* payload, std::string& out);
+};
+
+constexpr std::uint64_t log_format_id(std::string_view          format,
+                                      const log_arg_kind*       kinds,
+                                      std::size_t               arity) noexcept
+{
+    auto hash = detail::fnv1a(format);
+
+    for (std::size_t i = 0; i < arity; ++i)
+    {
+        hash ^= static_cast<std::uint64_t>(kinds[i]) + 1;
+        hash *= fnv1a_prime;
+    }
+
+    return hash;
+}
+
+template<auto Fmt, typename... Ts>
+struct log_site
+{
+    using layout = log_layout<hera::type_list<Ts...>>;
+
+    static void write(const std::byte* payload, std::string& out)
+    {
+        hera::unpack(layout::decode(payload), [&](const auto&... args) {
+            const auto offset = out.size();
+            out.resize(offset + hera::format_size_hint<Fmt>(args...));
+
+            char* last = hera::format_to<Fmt>(out.data() + offset, args...);
+            out.resize(static_cast<std::size_t>(last - out.data()));
+        });
+    }
+
+    static constexpr log_descriptor descriptor{
+        detail::log_format_id(
+            format_string_v<Fmt>, layout::kinds.data(), sizeof...(Ts)),
+        format_string_v<Fmt>,
+        layout::kinds.data(),
+        sizeof...(Ts),
+        &write};
+};
+
+class log_registry
+{
+private:
+    std::mutex                             mutex_;
+    std::vector<std::shared_ptr<log_ring>> rings_;
+
+public:
+    std::atomic<int>           consumers{0};
+    std::atomic<std::uint64_t> dropped{0};
+
+    static log_registry& instance()
+    {
+        static log_registry registry;
+        return registry;
+    }
+
+    std::shared_ptr<log_ring> add()
+    {
+        auto ring = std::make_shared<log_ring>();
+
+        std::lock_guard lock{mutex_};
+        rings_.push_back(ring);
+        return ring;
+    }
+
+    /// the current rings, rings of finished threads are dropped once empty
+    std::vector<std::shared_ptr<log_ring>> snapshot()
+    {
+        std::lock_guard lock{mutex_};
+
+        std::erase_if(rings_, [](const auto& ring) {
+            return ring->closed() && ring->empty();
+        });
+
+        return rings_;
+    }
+};
+
+inline log_ring& thread_log_ring()
+{
+    thread_local struct owner
+    {
+        std::shared_ptr<log_ring> ring = log_registry::instance().add();
+
+        ~owner()
+        {
+            ring->close();
+        }
+    } owner;
+
+    return *owner.ring;
+}
+
+// the binary format, all integers in host byte order:
+//   magic
+//   ('D' id:u64 format-size:u32 format arity:u32 kinds:u8[arity]
+//   |'R' id:u64 payload-size:u32 payload)*
+inline constexpr std::string_view log_magic{"HERALOG\x01", 8};
+
+inline void append_log_value(std::string& out, const format_spec& spec, auto value)
+{
+    const auto offset = out.size();
+    out.resize(offset + detail::format_bound(spec, value));
+
+    char* last = detail::format_arg_to(out.data() + offset, value, spec);
+    out.resize(static_cast<std::size_t>(last - out.data()));
+}
+
+/// whether `kind` is a known kind whose values `spec` can format
+inline bool log_kind_accepts(log_arg_kind kind, const format_spec& spec) noexcept
+{
+    switch (kind)
+    {
+    case log_arg_kind::i8:
+        return detail::format_accepts<std::int8_t>(spec);
+    case log_arg_kind::i16:
+        return detail::format_accepts<std::int16_t>(spec);
+    case log_arg_kind::i32:
+        return detail::format_accepts<std::int32_t>(spec);
+    case log_arg_kind::i64:
+        return detail::format_accepts<std::int64_t>(spec);
+    case log_arg_kind::u8:
+        return detail::format_accepts<std::uint8_t>(spec);
+    case log_arg_kind::u16:
+        return detail::format_accepts<std::uint16_t>(spec);
+    case log_arg_kind::u32:
+        return detail::format_accepts<std::uint32_t>(spec);
+    case log_arg_kind::u64:
+        return detail::format_accepts<std::uint64_t>(spec);
+    case log_arg_kind::f32:
+        return detail::format_accepts<float>(spec);
+    case log_arg_kind::f64:
+        return detail::format_accepts<double>(spec);
+    case log_arg_kind::character:
+        return detail::format_accepts<char>(spec);
+    case log_arg_kind::boolean:
+        return detail::format_accepts<bool>(spec);
+    case log_arg_kind::text:
+        return detail::format_accepts<std::string_view>(spec);
+    }
+
+    return false;
+}
+
+/// a statement read from a binary log, checked once when it's read
+struct log_statement
+{
+    std::string               format;
+    std::vector<log_arg_kind> kinds;
+    std::vector<format_piece> pieces;
+    std::size_t               fixed = 0;
+
+    /// parses `format`, false if it doesn't match `kinds`
+    bool prepare()
+    {
+        auto parsed = detail::parse_format(format);
+        if (!parsed.valid)
+        {
+            return false;
+        }
+
+        for (const auto& piece : parsed.pieces)
+        {
+            if (piece.is_slot && (piece.arg >= kinds.size() ||
+                                  !detail::log_kind_accepts(kinds[piece.arg],
+                                                            piece.spec)))
+            {
+                return false;
+            }
+        }
+
+        fixed = 0;
+        for (const auto kind : kinds)
+        {
+            if (kind > log_arg_kind::text)
+            {
+                return false;
+            }
+
+            fixed += detail::log_fixed_size(kind);
+        }
+
+        pieces = std::move(parsed.pieces);
+        return true;
+    }
+};
+
+/// formats a record whose layout is only known at runtime, as done when
+/// decoding binary logs, returns false if `size` doesn't match the record
+inline bool format_log_payload(const log_statement& statement,
+                               const std::byte*     payload,
+                               std::size_t          size,
+                               std::string&         out)
+{
+    const auto& kinds = statement.kinds;
+
+    if (size < statement.fixed)
+    {
+        return false;
+    }
+
+    std::vector<std::size_t>      offsets(kinds.size());
+    std::vector<std::string_view> texts(kinds.size());
+
+    std::size_t fixed = 0;
+    for (std::size_t i = 0; i < kinds.size(); ++i)
+    {
+        offsets[i] = fixed;
+        fixed += detail::log_fixed_size(kinds[i]);
+    }
+
+    const auto* text      = reinterpret_cast<const char*>(payload + fixed);
+    std::size_t remaining = size - fixed;
+    for (std::size_t i = 0; i < kinds.size(); ++i)
+    {
+        if (kinds[i] == log_arg_kind::text)
+        {
+            std::uint32_t length;
+            std::memcpy(&length, payload + offsets[i], sizeof(length));
+            if (length > remaining)
+            {
+                return false;
+            }
+
+            texts[i] = std::string_view(text, length);
+            text += length;
+            remaining -= length;
+        }
+    }
+
+    if (remaining != 0)
+    {
+        return false;
+    }
+
+    const auto read = [&]<typename T>(std::size_t arg) {
+        T value;
+        std::memcpy(&value, payload + offsets[arg], sizeof(T));
+        return value;
+    };
+
+    const std::string_view format = statement.format;
+
+    for (const auto& piece : statement.pieces)
+    {
+        if (!piece.is_slot)
+        {
+            out.append(format.substr(piece.offset, piece.length));
+            continue;
+        }
+
+        const auto  arg  = piece.arg;
+        const auto& spec = piece.spec;
+
+        switch (kinds[arg])
+        {
+        case log_arg_kind::i8:
+            append_log_value(out, spec, read.template operator()<std::int8_t>(arg));
+            break;
+        case log_arg_kind::i16:
+            append_log_value(out, spec, read.template operator()<std::int16_t>(arg));
+            break;
+        case log_arg_kind::i32:
+            append_log_value(out, spec, read.template operator()<std::int32_t>(arg));
+            break;
+        case log_arg_kind::i64:
+            append_log_value(out, spec, read.template operator()<std::int64_t>(arg));
+            break;
+        case log_arg_kind::u8:
+            append_log_value(out, spec, read.template operator()<std::uint8_t>(arg));
+            break;
+        case log_arg_kind::u16:
+            append_log_value(out, spec, read.template operator()<std::uint16_t>(arg));
+            break;
+        case log_arg_kind::u32:
+            append_log_value(out, spec, read.template operator()<std::uint32_t>(arg));
+            break;
+        case log_arg_kind::u64:
+            append_log_value(out, spec, read.template operator()<std::uint64_t>(arg));
+            break;
+        case log_arg_kind::f32:
+            append_log_value(out, spec, read.template operator()<float>(arg));
+            break;
+        case log_arg_kind::f64:
+            append_log_value(out, spec, read.template operator()<double>(arg));
+            break;
+        case log_arg_kind::character:
+            append_log_value(out, spec, read.template operator()<char>(arg));
+            break;
+        case log_arg_kind::boolean:
+            // any byte, not only the two values of a `bool`
+            append_log_value(
+                out, spec, read.template operator()<std::uint8_t>(arg) != 0);
+            break;
+        case log_arg_kind::text:
+            append_log_value(out, spec, texts[arg]);
+            break;
+        }
+    }
+
+    return true;
+}
+} // namespace detail
+
+/// logs a message without formatting it on the calling thread
+///
+/// Only the raw bytes of the arguments and a pointer to the statement's
+/// descriptor are copied into a lock free buffer owned by the calling thread,
+/// a `log_backend` formats them in the background. The encoding of the
+/// arguments is fixed at compile time by their types, text arguments are
+/// copied. If the buffer is full the call waits for a running backend or,
+/// without one, drops the message.
+template<auto Fmt, typename... Args> // clang-format off
+    requires hera::format_string_for<Fmt, Args...> &&
+        (detail::log_encodable<std::remove_cvref_t<Args>> && ...)
+void log(const Args&... args) noexcept // clang-format on
+{
+    using site   = detail::log_site<Fmt, std::remove_cvref_t<Args>...>;
+    using layout = typename site::layout;
+
+    const auto payload = layout::size(args...);
+    const auto size    = detail::log_record_size(payload);
+
+    auto& registry = detail::log_registry::instance();
+
+    if (size > detail::log_ring::capacity)
+    {
+        registry.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    auto&      ring = detail::thread_log_ring();
+    std::byte* out  = ring.reserve(size);
+
+    while (out == nullptr)
+    {
+        if (registry.consumers.load(std::memory_order_relaxed) == 0)
+        {
+            registry.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        std::this_thread::yield();
+        out = ring.reserve(size);
+    }
+
+    const detail::log_record_header header{
+        &site::descriptor, static_cast<std::uint32_t>(payload), 0};
+
+    std::memcpy(out, &header, sizeof(header));
+    layout::encode(out + sizeof(header), args...);
+
+    ring.commit();
+}
+
+/// number of messages dropped because no backend emptied the buffers
+inline std::uint64_t log_dropped() noexcept
+{
+    return detail::log_registry::instance().dropped.load(
+        std::memory_order_relaxed);
+}
+
+enum class log_output
+{
+    /// one formatted line per message
+    text,
+    /// the raw records, see `log_decode`
+    binary,
+};
+
+/// formats the messages of all threads on a background thread
+///
+/// Only one backend should run at a time. Messages of one thread are written
+/// in order, messages of different threads are not ordered.
+class log_backend
+{
+private:
+    std::FILE* out_;
+    log_output output_;
+
+    std::atomic<bool>          stop_{false};
+    std::atomic<std::uint64_t> passes_{0};
+
+    std::unordered_set<const detail::log_descriptor*> known_;
+    std::string                                       buffer_;
+
+    std::thread thread_;
+
+public:
+    explicit log_backend(std::FILE* out, log_output output = log_output::text)
+        : out_{out}, output_{output}
+    {
+        if (output_ == log_output::binary)
+        {
+            std::fwrite(detail::log_magic.data(), 1, detail::log_magic.size(), out_);
+        }
+
+        detail::log_registry::instance().consumers.fetch_add(1);
+        thread_ = std::thread{[this] { run(); }};
+    }
+
+    log_backend(const log_backend&) = delete;
+    log_backend& operator=(const log_backend&) = delete;
+
+    /// writes all pending messages before returning
+    ~log_backend()
+    {
+        stop_.store(true);
+        thread_.join();
+        detail::log_registry::instance().consumers.fetch_sub(1);
+    }
+
+    /// blocks until the messages logged before the call are written
+    void flush() const
+    {
+        // a complete pass has to start after this call
+        const auto target = passes_.load() + 2;
+
+        while (passes_.load() < target)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    void run()
+    {
+        while (!stop_.load())
+        {
+            if (!drain())
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds{100});
+            }
+
+            passes_.fetch_add(1);
+        }
+
+        drain();
+        passes_.fetch_add(1);
+    }
+
+    bool drain()
+    {
+        bool any = false;
+
+        for (const auto& ring : detail::log_registry::instance().snapshot())
+        {
+            any |= ring->consume(
+                [this](const detail::log_record_header& header,
+                       const std::byte*                 payload) {
+                    if (output_ == log_output::text)
+                    {
+                        header.descriptor->write(payload, buffer_);
+                        buffer_ += '\n';
+                    }
+                    else
+                    {
+                        write_binary(header, payload);
+                    }
+                });
+
+            std::fwrite(buffer_.data(), 1, buffer_.size(), out_);
+            buffer_.clear();
+        }
+
+        if (any)
+        {
+            std::fflush(out_);
+        }
+
+        return any;
+    }
+
+    template<typename T>
+    void append(const T& value)
+    {
+        buffer_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void write_binary(const detail::log_record_header& header,
+                      const std::byte*                 payload)
+    {
+        const auto& descriptor = *header.descriptor;
+
+        if (known_.insert(&descriptor).second)
+        {
+            buffer_ += 'D';
+            append(descriptor.id);
+            append(static_cast<std::uint32_t>(descriptor.format.size()));
+            buffer_.append(descriptor.format);
+            append(static_cast<std::uint32_t>(descriptor.arity));
+            buffer_.append(reinterpret_cast<const char*>(descriptor.kinds),
+                           descriptor.arity);
+        }
+
+        buffer_ += 'R';
+        append(descriptor.id);
+        append(header.size);
+        buffer_.append(reinterpret_cast<const char*>(payload), header.size);
+    }
+};
+
+/// turns a binary log written by a `log_backend` into text, returns false if
+/// the input is malformed
+inline bool log_decode(std::FILE* in, std::FILE* out)
+{
+    const auto read = [&](void* data, std::size_t size) {
+        return std::fread(data, 1, size, in) == size;
+    };
+
+    // grows with the bytes actually read, a corrupt size fails at the end of
+    // the input instead of allocating all of it up front
+    const auto read_sized = [&](auto& buffer, std::size_t size) {
+        constexpr std::size_t chunk = std::size_t{1} << 16;
+
+        buffer.clear();
+        while (buffer.size() != size)
+        {
+            const auto offset = buffer.size();
+            const auto count  = size - offset < chunk ? size - offset : chunk;
+
+            buffer.resize(offset + count);
+            if (!read(buffer.data() + offset, count))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    char magic[8];
+    if (!read(magic, sizeof(magic)) ||
+        std::string_view(magic, sizeof(magic)) != detail::log_magic)
+    {
+        return false;
+    }
+
+    std::unordered_map<std::uint64_t, detail::log_statement> dictionary;
+    std::vector<std::byte>                                   payload;
+    std::string                                              line;
+
+    for (char tag; read(&tag, 1);)
+    {
+        std::uint64_t id;
+        std::uint32_t size;
+
+        if (!read(&id, sizeof(id)) || !read(&size, sizeof(size)))
+        {
+            return false;
+        }
+
+        if (tag == 'D')
+        {
+            detail::log_statement statement;
+
+            std::uint32_t arity;
+            if (!read_sized(statement.format, size) ||
+                !read(&arity, sizeof(arity)))
+            {
+                return false;
+            }
+
+            if (!read_sized(statement.kinds, arity) || !statement.prepare())
+            {
+                return false;
+            }
+
+            dictionary[id] = std::move(statement);
+        }
+        else if (tag == 'R')
+        {
+            const auto it = dictionary.find(id);
+            if (it == dictionary.end() || !read_sized(payload, size))
+            {
+                return false;
+            }
+
+            line.clear();
+            if (!detail::format_log_payload(
+                    it->second, payload.data(), size, line))
+            {
+                return false;
+            }
+            line += '\n';
+
+            std::fwrite(line.data(), 1, line.size(), out);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+} // namespace hera
@@ -0,0 +1,400 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "hera/serialize.hpp"
+#include "hera/utility/detail/byteswap.hpp"
+#include "hera/view/interface.hpp"
+
+namespace hera
+{
+namespace detail
+{
+template<typename T, std::endian Order>
+concept mapped_field = // clang-format off
+    serial_scalar<T> &&
+    (Order == std::endian::native || byteswappable<T>); // clang-format on
+
+template<typename Schema, std::endian Order>
+constexpr bool mapped_fields() noexcept
+{
+    return []<std::size_t... Is>(std::index_sequence<Is...>)
+    {
+        return (mapped_field<serial_element_t<Schema, Is>, Order> && ...);
+    }
+    (std::make_index_sequence<hera::size_v<Schema>>{});
+}
+
+/// a bounded range of scalars which can be read in byte order `Order`
+template<typename Schema, std::endian Order>
+concept mapped_schema = // clang-format off
+    hera::bounded_range<Schema> &&
+    mapped_fields<Schema, Order>(); // clang-format on
+
+template<typename Schema, std::size_t... Is>
+constexpr std::array<std::size_t, sizeof...(Is)>
+mapped_offsets(std::index_sequence<Is...>) noexcept
+{
+    std::array<std::size_t, sizeof...(Is)> res{};
+
+    std::size_t offset = 0;
+    ((res[Is] = offset, offset += sizeof(serial_element_t<Schema, Is>)), ...);
+
+    return res;
+}
+} // namespace detail
+
+/// a record of `Schema` stored in a byte buffer without padding, as written
+/// by `hera::serialize`
+///
+/// The view doesn't own the buffer, `get<I>()` loads the field at a compile
+/// time offset, converting it from `Order` to native byte order.
+template<typename Schema, std::endian Order = std::endian::native> // clang-format off
+    requires detail::mapped_schema<Schema, Order>
+class mapped_record_view // clang-format on
+    : public view_interface<mapped_record_view<Schema, Order>>
+{
+public:
+    static constexpr std::size_t fields = hera::size_v<Schema>;
+
+    /// bytes between two consecutive records
+    static constexpr std::size_t record_size = serialized_size_v<Schema>;
+
+    static constexpr auto offsets =
+        detail::mapped_offsets<Schema>(std::make_index_sequence<fields>{});
+
+    template<std::size_t I>
+    using field_type = detail::serial_element_t<Schema, I>;
+
+private:
+    const std::byte* data_ = nullptr;
+
+public:
+    mapped_record_view() = default;
+
+    constexpr explicit mapped_record_view(const std::byte* data) noexcept
+        : data_{data}
+    {}
+
+    constexpr const std::byte* data() const noexcept
+    {
+        return data_;
+    }
+
+    constexpr std::integral_constant<std::size_t, fields> size() const noexcept
+    {
+        return {};
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < fields)
+    field_type<I> get() const noexcept // clang-format on
+    {
+        return detail::load_unaligned<field_type<I>, Order>(data_ +
+                                                            offsets[I]);
+    }
+
+    /// copies all fields into a `Schema`
+    Schema materialize() const
+    {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return Schema{get<Is>()...};
+        }
+        (std::make_index_sequence<fields>{});
+    }
+};
+
+/// how a `mapped_table` is going to be accessed
+enum class mapped_advice
+{
+    normal,
+    sequential,
+    random
+};
+
+/// consecutive records of `Schema` in a memory mapped file or a byte buffer
+///
+/// Iterating yields a `mapped_record_view` per record, nothing is parsed or
+/// copied up front. Trailing bytes which don't make up a whole record are
+/// ignored.
+template<typename Schema, std::endian Order = std::endian::native> // clang-format off
+    requires detail::mapped_schema<Schema, Order>
+class mapped_table // clang-format on
+{
+public:
+    using record_type = mapped_record_view<Schema, Order>;
+
+    static constexpr std::size_t record_size = record_type::record_size;
+
+    class iterator
+    {
+    private:
+        const std::byte* pos_ = nullptr;
+
+    public:
+        using iterator_concept  = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = record_type;
+        using difference_type   = std::ptrdiff_t;
+
+        iterator() = default;
+
+        constexpr explicit iterator(const std::byte* pos) noexcept : pos_{pos}
+        {}
+
+        constexpr record_type operator*() const noexcept
+        {
+            return record_type{pos_};
+        }
+
+        constexpr record_type operator[](difference_type n) const noexcept
+        {
+            return record_type{pos_ + n * difference_type{record_size}};
+        }
+
+        constexpr iterator& operator++() noexcept
+        {
+            pos_ += record_size;
+            return *this;
+        }
+
+        constexpr iterator operator++(int) noexcept
+        {
+            auto res = *this;
+            ++*this;
+            return res;
+        }
+
+        constexpr iterator& operator--() noexcept
+        {
+            pos_ -= record_size;
+            return *this;
+        }
+
+        constexpr iterator operator--(int) noexcept
+        {
+            auto res = *this;
+            --*this;
+            return res;
+        }
+
+        constexpr iterator& operator+=(difference_type n) noexcept
+        {
+            pos_ += n * difference_type{record_size};
+            return *this;
+        }
+
+        constexpr iterator& operator-=(difference_type n) noexcept
+        {
+            pos_ -= n * difference_type{record_size};
+            return *this;
+        }
+
+        friend constexpr iterator operator+(iterator it,
+                                            difference_type n) noexcept
+        {
+            return it += n;
+        }
+
+        friend constexpr iterator operator+(difference_type n,
+                                            iterator it) noexcept
+        {
+            return it += n;
+        }
+
+        friend constexpr iterator operator-(iterator it,
+                                            difference_type n) noexcept
+        {
+            return it -= n;
+        }
+
+        friend constexpr difference_type operator-(iterator lhs,
+                                                   iterator rhs) noexcept
+        {
+            return (lhs.pos_ - rhs.pos_) / difference_type{record_size};
+        }
+
+        friend constexpr bool operator==(iterator, iterator) = default;
+        friend constexpr auto operator<=>(iterator, iterator) = default;
+    };
+
+private:
+    const std::byte* data_ = nullptr;
+    std::size_t      size_ = 0;
+
+    // the mapping owned by the table, if any
+    void*       mapping_      = nullptr;
+    std::size_t mapping_size_ = 0;
+
+    void release() noexcept
+    {
+        if (mapping_ != nullptr)
+        {
+            ::munmap(mapping_, mapping_size_);
+        }
+    }
+
+public:
+    mapped_table() = default;
+
+    /// the records in `bytes`, which has to outlive the table
+    constexpr explicit mapped_table(std::span<const std::byte> bytes) noexcept
+        : data_{bytes.data()}, size_{bytes.size() / record_size}
+    {}
+
+    mapped_table(mapped_table&& other) noexcept
+        : data_{std::exchange(other.data_, nullptr)},
+          size_{std::exchange(other.size_, 0)},
+          mapping_{std::exchange(other.mapping_, nullptr)},
+          mapping_size_{std::exchange(other.mapping_size_, 0)}
+    {}
+
+    mapped_table& operator=(mapped_table&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+
+            data_         = std::exchange(other.data_, nullptr);
+            size_         = std::exchange(other.size_, 0);
+            mapping_      = std::exchange(other.mapping_, nullptr);
+            mapping_size_ = std::exchange(other.mapping_size_, 0);
+        }
+
+        return *this;
+    }
+
+    ~mapped_table()
+    {
+        release();
+    }
+
+    /// maps the file at `path` read only, nothing if it can't be opened or
+    /// mapped
+    static std::optional<mapped_table>
+    open(const char* path, mapped_advice advice = mapped_advice::sequential)
+    {
+        const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+        {
+            return std::nullopt;
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1)
+        {
+            ::close(fd);
+            return std::nullopt;
+        }
+
+        std::optional<mapped_table> res{std::in_place};
+
+        const auto bytes = static_cast<std::size_t>(st.st_size);
+        if (bytes != 0)
+        {
+            void* mapping =
+                ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (mapping == MAP_FAILED)
+            {
+                ::close(fd);
+                return std::nullopt;
+            }
+
+            res->mapping_      = mapping;
+            res->mapping_size_ = bytes;
+            res->data_         = static_cast<const std::byte*>(mapping);
+            res->size_         = bytes / record_size;
+
+            res->advise(advice);
+        }
+
+        // the mapping stays valid after closing the descriptor
+        ::close(fd);
+        return res;
+    }
+
+    /// passes an access pattern hint for the mapping to the kernel
+    void advise(mapped_advice advice) const noexcept
+    {
+        if (mapping_ == nullptr)
+        {
+            return;
+        }
+
+        int flag = MADV_NORMAL;
+        switch (advice)
+        {
+        case mapped_advice::normal:
+            flag = MADV_NORMAL;
+            break;
+        case mapped_advice::sequential:
+            flag = MADV_SEQUENTIAL;
+            break;
+        case mapped_advice::random:
+            flag = MADV_RANDOM;
+            break;
+        }
+
+        ::madvise(mapping_, mapping_size_, flag);
+    }
+
+    /// number of records
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    const std::byte* data() const noexcept
+    {
+        return data_;
+    }
+
+    record_type operator[](std::size_t idx) const noexcept
+    {
+        return record_type{data_ + idx * record_size};
+    }
+
+    iterator begin() const noexcept
+    {
+        return iterator{data_};
+    }
+
+    iterator end() const noexcept
+    {
+        return iterator{data_ + size_ * record_size};
+    }
+};
+} // namespace hera
+
+namespace std
+{
+template<typename Schema, std::endian Order>
+struct tuple_size<hera::mapped_record_view<Schema, Order>>
+    : std::integral_constant<std::size_t, hera::size_v<Schema>>
+{};
+
+template<std::size_t I, typename Schema, std::endian Order>
+struct tuple_element<I, hera::mapped_record_view<Schema, Order>>
+{
+    using type = typename hera::mapped_record_view<Schema, Order>::
+        template field_type<I>;
+};
+} // namespace std
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hera/container/fixed_string.hpp"
+#include "hera/get.hpp"
+#include "hera/utility/detail/byteswap.hpp"
+
+namespace hera
+{
+namespace detail
+{
+template<typename T>
+concept radix_byte = // clang-format off
+    sizeof(T) == 1 &&
+    (std::is_integral_v<T> || std::is_same_v<T, std::byte>); // clang-format on
+
+template<typename T>
+struct radix_key_traits
+{};
+
+/// integers and floats, stored big endian so their bytes compare in order
+template<typename T> // clang-format off
+    requires (std::is_integral_v<T> || std::is_enum_v<T> ||
+              std::is_floating_point_v<T>) &&
+             byteswappable<T> // clang-format on
+struct radix_key_traits<T>
+{
+    static constexpr std::size_t size = sizeof(T);
+
+    using uint_type = typename byteswap_uint<sizeof(T)>::type;
+
+    static void store(std::byte* out, T value) noexcept
+    {
+        auto bits = std::bit_cast<uint_type>(value);
+
+        constexpr auto sign = uint_type{1} << (8 * sizeof(T) - 1);
+
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            // negative values have their order reversed, all of their bits
+            // are flipped, positive ones only get the sign bit set
+            bits ^= (bits & sign) != 0 ? static_cast<uint_type>(~uint_type{0})
+                                       : sign;
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            if constexpr (std::is_signed_v<std::underlying_type_t<T>>)
+            {
+                bits ^= sign;
+            }
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+            bits ^= sign;
+        }
+
+        detail::store_unaligned<std::endian::big>(out, bits);
+    }
+};
+
+/// fixed length strings, compared bytewise as unsigned like `memcmp`
+template<radix_byte C, std::size_t N>
+struct radix_key_traits<std::array<C, N>>
+{
+    static constexpr std::size_t size = N;
+
+    static void store(std::byte* out, const std::array<C, N>& value) noexcept
+    {
+        std::memcpy(out, value.data(), N);
+    }
+};
+
+template<radix_byte C, std::size_t N>
+struct radix_key_traits<hera::basic_fixed_string<C, N>>
+{
+    static constexpr std::size_t size = N;
+
+    static void store(std::byte*                              out,
+                      const hera::basic_fixed_string<C, N>& value) noexcept
+    {
+        std::memcpy(out, value.data(), N);
+    }
+};
+
+template<typename T>
+concept radix_key = requires
+{
+    radix_key_traits<T>::size;
+};
+
+template<typename R, std::size_t I>
+using radix_element_t = std::remove_cvref_t<decltype(
+    hera::get<I>(*std::ranges::begin(std::declval<R&>())))>;
+
+/// the normalized key bytes of a row next to its index
+template<std::size_t KeySize>
+struct radix_entry
+{
+    std::array<std::byte, KeySize> key;
+    std::uint32_t                  index;
+};
+} // namespace detail
+
+/// the order of the rows of `rows` sorted by their elements `KeyIdxs`
+///
+/// Element `i` of the result is the index of the row which belongs at
+/// position `i`. Rows are compared by the first key element, then the second
+/// and so on, rows with equal keys keep their order.
+///
+/// The key elements of every row are copied once into a compact buffer of
+/// bytes ordered like their values: big endian, with the sign bit of
+/// integers flipped and floats mapped to their total order. Then one LSD
+/// radix pass per key byte scatters the buffer, rows are never moved. The
+/// histograms of all passes are built while copying the keys, passes over a
+/// byte which is the same for all rows are skipped.
+///
+/// Keys are integers, enums, floats and fixed length strings of bytes, like
+/// `std::array<char, N>` or `hera::fixed_string<N>`.
+template<std::size_t... KeyIdxs, std::ranges::random_access_range R> // clang-format off
+    requires (sizeof...(KeyIdxs) != 0) &&
+             std::ranges::sized_range<R> &&
+             (detail::radix_key<detail::radix_element_t<R, KeyIdxs>> && ...)
+std::vector<std::uint32_t> radix_sort_indices(R&& rows) // clang-format on
+{
+    constexpr std::size_t key_size =
+        (detail::radix_key_traits<detail::radix_element_t<R, KeyIdxs>>::size +
+         ...);
+
+    using entry_type = detail::radix_entry<key_size>;
+
+    const std::size_t size = std::ranges::size(rows);
+    assert(size <= std::numeric_limits<std::uint32_t>::max());
+
+    std::vector<entry_type> entries(size);
+    std::vector<entry_type> buffer(size);
+    std::vector<std::array<std::size_t, 256>> histograms(key_size);
+
+    auto it = std::ranges::begin(rows);
+    for (std::size_t i = 0; i != size; ++i, ++it)
+    {
+        auto&& row   = *it;
+        auto&  entry = entries[i];
+
+        std::size_t offset = 0;
+        ((detail::radix_key_traits<detail::radix_element_t<R, KeyIdxs>>::store(
+              entry.key.data() + offset, hera::get<KeyIdxs>(row)),
+          offset +=
+          detail::radix_key_traits<detail::radix_element_t<R, KeyIdxs>>::size),
+         ...);
+
+        entry.index = static_cast<std::uint32_t>(i);
+
+        for (std::size_t byte = 0; byte != key_size; ++byte)
+        {
+            ++histograms[byte][static_cast<std::uint8_t>(entry.key[byte])];
+        }
+    }
+
+    entry_type* from = entries.data();
+    entry_type* to   = buffer.data();
+
+    // from the least to the most significant byte
+    for (std::size_t byte = key_size; byte-- != 0 && size != 0;)
+    {
+        auto& histogram = histograms[byte];
+
+        if (histogram[static_cast<std::uint8_t>(from[0].key[byte])] == size)
+        {
+            continue;
+        }
+
+        std::size_t offset = 0;
+        for (auto& count : histogram)
+        {
+            offset += std::exchange(count, offset);
+        }
+
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            to[histogram[static_cast<std::uint8_t>(from[i].key[byte])]++] =
+                from[i];
+        }
+
+        std::swap(from, to);
+    }
+
+    std::vector<std::uint32_t> res(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        res[i] = from[i].index;
+    }
+
+    return res;
+}
+
+/// sorts `rows` by their elements `KeyIdxs` like `radix_sort_indices`, then
+/// moves every row once to its place
+template<std::size_t... KeyIdxs, std::ranges::random_access_range R> // clang-format off
+    requires std::is_lvalue_reference_v<std::ranges::range_reference_t<R>> &&
+             std::movable<std::ranges::range_value_t<R>> &&
+             requires(R& rows)
+             {
+                 hera::radix_sort_indices<KeyIdxs...>(rows);
+             }
+void radix_sort(R&& rows) // clang-format on
+{
+    auto order = hera::radix_sort_indices<KeyIdxs...>(rows);
+
+    const auto row = [first = std::ranges::begin(rows)](std::size_t index) {
+        return first + static_cast<std::ranges::range_difference_t<R>>(index);
+    };
+
+    // follows the cycles of the permutation, done rows point to themselves
+    for (std::size_t i = 0; i != order.size(); ++i)
+    {
+        if (order[i] == i)
+        {
+            continue;
+        }
+
+        auto        value = std::ranges::iter_move(row(i));
+        std::size_t j     = i;
+
+        while (order[j] != i)
+        {
+            const std::size_t next = order[j];
+            *row(j)                = std::ranges::iter_move(row(next));
+            order[j]               = static_cast<std::uint32_t>(j);
+            j                      = next;
+        }
+
+        *row(j)  = std::move(value);
+        order[j] = static_cast<std::uint32_t>(j);
+    }
+}
+} // namespace hera
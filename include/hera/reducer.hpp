@@ -0,0 +1,278 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// A reducer folds the values of some columns of every row into a state:
+//  - `inputs` is a std::index_sequence of the columns it reads
+//  - `init<Ts...>()` returns the empty state for inputs of types `Ts`
+//  - `update(state, values...)` adds the values of one row
+//  - `merge(state, other)` adds the rows of another state
+//  - `result(state)` extracts the result
+// States are plain values without indirections so loops updating them can be
+// vectorized.
+
+namespace hera
+{
+namespace detail
+{
+template<typename T>
+using sum_type_t = std::conditional_t<
+    std::is_floating_point_v<T>,
+    std::conditional_t<(sizeof(T) < sizeof(double)), double, T>,
+    std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>;
+
+template<typename T>
+concept reducible = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+} // namespace detail
+
+struct count_reducer
+{
+    using inputs = std::index_sequence<>;
+
+    template<typename...>
+    constexpr std::size_t init() const noexcept
+    {
+        return 0;
+    }
+
+    constexpr void update(std::size_t& state) const noexcept
+    {
+        ++state;
+    }
+
+    constexpr void merge(std::size_t& state, std::size_t other) const noexcept
+    {
+        state += other;
+    }
+
+    constexpr std::size_t result(std::size_t state) const noexcept
+    {
+        return state;
+    }
+};
+
+template<std::size_t I>
+struct sum_reducer
+{
+    using inputs = std::index_sequence<I>;
+
+    template<detail::reducible T>
+    constexpr detail::sum_type_t<T> init() const noexcept
+    {
+        return 0;
+    }
+
+    template<typename S, typename T>
+    constexpr void update(S& state, T value) const noexcept
+    {
+        state += static_cast<S>(value);
+    }
+
+    template<typename S>
+    constexpr void merge(S& state, S other) const noexcept
+    {
+        state += other;
+    }
+
+    template<typename S>
+    constexpr S result(S state) const noexcept
+    {
+        return state;
+    }
+};
+
+template<typename T>
+struct extremum_state
+{
+    T           value;
+    std::size_t count;
+};
+
+/// `Less` tells whether its first argument is preferred
+template<std::size_t I, typename Less>
+struct extremum_reducer
+{
+    using inputs = std::index_sequence<I>;
+
+    template<detail::reducible T>
+    constexpr extremum_state<T> init() const noexcept
+    {
+        // the identity of the comparison, so updates don't need to branch on
+        // the first value
+        if constexpr (std::is_same_v<Less, std::less<>>)
+        {
+            return {std::numeric_limits<T>::has_infinity
+                        ? std::numeric_limits<T>::infinity()
+                        : std::numeric_limits<T>::max(),
+                    0};
+        }
+        else
+        {
+            return {std::numeric_limits<T>::has_infinity
+                        ? -std::numeric_limits<T>::infinity()
+                        : std::numeric_limits<T>::lowest(),
+                    0};
+        }
+    }
+
+    template<typename T>
+    constexpr void update(extremum_state<T>& state, T value) const noexcept
+    {
+        state.value = Less{}(value, state.value) ? value : state.value;
+        ++state.count;
+    }
+
+    template<typename T>
+    constexpr void merge(extremum_state<T>&       state,
+                         const extremum_state<T>& other) const noexcept
+    {
+        state.value =
+            Less{}(other.value, state.value) ? other.value : state.value;
+        state.count += other.count;
+    }
+
+    /// nothing if there were no rows
+    template<typename T>
+    constexpr std::optional<T> result(const extremum_state<T>& state) const
+        noexcept
+    {
+        if (state.count == 0)
+        {
+            return std::nullopt;
+        }
+
+        return state.value;
+    }
+};
+
+template<std::size_t I>
+using min_reducer = extremum_reducer<I, std::less<>>;
+
+template<std::size_t I>
+using max_reducer = extremum_reducer<I, std::greater<>>;
+
+struct mean_state
+{
+    double      sum;
+    std::size_t count;
+};
+
+template<std::size_t I>
+struct avg_reducer
+{
+    using inputs = std::index_sequence<I>;
+
+    template<detail::reducible T>
+    constexpr mean_state init() const noexcept
+    {
+        return {0, 0};
+    }
+
+    template<typename T>
+    constexpr void update(mean_state& state, T value) const noexcept
+    {
+        state.sum += static_cast<double>(value);
+        ++state.count;
+    }
+
+    constexpr void merge(mean_state& state, mean_state other) const noexcept
+    {
+        state.sum += other.sum;
+        state.count += other.count;
+    }
+
+    /// nothing if there were no rows
+    constexpr std::optional<double> result(mean_state state) const noexcept
+    {
+        if (state.count == 0)
+        {
+            return std::nullopt;
+        }
+
+        return state.sum / static_cast<double>(state.count);
+    }
+};
+
+/// sums the results of `F` invoked with the values of the columns `Is`
+template<typename F, std::size_t... Is>
+struct sum_of_reducer
+{
+    using inputs = std::index_sequence<Is...>;
+
+    [[no_unique_address]] F fn;
+
+    template<typename... Ts>
+    constexpr auto init() const noexcept
+    {
+        return detail::sum_type_t<std::invoke_result_t<const F&, const Ts&...>>{
+            0};
+    }
+
+    template<typename S, typename... Ts>
+    constexpr void update(S& state, const Ts&... values) const
+    {
+        state += static_cast<S>(std::invoke(fn, values...));
+    }
+
+    template<typename S>
+    constexpr void merge(S& state, S other) const noexcept
+    {
+        state += other;
+    }
+
+    template<typename S>
+    constexpr S result(S state) const noexcept
+    {
+        return state;
+    }
+};
+
+/// number of rows
+inline constexpr count_reducer count{};
+
+/// sum of column `I`, integers are summed in 64 bits and floats in double
+template<std::size_t I>
+inline constexpr sum_reducer<I> sum{};
+
+/// smallest value of column `I`
+template<std::size_t I>
+inline constexpr min_reducer<I> min{};
+
+/// largest value of column `I`
+template<std::size_t I>
+inline constexpr max_reducer<I> max{};
+
+/// arithmetic mean of column `I`
+template<std::size_t I>
+inline constexpr avg_reducer<I> avg{};
+
+template<std::size_t... Is, typename F>
+constexpr sum_of_reducer<F, Is...> sum_of(F fn)
+{
+    return {std::move(fn)};
+}
+
+namespace detail
+{
+template<typename R>
+concept reducer = requires
+{
+    typename R::inputs;
+};
+
+template<typename R, typename... Ts>
+using reducer_state_t =
+    decltype(std::declval<const R&>().template init<Ts...>());
+
+template<typename R, typename... Ts>
+using reducer_result_t = decltype(std::declval<const R&>().result(
+    std::declval<const reducer_state_t<R, Ts...>&>()));
+} // namespace detail
+} // namespace hera
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "hera/container/string.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/utility/detail/automaton.hpp"
+#include "hera/utility/detail/regex_compiler.hpp"
+
+namespace hera
+{
+namespace detail
+{
+template<std::size_t>
+using regex_capture = std::string_view;
+
+template<typename Indices>
+struct regex_captures;
+
+template<std::size_t... Is>
+struct regex_captures<std::index_sequence<Is...>>
+{
+    using type = hera::tuple<regex_capture<Is>...>;
+};
+
+template<auto Pattern>
+concept regex_pattern =
+    hera::constant_string<std::remove_cvref_t<decltype(Pattern)>> &&
+    detail::compile_regex(static_cast<std::string_view>(Pattern)).valid;
+} // namespace detail
+
+/// a regular expression compiled at compile time
+///
+/// The pattern is parsed during constant evaluation and turned into
+/// deterministic automatons for `match` and `search`, which only step through
+/// a transition table. Capture groups are extracted by a bounded backtracker
+/// for short inputs and by a Pike VM otherwise, both keep their state in fixed
+/// size arrays so nothing is allocated at runtime. See
+/// hera/utility/detail/regex_compiler.hpp for the supported syntax, invalid
+/// patterns don't satisfy the constraints.
+template<auto Pattern> // clang-format off
+    requires detail::regex_pattern<Pattern>
+class regex // clang-format on
+{
+private:
+    static constexpr auto program_ = detail::make_regex_program<Pattern>();
+
+    static constexpr auto match_table_ =
+        detail::make_dfa_table<detail::regex_automaton<program_, false>>();
+
+    static constexpr auto search_table_ =
+        detail::make_dfa_table<detail::regex_automaton<program_, true>>();
+
+    using vm_type_        = detail::pike_vm<program_>;
+    using backtracker_type_ = detail::bit_state<program_>;
+
+public:
+    /// number of capture groups, not counting the whole match
+    static constexpr std::size_t groups = program_.groups - 1;
+
+    /// the whole match followed by one view per capture group, groups which
+    /// didn't participate in the match are empty with a null data pointer
+    using captures_type = typename detail::regex_captures<
+        std::make_index_sequence<groups + 1>>::type;
+
+private:
+    template<std::size_t... Is>
+    static constexpr captures_type
+    make_captures(std::string_view                   text,
+                  const typename vm_type_::captures& offsets,
+                  std::index_sequence<Is...>) noexcept
+    {
+        const auto view = [&](std::size_t group) {
+            const auto first = offsets[2 * group];
+            const auto last  = offsets[2 * group + 1];
+
+            return first == vm_type_::npos || last == vm_type_::npos
+                       ? std::string_view{}
+                       : text.substr(first, last - first);
+        };
+
+        return captures_type{view(Is)...};
+    }
+
+    static constexpr std::optional<captures_type>
+    captures_impl(std::string_view text, bool anchored) noexcept
+    {
+        using outcome = typename backtracker_type_::outcome;
+
+        typename vm_type_::captures offsets{};
+
+        auto result = outcome::overflow;
+        if (backtracker_type_::fits(text.size()))
+        {
+            result = backtracker_type_::run(text, anchored, offsets);
+        }
+
+        if (result == outcome::overflow)
+        {
+            result = vm_type_::run(text, anchored, offsets) ? outcome::matched
+                                                            : outcome::failed;
+        }
+
+        if (result == outcome::failed)
+        {
+            return std::nullopt;
+        }
+
+        return make_captures(
+            text, offsets, std::make_index_sequence<groups + 1>{});
+    }
+
+public:
+    /// whether the pattern matches all of `text`
+    static constexpr bool match(std::string_view text) noexcept
+    {
+        auto state = match_table_.start;
+
+        for (char ch : text)
+        {
+            state = match_table_.step(state, static_cast<unsigned char>(ch));
+
+            if (state == match_table_.dead)
+            {
+                return false;
+            }
+        }
+
+        return match_table_.accept[state] >= 0;
+    }
+
+    /// whether the pattern matches any part of `text`
+    static constexpr bool search(std::string_view text) noexcept
+    {
+        auto state = search_table_.start;
+
+        if (search_table_.accept[state] >= 0)
+        {
+            return true;
+        }
+
+        for (char ch : text)
+        {
+            state = search_table_.step(state, static_cast<unsigned char>(ch));
+
+            if (search_table_.accept[state] >= 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// captures of a match spanning all of `text`
+    static constexpr std::optional<captures_type>
+    match_captures(std::string_view text) noexcept
+    {
+        // the automaton rejects quickly, the VM only runs on matches
+        if (!match(text))
+        {
+            return std::nullopt;
+        }
+
+        return captures_impl(text, true);
+    }
+
+    /// captures of the leftmost match in `text`, alternatives and greedy
+    /// quantifiers are preferred in the order they are written
+    static constexpr std::optional<captures_type>
+    search_captures(std::string_view text) noexcept
+    {
+        if (!search(text))
+        {
+            return std::nullopt;
+        }
+
+        return captures_impl(text, false);
+    }
+};
+} // namespace hera
@@ -0,0 +1,345 @@
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "hera/algorithm/unpack.hpp"
+#include "hera/container/pair.hpp"
+#include "hera/container/string.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/container/type_list.hpp"
+#include "hera/utility/detail/automaton.hpp"
+
+namespace hera
+{
+namespace detail
+{
+// routes are matched by a single deterministic automaton, every pattern is a
+// chain of literal bytes in which `*` loops on anything but '/' or, as the
+// last character, on anything at all.
+template<hera::constant_string... Ps>
+struct route_patterns
+{
+    static constexpr detail::nfa make_nfa()
+    {
+        constexpr std::string_view patterns[]{
+            static_cast<std::string_view>(Ps{})..., std::string_view{}};
+
+        detail::nfa automaton{};
+        automaton.start = automaton.add_state();
+
+        for (std::size_t route = 0; route < sizeof...(Ps); ++route)
+        {
+            const auto pattern = patterns[route];
+            auto       state   = automaton.add_state();
+
+            automaton.add_epsilon(automaton.start, state);
+
+            for (std::size_t i = 0; i < pattern.size(); ++i)
+            {
+                if (pattern[i] == '*')
+                {
+                    if (i + 1 == pattern.size())
+                    {
+                        automaton.add_edge(state, 0x00, 0xff, state);
+                    }
+                    else
+                    {
+                        automaton.add_edge(state, 0x00, '/' - 1, state);
+                        automaton.add_edge(state, '/' + 1, 0xff, state);
+                    }
+                }
+                else
+                {
+                    const auto next = automaton.add_state();
+                    automaton.add_edge(
+                        state, static_cast<unsigned char>(pattern[i]), next);
+                    state = next;
+                }
+            }
+
+            automaton.states[state].accept = static_cast<int>(route);
+        }
+
+        return automaton;
+    }
+};
+
+// states which are not accepting and can only be left through a single byte
+// form literal runs, those are compared in one go instead of stepping through
+// the table byte by byte
+template<typename Table>
+constexpr int literal_run_byte(const Table& table, std::size_t state)
+{
+    if (state == Table::dead || table.accept[state] >= 0)
+    {
+        return -1;
+    }
+
+    int byte = -1;
+    for (std::size_t b = 0; b < 256; ++b)
+    {
+        if (table.step(static_cast<typename Table::state_type>(state),
+                       static_cast<unsigned char>(b)) != Table::dead)
+        {
+            if (byte >= 0)
+            {
+                return -1;
+            }
+
+            byte = static_cast<int>(b);
+        }
+    }
+
+    return byte;
+}
+
+template<typename Table>
+constexpr std::size_t literal_run_length(const Table& table, std::size_t state)
+{
+    std::size_t length = 0;
+
+    for (int byte = detail::literal_run_byte(table, state); byte >= 0;
+         byte      = detail::literal_run_byte(table, state))
+    {
+        state = table.step(static_cast<typename Table::state_type>(state),
+                           static_cast<unsigned char>(byte));
+        ++length;
+    }
+
+    return length;
+}
+
+template<typename Table>
+constexpr std::size_t literal_runs_size(const Table& table)
+{
+    std::size_t size = 0;
+    for (std::size_t state = 0; state < Table::states; ++state)
+    {
+        size += detail::literal_run_length(table, state);
+    }
+
+    return size;
+}
+
+template<std::size_t States, std::size_t Bytes, typename StateType>
+struct literal_runs
+{
+    std::array<std::size_t, States> offset{};
+    std::array<std::size_t, States> length{};
+    std::array<StateType, States>   target{};
+    std::array<char, Bytes + 1>     bytes{};
+};
+
+template<auto& Table>
+constexpr auto make_literal_runs()
+{
+    using table_type = std::remove_cvref_t<decltype(Table)>;
+    using state_type = typename table_type::state_type;
+
+    literal_runs<table_type::states,
+                 detail::literal_runs_size(Table),
+                 state_type>
+        runs{};
+
+    std::size_t offset = 0;
+    for (std::size_t state = 0; state < table_type::states; ++state)
+    {
+        runs.offset[state] = offset;
+        runs.length[state] = detail::literal_run_length(Table, state);
+
+        auto current = static_cast<state_type>(state);
+        for (std::size_t i = 0; i < runs.length[state]; ++i)
+        {
+            const auto byte = static_cast<unsigned char>(
+                detail::literal_run_byte(Table, current));
+
+            runs.bytes[offset++] = static_cast<char>(byte);
+            current              = Table.step(current, byte);
+        }
+
+        runs.target[state] = current;
+    }
+
+    return runs;
+}
+} // namespace detail
+
+template<typename Patterns, typename... Hs>
+class router;
+
+/// dispatches strings onto handlers by matching them against a fixed set of
+/// patterns
+///
+/// Patterns consist of literal bytes and `*`, which matches any run of bytes
+/// not containing '/' or, if it ends the pattern, any remainder. All patterns
+/// are compiled into one deterministic automaton, matching is a single pass
+/// without allocation or backtracking. If several patterns match the first one
+/// wins.
+template<hera::constant_string... Ps, typename... Hs> // clang-format off
+    requires (sizeof...(Ps) == sizeof...(Hs))
+class router<hera::type_list<Ps...>, Hs...> // clang-format on
+{
+public:
+    static constexpr std::size_t npos = sizeof...(Ps);
+
+private:
+    static constexpr auto table_ =
+        detail::make_dfa_table<detail::route_patterns<Ps...>>();
+
+    static constexpr auto runs_ = detail::make_literal_runs<table_>();
+
+    // shorter runs are cheaper to step through
+    static constexpr std::size_t min_run_length_ = 4;
+
+    [[no_unique_address]] hera::tuple<Hs...> handlers_;
+
+    template<std::size_t... Is>
+    constexpr router(std::index_sequence<Is...>,
+                     hera::tuple<hera::pair<Ps, Hs>...>&& routes)
+        : handlers_{std::move(hera::get<Is>(routes).second)...}
+    {}
+
+public:
+    router() = default;
+
+    constexpr router(hera::pair<Ps, Hs>... routes)
+        : handlers_{std::move(routes.second)...}
+    {}
+
+    constexpr router(hera::tuple<hera::pair<Ps, Hs>...> routes)
+        : router{std::index_sequence_for<Hs...>{}, std::move(routes)}
+    {}
+
+    constexpr std::integral_constant<std::size_t, sizeof...(Ps)> size() const
+        noexcept
+    {
+        return {};
+    }
+
+    /// index of the first pattern matching `path` or npos
+    static constexpr std::size_t match(std::string_view path) noexcept
+    {
+        auto        state = table_.start;
+        std::size_t pos   = 0;
+
+        while (pos < path.size())
+        {
+            const auto run = runs_.length[state];
+
+            if (run >= min_run_length_ && !std::is_constant_evaluated())
+            {
+                if (path.size() - pos < run ||
+                    std::memcmp(path.data() + pos,
+                                runs_.bytes.data() + runs_.offset[state],
+                                run) != 0)
+                {
+                    return npos;
+                }
+
+                pos += run;
+                state = runs_.target[state];
+                continue;
+            }
+
+            state = table_.step(state, static_cast<unsigned char>(path[pos]));
+
+            if (state == table_.dead)
+            {
+                return npos;
+            }
+
+            ++pos;
+        }
+
+        const auto accept = table_.accept[state];
+        return accept < 0 ? npos : static_cast<std::size_t>(accept);
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Hs))
+    constexpr decltype(auto) get() & noexcept // clang-format on
+    {
+        return (hera::get<I>(handlers_));
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Hs))
+    constexpr decltype(auto) get() const & noexcept // clang-format on
+    {
+        return (hera::get<I>(handlers_));
+    }
+
+private:
+    template<typename Self, std::size_t... Is, typename... Args>
+    static constexpr auto
+    route_impl(Self& self, std::size_t index, std::index_sequence<Is...>, Args&&... args)
+    {
+        using result_type = std::common_type_t<std::invoke_result_t<
+            decltype(self.template get<Is>()),
+            Args&&...>...>;
+        using fn_ptr = result_type (*)(Self&, Args&&...);
+
+        constexpr fn_ptr table[]{+[](Self& s, Args&&... as) -> result_type {
+            return std::invoke(s.template get<Is>(), static_cast<Args&&>(as)...);
+        }...};
+
+        if constexpr (std::is_void_v<result_type>)
+        {
+            if (index == npos)
+            {
+                return false;
+            }
+
+            table[index](self, static_cast<Args&&>(args)...);
+            return true;
+        }
+        else
+        {
+            if (index == npos)
+            {
+                return std::optional<result_type>{};
+            }
+
+            return std::optional<result_type>{
+                table[index](self, static_cast<Args&&>(args)...)};
+        }
+    }
+
+public:
+    /// invokes the handler of the first matching pattern with `args`.
+    ///
+    /// Returns an optional holding the result of the handler, or whether a
+    /// handler was invoked if they return void.
+    template<typename... Args> // clang-format off
+        requires (hera::invocable<Hs&, Args&&...> && ...) && (sizeof...(Hs) != 0)
+    constexpr auto route(std::string_view path, Args&&... args) // clang-format on
+    {
+        return route_impl(*this,
+                          match(path),
+                          std::index_sequence_for<Hs...>{},
+                          static_cast<Args&&>(args)...);
+    }
+
+    template<typename... Args> // clang-format off
+        requires (hera::invocable<const Hs&, Args&&...> && ...) && (sizeof...(Hs) != 0)
+    constexpr auto route(std::string_view path, Args&&... args) const // clang-format on
+    {
+        return route_impl(*this,
+                          match(path),
+                          std::index_sequence_for<Hs...>{},
+                          static_cast<Args&&>(args)...);
+    }
+};
+
+template<typename... Ps, typename... Hs>
+router(hera::pair<Ps, Hs>...) -> router<hera::type_list<Ps...>, Hs...>;
+
+template<typename... Ps, typename... Hs>
+router(hera::tuple<hera::pair<Ps, Hs>...>)
+    -> router<hera::type_list<Ps...>, Hs...>;
+} // namespace hera
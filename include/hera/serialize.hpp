@@ -0,0 +1,679 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "hera/container/tuple.hpp"
+#include "hera/get.hpp"
+#include "hera/ranges.hpp"
+#include "hera/size.hpp"
+
+// A record is written field by field without any padding in native byte
+// order:
+//  - empty types take no space
+//  - arithmetic types, enumerations and trivially copyable types without
+//    padding which aren't ranges are copied bytewise, bools are read back
+//    from a zero or one byte only
+//  - bounded ranges are written element by element
+//  - contiguous sized ranges of trivially copyable elements, like strings,
+//    vectors and spans, are preceded by their element count as a
+//    `serial_length`
+// Other types, like structs with padding, aren't serializable unless they're
+// ranges. Types holding pointers are copied like any other trivially copyable
+// type, they're only meaningful within the same process.
+
+namespace hera
+{
+/// prefix of variable sized fields
+using serial_length = std::uint32_t;
+
+namespace detail
+{
+template<typename R, std::size_t I>
+using serial_element_t =
+    std::remove_cvref_t<decltype(hera::get<I>(std::declval<R&>()))>;
+
+template<typename T>
+concept serial_empty = std::is_empty_v<T>;
+
+/// every byte of which belongs to its value, floating point values may have
+/// several representations but have no padding
+template<typename T>
+concept serial_scalar = // clang-format off
+    !serial_empty<T> &&
+    !hera::bounded_range<T> &&
+    !std::ranges::range<T> &&
+    std::is_trivially_copyable_v<T> &&
+    !std::is_pointer_v<T> &&
+    !std::is_member_pointer_v<T> &&
+    (std::is_arithmetic_v<T> ||
+     std::is_enum_v<T> ||
+     std::has_unique_object_representations_v<T>); // clang-format on
+
+/// scalars which not every byte pattern is a valid value of
+template<typename T>
+concept serial_bool = std::same_as<T, bool>;
+
+/// whether all `count` bools at `in` are zero or one
+inline bool serial_valid_bools(const std::byte* in, std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        if (std::to_integer<unsigned char>(in[i]) > 1)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename T>
+concept serial_sequence = // clang-format off
+    !hera::bounded_range<T> &&
+    std::ranges::contiguous_range<const T> &&
+    std::ranges::sized_range<const T> &&
+    serial_scalar<std::ranges::range_value_t<const T>>; // clang-format on
+
+/// sequences which can refer to the input instead of copying it
+template<typename T>
+concept serial_borrowing_sequence = // clang-format off
+    serial_sequence<T> &&
+    std::ranges::borrowed_range<T> &&
+    alignof(std::ranges::range_value_t<T>) == 1 &&
+    std::constructible_from<T,
+                            const std::ranges::range_value_t<T>*,
+                            std::size_t>; // clang-format on
+
+template<typename T>
+concept serial_owning_sequence = // clang-format off
+    serial_sequence<T> &&
+    requires(T& t, std::size_t n)
+    {
+        t.resize(n);
+        { std::ranges::data(t) }
+            -> std::same_as<std::ranges::range_value_t<T>*>;
+    }; // clang-format on
+
+/// whether the elements of `R` are laid out like the members of a struct
+/// declared in index order
+template<typename R>
+struct serial_native_layout : std::false_type
+{};
+
+template<typename... Ts>
+struct serial_native_layout<hera::tuple<Ts...>> : std::true_type
+{};
+
+template<typename T, std::size_t N>
+struct serial_native_layout<std::array<T, N>> : std::true_type
+{};
+
+template<typename R> // clang-format off
+    requires detail::aggregate_range<R> && std::is_standard_layout_v<R>
+struct serial_native_layout<R> : std::true_type // clang-format on
+{};
+
+/// a field followed by another one which could be placed in its tail padding
+template<typename T>
+struct serial_tail_probe
+{
+    [[no_unique_address]] T value;
+    char                    next;
+};
+
+/// whether a field of type `T` occupies `sizeof(T)` bytes in any record
+///
+/// The elements of a `hera::tuple` may be placed in the tail padding of
+/// fields which aren't standard layout or aren't POD for the purpose of
+/// layout, so their offsets can't be computed from sizes and alignments.
+template<typename T>
+inline constexpr bool serial_own_tail = // clang-format off
+    (std::is_standard_layout_v<T> || hera::bounded_range<T>) &&
+    sizeof(serial_tail_probe<T>) > sizeof(T); // clang-format on
+
+template<typename T, bool Read>
+constexpr bool serial_supported() noexcept
+{
+    if constexpr (serial_empty<T> || serial_scalar<T>)
+    {
+        return true;
+    }
+    else if constexpr (serial_sequence<T>)
+    {
+        return !Read || serial_borrowing_sequence<T> ||
+               serial_owning_sequence<T>;
+    }
+    else if constexpr (hera::bounded_range<T>)
+    {
+        return []<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return (serial_supported<serial_element_t<T, Is>, Read>() && ...);
+        }
+        (std::make_index_sequence<hera::size_v<T>>{});
+    }
+    else
+    {
+        return false;
+    }
+}
+
+template<typename T>
+constexpr bool serial_fixed() noexcept
+{
+    if constexpr (serial_empty<T> || serial_scalar<T>)
+    {
+        return true;
+    }
+    else if constexpr (serial_sequence<T>)
+    {
+        return false;
+    }
+    else
+    {
+        return []<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return (serial_fixed<serial_element_t<T, Is>>() && ...);
+        }
+        (std::make_index_sequence<hera::size_v<T>>{});
+    }
+}
+
+template<typename T>
+constexpr std::size_t serial_fixed_size() noexcept
+{
+    if constexpr (serial_empty<T>)
+    {
+        return 0;
+    }
+    else if constexpr (serial_scalar<T>)
+    {
+        return sizeof(T);
+    }
+    else
+    {
+        return []<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return (std::size_t{0} + ... +
+                    serial_fixed_size<serial_element_t<T, Is>>());
+        }
+        (std::make_index_sequence<hera::size_v<T>>{});
+    }
+}
+
+template<typename T>
+constexpr bool serial_raw() noexcept;
+
+/// where the fields of a bounded range live and which of them can be copied
+/// together
+template<typename R>
+struct serial_layout
+{
+    static constexpr std::size_t fields = hera::size_v<R>;
+
+    template<std::size_t... Is>
+    static constexpr std::array<std::size_t, fields>
+    field_sizes(std::index_sequence<Is...>) noexcept
+    {
+        return {sizeof(serial_element_t<R, Is>)...};
+    }
+
+    template<std::size_t... Is>
+    static constexpr std::array<std::size_t, fields>
+    field_alignments(std::index_sequence<Is...>) noexcept
+    {
+        return {alignof(serial_element_t<R, Is>)...};
+    }
+
+    template<std::size_t... Is>
+    static constexpr std::array<bool, fields>
+    field_raw(std::index_sequence<Is...>) noexcept
+    {
+        return {serial_raw<serial_element_t<R, Is>>()...};
+    }
+
+    template<std::size_t... Is>
+    static constexpr bool any_empty(std::index_sequence<Is...>) noexcept
+    {
+        return (serial_empty<serial_element_t<R, Is>> || ...);
+    }
+
+    template<std::size_t... Is>
+    static constexpr bool all_own_tail(std::index_sequence<Is...>) noexcept
+    {
+        return (serial_own_tail<serial_element_t<R, Is>> && ...);
+    }
+
+    static constexpr auto indices = std::make_index_sequence<fields>{};
+
+    static constexpr auto sizes      = field_sizes(indices);
+    static constexpr auto alignments = field_alignments(indices);
+    static constexpr auto raw        = field_raw(indices);
+
+    static constexpr std::array<std::size_t, fields> offsets = [] {
+        std::array<std::size_t, fields> res{};
+
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i != fields; ++i)
+        {
+            offset = (offset + alignments[i] - 1) / alignments[i] *
+                     alignments[i];
+            res[i] = offset;
+            offset += sizes[i];
+        }
+
+        return res;
+    }();
+
+    static constexpr std::size_t end = [] {
+        if constexpr (fields == 0)
+        {
+            return std::size_t{0};
+        }
+        else
+        {
+            const auto last = offsets[fields - 1] + sizes[fields - 1];
+            return (last + alignof(R) - 1) / alignof(R) * alignof(R);
+        }
+    }();
+
+    // empty elements may share their address with others, others may be
+    // placed in the tail padding of their predecessor
+    static constexpr bool native = serial_native_layout<R>::value &&
+                                   fields != 0 && !any_empty(indices) &&
+                                   all_own_tail(indices) && end == sizeof(R);
+
+    /// number of fields starting at every index which are stored back to back
+    /// and copied bytewise
+    static constexpr std::array<std::size_t, fields> run_fields = [] {
+        std::array<std::size_t, fields> res{};
+
+        for (std::size_t i = fields; i-- != 0;)
+        {
+            if (!native || !raw[i])
+            {
+                continue;
+            }
+
+            res[i] = i + 1 != fields && res[i + 1] != 0 &&
+                             offsets[i] + sizes[i] == offsets[i + 1]
+                         ? res[i + 1] + 1
+                         : 1;
+        }
+
+        return res;
+    }();
+
+    static constexpr std::array<std::size_t, fields> run_bytes = [] {
+        std::array<std::size_t, fields> res{};
+
+        for (std::size_t i = 0; i != fields; ++i)
+        {
+            for (std::size_t j = 0; j != run_fields[i]; ++j)
+            {
+                res[i] += sizes[i + j];
+            }
+        }
+
+        return res;
+    }();
+
+    /// the whole object is copied at once
+    static constexpr bool packed =
+        fields != 0 && run_fields[0] == fields && run_bytes[0] == sizeof(R);
+};
+
+template<typename T>
+constexpr bool serial_raw() noexcept
+{
+    if constexpr (serial_scalar<T>)
+    {
+        return !serial_bool<T>;
+    }
+    else if constexpr (hera::bounded_range<T> && !serial_empty<T>)
+    {
+        if constexpr (serial_fixed<T>())
+        {
+            return serial_layout<T>::packed;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+}
+
+constexpr std::size_t serial_add(std::size_t lhs, std::size_t rhs) noexcept
+{
+    constexpr auto max = std::numeric_limits<std::size_t>::max();
+    return lhs > max - rhs ? max : lhs + rhs;
+}
+
+/// saturates for sequences whose length exceeds a `serial_length`
+template<typename T>
+constexpr std::size_t serial_size(const T& value) noexcept
+{
+    if constexpr (serial_fixed<T>())
+    {
+        return serial_fixed_size<T>();
+    }
+    else if constexpr (serial_sequence<T>)
+    {
+        using value_type = std::ranges::range_value_t<const T>;
+
+        const auto count = std::ranges::size(value);
+        if (count > std::numeric_limits<serial_length>::max())
+        {
+            return std::numeric_limits<std::size_t>::max();
+        }
+
+        return sizeof(serial_length) + count * sizeof(value_type);
+    }
+    else
+    {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            std::size_t res = 0;
+            ((res = serial_add(res, serial_size(hera::get<Is>(value)))), ...);
+            return res;
+        }
+        (std::make_index_sequence<hera::size_v<T>>{});
+    }
+}
+
+template<std::size_t I, typename R>
+std::byte* serial_write_fields(const R& range, std::byte* out) noexcept;
+
+/// `out` has room for `serial_size(value)` bytes
+template<typename T>
+std::byte* serial_write(const T& value, std::byte* out) noexcept
+{
+    if constexpr (serial_empty<T>)
+    {
+        return out;
+    }
+    else if constexpr (serial_bool<T>)
+    {
+        *out = static_cast<std::byte>(value);
+        return out + 1;
+    }
+    else if constexpr (serial_raw<T>())
+    {
+        std::memcpy(out, std::addressof(value), sizeof(T));
+        return out + sizeof(T);
+    }
+    else if constexpr (serial_sequence<T>)
+    {
+        using value_type = std::ranges::range_value_t<const T>;
+
+        const auto count = static_cast<serial_length>(std::ranges::size(value));
+        std::memcpy(out, &count, sizeof(count));
+        out += sizeof(count);
+
+        const auto bytes = std::size_t{count} * sizeof(value_type);
+        if (bytes != 0)
+        {
+            std::memcpy(out, std::ranges::data(value), bytes);
+        }
+
+        return out + bytes;
+    }
+    else
+    {
+        return serial_write_fields<0>(value, out);
+    }
+}
+
+template<std::size_t I, typename R>
+std::byte* serial_write_fields(const R& range, std::byte* out) noexcept
+{
+    using layout = serial_layout<R>;
+
+    if constexpr (I == layout::fields)
+    {
+        return out;
+    }
+    else if constexpr (layout::run_fields[I] > 1)
+    {
+        const auto* first =
+            reinterpret_cast<const std::byte*>(std::addressof(range));
+
+        std::memcpy(out, first + layout::offsets[I], layout::run_bytes[I]);
+
+        return serial_write_fields<I + layout::run_fields[I]>(
+            range, out + layout::run_bytes[I]);
+    }
+    else
+    {
+        return serial_write_fields<I + 1>(
+            range, serial_write(hera::get<I>(range), out));
+    }
+}
+
+template<std::size_t I, typename R>
+const std::byte*
+serial_read_fields(R& range, const std::byte* in, const std::byte* last);
+
+/// null if the input ends early or holds an invalid bool, only sequences are
+/// checked against `last` if `value` has a fixed size
+template<typename T>
+const std::byte*
+serial_read(T& value, const std::byte* in, const std::byte* last)
+{
+    if constexpr (serial_empty<T>)
+    {
+        return in;
+    }
+    else if constexpr (serial_bool<T>)
+    {
+        if (!serial_valid_bools(in, 1))
+        {
+            return nullptr;
+        }
+
+        value = *in == std::byte{1};
+        return in + 1;
+    }
+    else if constexpr (serial_raw<T>())
+    {
+        std::memcpy(std::addressof(value), in, sizeof(T));
+        return in + sizeof(T);
+    }
+    else if constexpr (serial_sequence<T>)
+    {
+        using value_type = std::ranges::range_value_t<T>;
+
+        if (static_cast<std::size_t>(last - in) < sizeof(serial_length))
+        {
+            return nullptr;
+        }
+
+        serial_length count;
+        std::memcpy(&count, in, sizeof(count));
+        in += sizeof(count);
+
+        const auto bytes = std::size_t{count} * sizeof(value_type);
+        if (static_cast<std::size_t>(last - in) < bytes)
+        {
+            return nullptr;
+        }
+
+        if constexpr (serial_bool<std::remove_cv_t<value_type>>)
+        {
+            if (!serial_valid_bools(in, count))
+            {
+                return nullptr;
+            }
+        }
+
+        if constexpr (serial_borrowing_sequence<T>)
+        {
+            value = T(reinterpret_cast<const value_type*>(in), count);
+        }
+        else
+        {
+            value.resize(count);
+            if (bytes != 0)
+            {
+                std::memcpy(std::ranges::data(value), in, bytes);
+            }
+        }
+
+        return in + bytes;
+    }
+    else
+    {
+        return serial_read_fields<0>(value, in, last);
+    }
+}
+
+template<std::size_t I, typename R>
+const std::byte*
+serial_read_fields(R& range, const std::byte* in, const std::byte* last)
+{
+    using layout = serial_layout<R>;
+
+    if constexpr (I == layout::fields)
+    {
+        return in;
+    }
+    else
+    {
+        using element_type = serial_element_t<R, I>;
+
+        // fixed sized parts of variable sized ranges are checked here
+        if constexpr (!serial_fixed<R>() && serial_fixed<element_type>())
+        {
+            constexpr auto bytes = layout::run_fields[I] > 1
+                                       ? layout::run_bytes[I]
+                                       : serial_fixed_size<element_type>();
+
+            if (static_cast<std::size_t>(last - in) < bytes)
+            {
+                return nullptr;
+            }
+        }
+
+        if constexpr (layout::run_fields[I] > 1)
+        {
+            auto* first = reinterpret_cast<std::byte*>(std::addressof(range));
+
+            std::memcpy(first + layout::offsets[I], in, layout::run_bytes[I]);
+
+            return serial_read_fields<I + layout::run_fields[I]>(
+                range, in + layout::run_bytes[I], last);
+        }
+        else
+        {
+            in = serial_read(hera::get<I>(range), in, last);
+            if (in == nullptr)
+            {
+                return nullptr;
+            }
+
+            return serial_read_fields<I + 1>(range, in, last);
+        }
+    }
+}
+} // namespace detail
+
+template<typename T>
+concept serializable = detail::serial_supported<T, false>();
+
+template<typename T>
+concept deserializable = // clang-format off
+    detail::serial_supported<T, true>() &&
+    std::default_initializable<T>; // clang-format on
+
+/// the number of bytes every value of `T` serializes to
+template<serializable T> // clang-format off
+    requires (detail::serial_fixed<T>())
+inline constexpr std::size_t serialized_size_v = // clang-format on
+    detail::serial_fixed_size<T>();
+
+/// the number of bytes `value` serializes to
+template<serializable T>
+constexpr std::size_t serialized_size(const T& value) noexcept
+{
+    return detail::serial_size(value);
+}
+
+/// writes the elements of `range` to the front of `out`
+///
+/// Offsets and the size of fixed sized ranges are known at compile time,
+/// elements which are stored back to back in a `hera::tuple` or `std::array`
+/// are copied with a single `memcpy`. Returns the number of bytes written or
+/// nothing if `out` is too small.
+template<hera::bounded_range R> // clang-format off
+    requires serializable<R>
+std::optional<std::size_t> serialize(const R& range, // clang-format on
+                                     std::span<std::byte> out) noexcept
+{
+    const auto size = detail::serial_size(range);
+    if (size > out.size())
+    {
+        return std::nullopt;
+    }
+
+    detail::serial_write(range, out.data());
+    return size;
+}
+
+/// reads a value written by `serialize` from the front of `in` into `range`
+///
+/// Views over single byte elements like `std::string_view` refer into `in`
+/// instead of copying. Returns the number of bytes read or nothing if `in`
+/// ends early or holds a bool other than zero or one, `range` is left
+/// partially assigned in that case.
+template<hera::bounded_range R> // clang-format off
+    requires deserializable<R>
+std::optional<std::size_t> deserialize(std::span<const std::byte> in, // clang-format on
+                                       R& range)
+{
+    if constexpr (detail::serial_fixed<R>())
+    {
+        if (in.size() < detail::serial_fixed_size<R>())
+        {
+            return std::nullopt;
+        }
+    }
+
+    const auto* last =
+        detail::serial_read(range, in.data(), in.data() + in.size());
+    if (last == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    return static_cast<std::size_t>(last - in.data());
+}
+
+/// reads a value written by `serialize` from the front of `in`
+template<hera::bounded_range R> // clang-format off
+    requires deserializable<R>
+std::optional<R> deserialize(std::span<const std::byte> in) // clang-format on
+{
+    std::optional<R> res{std::in_place};
+
+    if (!hera::deserialize(in, *res))
+    {
+        res.reset();
+    }
+
+    return res;
+}
+} // namespace hera
@@ -3,6 +3,7 @@
 #include <tuple>
 
 #include "hera/bound.hpp"
+#include "hera/utility/detail/aggregate.hpp"
 #include "hera/utility/detail/priority_tag.hpp"
 
 namespace hera
@@ -88,6 +89,14 @@ private:
         return std::tuple_size<R>{};
     }
 
+    template<hera::detail::aggregate_range R>
+    static constexpr auto impl(hera::detail::priority_tag<0>, const R&) noexcept
+    {
+        return std::integral_constant<
+            std::size_t,
+            hera::detail::aggregate_size_v<std::remove_cv_t<R>>>{};
+    }
+
 public:
     template<typename R>
     constexpr auto operator()(R&& r) const
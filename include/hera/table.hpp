@@ -0,0 +1,477 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hera/container/integer_sequence.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/nth_element.hpp"
+#include "hera/reducer.hpp"
+
+namespace hera
+{
+/// rows are processed in batches of this many, small enough for the values
+/// of a few columns and the selection vector to stay in the L1 cache
+inline constexpr std::size_t table_batch_size = 1024;
+
+/// a type a table column can hold
+///
+/// `std::vector<bool>` has no contiguous storage, use a byte instead.
+template<typename T>
+concept table_column = // clang-format off
+    std::is_object_v<T> &&
+    !std::is_const_v<T> &&
+    !std::is_same_v<T, bool>; // clang-format on
+
+template<hera::table_column... Ts>
+class table;
+
+template<typename Table, typename Filters, typename Projection>
+class table_query;
+
+namespace detail
+{
+template<std::size_t I, std::size_t... Is>
+inline constexpr std::size_t nth_index_v =
+    std::array<std::size_t, sizeof...(Is)>{Is...}[I];
+
+/// batch rows which are all selected
+struct table_dense_rows
+{
+    constexpr std::size_t operator[](std::size_t i) const noexcept
+    {
+        return i;
+    }
+};
+
+/// batch rows listed in a selection vector
+struct table_selected_rows
+{
+    const std::uint32_t* selection;
+
+    constexpr std::size_t operator[](std::size_t i) const noexcept
+    {
+        return selection[i];
+    }
+};
+
+/// keeps the rows for which `Pred` invoked with the values of the columns
+/// `Cs` holds
+template<typename Pred, std::size_t... Cs>
+struct table_filter
+{
+    [[no_unique_address]] Pred pred;
+
+    /// writes the offsets of the rows of the batch at `columns` which pass to
+    /// `out` and returns their number, `out` may be the selection `rows` reads
+    template<typename Columns, typename Rows>
+    std::size_t apply(const Columns& columns,
+                      Rows               rows,
+                      std::size_t        n,
+                      std::uint32_t*     out) const
+    {
+        std::size_t res = 0;
+
+        // no branches on the predicate, the row is always written and only
+        // kept by advancing the position
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            const auto row = rows[i];
+            out[res]       = static_cast<std::uint32_t>(row);
+            res += static_cast<bool>(pred(hera::get<Cs>(columns)[row]...));
+        }
+
+        return res;
+    }
+};
+} // namespace detail
+
+/// columns of equal runtime length
+///
+/// Rows are appended like to a vector of `hera::tuple<Ts...>` but stored
+/// column by column. Queries are built with `query()`.
+template<hera::table_column... Ts>
+class table
+{
+public:
+    using row_type = hera::tuple<Ts...>;
+
+    static constexpr std::size_t columns = sizeof...(Ts);
+
+    template<std::size_t I>
+    using column_type = hera::nth_element_t<I, Ts...>;
+
+private:
+    hera::tuple<std::vector<Ts>...> columns_;
+
+public:
+    table() = default;
+
+    /// takes over columns, all of them have to hold the same number of rows
+    explicit table(std::vector<Ts>... columns) // clang-format off
+        requires (sizeof...(Ts) != 0) // clang-format on
+        : columns_{std::move(columns)...}
+    {
+        [[maybe_unused]] const std::size_t rows =
+            hera::get<0>(columns_).size();
+        assert([&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            return ((hera::get<Is>(columns_).size() == rows) && ...);
+        }(std::index_sequence_for<Ts...>{}));
+    }
+
+    std::size_t size() const noexcept
+    {
+        if constexpr (sizeof...(Ts) == 0)
+        {
+            return 0;
+        }
+        else
+        {
+            return hera::get<0>(columns_).size();
+        }
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    void reserve(std::size_t rows)
+    {
+        [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            (hera::get<Is>(columns_).reserve(rows), ...);
+        }
+        (std::index_sequence_for<Ts...>{});
+    }
+
+    void push_back(Ts... values)
+    {
+        [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            (hera::get<Is>(columns_).push_back(std::move(values)), ...);
+        }
+        (std::index_sequence_for<Ts...>{});
+    }
+
+    void push_back(row_type row)
+    {
+        [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            (hera::get<Is>(columns_).push_back(
+                 std::move(hera::get<Is>(row))),
+             ...);
+        }
+        (std::index_sequence_for<Ts...>{});
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Ts))
+    std::span<column_type<I>> column() noexcept // clang-format on
+    {
+        return hera::get<I>(columns_);
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < sizeof...(Ts))
+    std::span<const column_type<I>> column() const noexcept // clang-format on
+    {
+        return hera::get<I>(columns_);
+    }
+
+    /// copies the values of row `index`
+    row_type row(std::size_t index) const
+    {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return row_type{hera::get<Is>(columns_)[index]...};
+        }
+        (std::index_sequence_for<Ts...>{});
+    }
+
+    /// a query selecting all rows and columns
+    table_query<table, hera::tuple<>, hera::make_index_sequence<sizeof...(Ts)>>
+    query() const noexcept
+    {
+        return table_query<table,
+                           hera::tuple<>,
+                           hera::make_index_sequence<sizeof...(Ts)>>{*this,
+                                                                     {}};
+    }
+};
+
+/// a lazily evaluated filter, projection and aggregation over a table
+///
+/// Every step returns a new query, nothing is evaluated until the query is
+/// consumed by `count`, `selection`, `for_each`, `collect` or `aggregate`.
+/// Column indices passed to a step refer to the columns projected so far.
+///
+/// Queries run over batches of `table_batch_size` rows. The first filter
+/// scans its columns and writes the offsets of the passing rows to a selection
+/// vector, later filters only look at the rows it lists. Consumers then run
+/// one loop per column over the selection, or over the whole batch if there
+/// are no filters.
+template<typename... Ts, typename... Filters, std::size_t... Ps>
+class table_query<table<Ts...>,
+                  hera::tuple<Filters...>,
+                  hera::index_sequence<Ps...>>
+{
+public:
+    using table_type = table<Ts...>;
+
+    /// the table the query runs on has to outlive it
+    constexpr table_query(const table_type&       tbl,
+                          hera::tuple<Filters...> filters) noexcept
+        : table_{&tbl}, filters_{std::move(filters)}
+    {}
+
+private:
+    template<std::size_t I>
+    static constexpr std::size_t column_index =
+        detail::nth_index_v<I, Ps...>;
+
+    using columns_type = hera::tuple<const Ts*...>;
+
+    const table_type*       table_;
+    hera::tuple<Filters...> filters_;
+
+    columns_type batch_columns(std::size_t begin) const noexcept
+    {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return columns_type{table_->template column<Is>().data() +
+                                begin...};
+        }
+        (std::index_sequence_for<Ts...>{});
+    }
+
+    /// invokes `fn(begin, columns, rows, n)` for every batch with selected
+    /// rows
+    template<typename F>
+    void scan(F&& fn) const
+    {
+        const std::size_t size = table_->size();
+
+        [[maybe_unused]] std::uint32_t selection[table_batch_size];
+
+        for (std::size_t begin = 0; begin < size; begin += table_batch_size)
+        {
+            const std::size_t n = size - begin < table_batch_size
+                                      ? size - begin
+                                      : table_batch_size;
+            const auto columns = batch_columns(begin);
+
+            if constexpr (sizeof...(Filters) == 0)
+            {
+                fn(begin, columns, detail::table_dense_rows{}, n);
+            }
+            else
+            {
+                std::size_t selected = hera::get<0>(filters_).apply(
+                    columns, detail::table_dense_rows{}, n, selection);
+
+                [&]<std::size_t... Is>(std::index_sequence<Is...>)
+                {
+                    ((selected = hera::get<Is + 1>(filters_).apply(
+                          columns,
+                          detail::table_selected_rows{selection},
+                          selected,
+                          selection)),
+                     ...);
+                }
+                (std::make_index_sequence<sizeof...(Filters) - 1>{});
+
+                if (selected != 0)
+                {
+                    fn(begin,
+                       columns,
+                       detail::table_selected_rows{selection},
+                       selected);
+                }
+            }
+        }
+    }
+
+    template<typename R, std::size_t... Is>
+    static auto init_state(const R& reducer, std::index_sequence<Is...>)
+    {
+        return reducer.template init<
+            hera::nth_element_t<column_index<Is>, Ts...>...>();
+    }
+
+    template<typename R, typename S, typename Rows, std::size_t... Is>
+    static void update_state(const R&            reducer,
+                             S&                  state,
+                             const columns_type& columns,
+                             Rows                rows,
+                             std::size_t         n,
+                             std::index_sequence<Is...>)
+    {
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            [[maybe_unused]] const auto row = rows[i];
+            reducer.update(state,
+                           hera::get<column_index<Is>>(columns)[row]...);
+        }
+    }
+
+public:
+    /// keeps the rows for which `pred` invoked with the values of the columns
+    /// `Cs` holds
+    template<std::size_t... Cs, typename Pred> // clang-format off
+        requires (sizeof...(Cs) != 0) && ((Cs < sizeof...(Ps)) && ...)
+    auto where(Pred pred) const // clang-format on
+    {
+        using filter_type =
+            detail::table_filter<Pred, column_index<Cs>...>;
+
+        return table_query<table_type,
+                           hera::tuple<Filters..., filter_type>,
+                           hera::index_sequence<Ps...>>{
+            *table_,
+            [&]<std::size_t... Is>(std::index_sequence<Is...>)
+            {
+                return hera::tuple<Filters..., filter_type>{
+                    hera::get<Is>(filters_)..., filter_type{std::move(pred)}};
+            }
+            (std::index_sequence_for<Filters...>{})};
+    }
+
+    /// keeps the columns `Is` in that order, like `reorder_view`
+    template<std::size_t... Is> // clang-format off
+        requires ((Is < sizeof...(Ps)) && ...)
+    auto select() const // clang-format on
+    {
+        return table_query<table_type,
+                           hera::tuple<Filters...>,
+                           hera::index_sequence<column_index<Is>...>>{
+            *table_, filters_};
+    }
+
+    template<std::size_t... Is>
+    auto select(hera::index_sequence<Is...>) const
+    {
+        return select<Is...>();
+    }
+
+    /// number of selected rows
+    std::size_t count() const
+    {
+        std::size_t res = 0;
+        scan([&](std::size_t, const auto&, auto, std::size_t n) { res += n; });
+        return res;
+    }
+
+    /// indices of the selected rows in the table
+    std::vector<std::size_t> selection() const
+    {
+        std::vector<std::size_t> res;
+
+        scan([&](std::size_t begin,
+                 const columns_type&,
+                 auto        rows,
+                 std::size_t n) {
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                res.push_back(begin + rows[i]);
+            }
+        });
+
+        return res;
+    }
+
+    /// invokes `fn` with the projected values of every selected row
+    template<typename F>
+    void for_each(F fn) const
+    {
+        scan([&](std::size_t,
+                 const columns_type& columns,
+                 auto                rows,
+                 std::size_t         n) {
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                const auto row = rows[i];
+                fn(hera::get<Ps>(columns)[row]...);
+            }
+        });
+    }
+
+    /// copies the projected columns of the selected rows into a new table
+    auto collect() const
+    {
+        hera::tuple<std::vector<hera::nth_element_t<Ps, Ts...>>...> res;
+
+        scan([&](std::size_t,
+                 const columns_type& columns,
+                 auto                rows,
+                 std::size_t         n) {
+            // a gather loop per column
+            [&]<std::size_t... Is>(std::index_sequence<Is...>)
+            {
+                (
+                    [&] {
+                        auto&       out = hera::get<Is>(res);
+                        const auto* in  = hera::get<Ps>(columns);
+                        for (std::size_t i = 0; i != n; ++i)
+                        {
+                            out.push_back(in[rows[i]]);
+                        }
+                    }(),
+                    ...);
+            }
+            (std::index_sequence_for<hera::nth_element_t<Ps, Ts...>...>{});
+        });
+
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return table<hera::nth_element_t<Ps, Ts...>...>{
+                std::move(hera::get<Is>(res))...};
+        }
+        (std::index_sequence_for<hera::nth_element_t<Ps, Ts...>...>{});
+    }
+
+    /// folds the selected rows with every reducer in a single pass over the
+    /// batches and returns their results
+    template<typename... Rs> // clang-format off
+        requires (detail::reducer<Rs> && ...)
+    auto aggregate(hera::tuple<Rs...> reducers) const // clang-format on
+    {
+        auto states = [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return hera::tuple{init_state(hera::get<Is>(reducers),
+                                          typename Rs::inputs{})...};
+        }
+        (std::index_sequence_for<Rs...>{});
+
+        scan([&](std::size_t,
+                 const columns_type& columns,
+                 auto                rows,
+                 std::size_t         n) {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>)
+            {
+                (update_state(hera::get<Is>(reducers),
+                              hera::get<Is>(states),
+                              columns,
+                              rows,
+                              n,
+                              typename Rs::inputs{}),
+                 ...);
+            }
+            (std::index_sequence_for<Rs...>{});
+        });
+
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return hera::tuple{
+                hera::get<Is>(reducers).result(hera::get<Is>(states))...};
+        }
+        (std::index_sequence_for<Rs...>{});
+    }
+};
+} // namespace hera
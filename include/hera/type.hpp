@@ -1,9 +1,13 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <string_view>
 
 #include "hera/concepts.hpp"
 #include "hera/metafunction.hpp"
+#include "hera/utility/detail/hash.hpp"
+#include "hera/utility/detail/type_name.hpp"
 
 namespace hera
 {
@@ -51,6 +55,22 @@ struct type_
     {
         return {};
     }
+
+    /// the spelling of `T` as reported by the compiler
+    static constexpr std::string_view name() noexcept
+    {
+        return detail::type_name<T>();
+    }
+
+    /// a hash of `name()`, stable across translation units and builds with the
+    /// same compiler.
+    ///
+    /// Distinct unnamed types may share a name and therefore a hash, compare
+    /// the `type_`s themselves to test for identity.
+    static constexpr std::uint64_t hash() noexcept
+    {
+        return detail::fnv1a(name());
+    }
 };
 
 template<hera::metafunction M>
@@ -79,8 +99,9 @@ template<typename U>
 forward_type(U &&) -> forward_type<U&&>;
 
 // deduce the base type of the passed object and put it into a type_
-template<typename T>
-constexpr hera::type_<std::decay_t<T>> typeid_(T&&) noexcept
+template<typename T> // clang-format off
+    requires (!hera::metafunction<std::remove_cvref_t<T>>)
+constexpr hera::type_<std::decay_t<T>> typeid_(T&&) noexcept // clang-format on
 {
     return {};
 }
@@ -1,10 +1,8 @@
 #pragma once
 
-#include "hera/algorithm/accumulate.hpp"
-#include "hera/algorithm/any_of.hpp"
-#include "hera/algorithm/find_if.hpp"
+#include <type_traits>
+
 #include "hera/container/integer_sequence.hpp"
-#include "hera/container/type_list.hpp"
 #include "hera/nth_element.hpp"
 
 namespace hera
@@ -12,42 +10,44 @@ namespace hera
 
 namespace detail
 {
+// a fold instead of a recursion keeps the instantiation depth constant
 template<typename U, typename... Ts>
-constexpr bool type_in_pack_impl()
-{
-    return decltype(hera::any_of(hera::type_list<Ts...>{}, [](auto el_type) {
-        using type = typename decltype(el_type)::type;
-        return std::is_same<type, U>{};
-    }))::value;
-}
+inline constexpr std::size_t type_in_pack_count_v =
+    (std::size_t{0} + ... + std::size_t{std::is_same_v<U, Ts>});
 
-template<typename U, typename... Ts>
-constexpr bool type_in_pack_unique_impl()
+template<typename U, std::size_t I>
+constexpr std::integral_constant<std::size_t, I>
+    type_in_pack_index_of(indexed<I, U>) noexcept
 {
-    constexpr std::integral_constant<std::size_t, 0> start_count{};
-    constexpr auto                                   count = hera::accumulate(
-        hera::type_list<Ts...>{}, start_count, [](auto count, auto type) {
-            if constexpr (std::is_same_v<U, typename decltype(type)::type>)
-            {
-                return std::integral_constant<std::size_t,
-                                              decltype(count)::value + 1>{};
-            }
-            else
-            {
-                return count;
-            }
-        });
-
-    return decltype(count)::value == 1; // 1 guarantees present and unique
+    return {};
 }
 } // namespace detail
 
 template<typename U, typename... Ts>
-concept type_in_pack = detail::type_in_pack_impl<U, Ts...>();
+concept type_in_pack = (detail::type_in_pack_count_v<U, Ts...> != 0);
 
 template<typename U, typename... Ts>
-concept type_in_pack_unique = type_in_pack<U, Ts...>&&
-detail::type_in_pack_unique_impl<U, Ts...>();
+concept type_in_pack_unique = type_in_pack<U, Ts...> &&
+                              (detail::type_in_pack_count_v<U, Ts...> == 1);
+
+namespace detail
+{
+// the deduction of the index fails if U is absent and is ambiguous as soon as U
+// occurs more than once
+template<typename U, typename Indexer>
+concept uniquely_indexed_by = requires(const Indexer& indexer)
+{
+    detail::type_in_pack_index_of<U>(indexer);
+};
+
+template<typename... Ts>
+using indexer_for = detail::indexer<hera::index_sequence_for<Ts...>, Ts...>;
+} // namespace detail
+
+/// every type in `Ts` occurs exactly once
+template<typename... Ts>
+concept unique_types =
+    (detail::uniquely_indexed_by<Ts, detail::indexer_for<Ts...>> && ...);
 
 namespace detail
 {
@@ -55,15 +55,13 @@ template<typename U, typename... Ts> // clang-format off
     requires hera::type_in_pack_unique<U, Ts...>
 constexpr std::size_t type_in_pack_index_impl() // clang-format on
 {
-    return *hera::find_if(hera::type_list<Ts...>{}, [](auto el_type) {
-        using type = typename decltype(el_type)::type;
-
-        return std::is_same<U, type>{};
-    });
+    // overload resolution deduces the index from the only matching base
+    return decltype(detail::type_in_pack_index_of<U>(
+        std::declval<detail::indexer_for<Ts...>>()))::value;
 }
 } // namespace detail
 
 template<typename U, typename... Ts>
 inline constexpr std::size_t
     type_in_pack_index_v = detail::type_in_pack_index_impl<U, Ts...>();
-} // namespace hera
\ No newline at end of file
+} // namespace hera
@@ -0,0 +1,265 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Members of aggregates are counted by probing how many initializers a braced
+// initialization accepts and accessed through structured bindings. Neither
+// works for aggregates with base classes, C array members are counted once
+// per element because of brace elision and move only members can't be
+// combined with non const lvalue reference members, so those aren't
+// reflectable.
+
+namespace hera
+{
+/// specialize to make `hera::size` and `hera::get` treat the aggregate `T`
+/// as a bounded range of references to its members
+template<typename T>
+inline constexpr bool enable_aggregate_range = false;
+
+namespace detail
+{
+/// the largest number of members structured bindings are generated for
+inline constexpr std::size_t aggregate_max_size = 32;
+
+/// converts to any member type, but the conversions are ambiguous for move
+/// only types
+template<std::size_t>
+struct aggregate_initializer
+{
+    template<typename U>
+    operator U&() const noexcept;
+
+    template<typename U>
+    operator U&&() const noexcept;
+};
+
+/// converts to any member type but non const lvalue references
+template<std::size_t>
+struct aggregate_move_initializer
+{
+    template<typename U>
+    operator U&&() const noexcept;
+};
+
+// clang-format off
+template<typename T, std::size_t... Is>
+concept aggregate_initializable_from =
+    requires { T{aggregate_initializer<Is>{}...}; } ||
+    requires { T{aggregate_move_initializer<Is>{}...}; };
+// clang-format on
+
+/// the number of members of `T`, probed up to one past `aggregate_max_size`
+/// so larger aggregates are told apart from ones of the largest size
+template<typename T>
+constexpr std::size_t aggregate_size() noexcept
+{
+    return []<std::size_t... Ns>(std::index_sequence<Ns...>)
+    {
+        std::size_t res = 0;
+        ((res = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+              return aggregate_initializable_from<T, Is...> ? sizeof...(Is)
+                                                            : res;
+          }(std::make_index_sequence<Ns>{})),
+         ...);
+        return res;
+    }
+    (std::make_index_sequence<aggregate_max_size + 2>{});
+}
+
+// clang-format off
+template<typename T>
+concept reflectable_aggregate =
+    std::is_class_v<T> &&
+    std::is_aggregate_v<T> &&
+    !std::is_union_v<T> &&
+    aggregate_size<T>() <= aggregate_max_size;
+// clang-format on
+
+template<typename T>
+inline constexpr std::size_t aggregate_size_v = aggregate_size<T>();
+
+/// aggregates opted into being ranges through `enable_aggregate_range`
+template<typename T>
+concept aggregate_range =
+    hera::enable_aggregate_range<std::remove_cv_t<T>> &&
+    reflectable_aggregate<std::remove_cv_t<T>>;
+
+template<std::size_t I, typename... Ms>
+constexpr auto& aggregate_nth(Ms&... members) noexcept
+{
+    return std::get<I>(std::tie(members...));
+}
+
+/// the `I`th member of `agg`, const if `Agg` is
+template<std::size_t I, typename Agg>
+constexpr auto& aggregate_get(Agg& agg) noexcept
+{
+    constexpr auto size = aggregate_size_v<std::remove_cv_t<Agg>>;
+    static_assert(I < size);
+
+    if constexpr (size == 1)
+    {
+        auto& [m0] = agg;
+        return detail::aggregate_nth<I>(m0);
+    }
+    else if constexpr (size == 2)
+    {
+        auto& [m0, m1] = agg;
+        return detail::aggregate_nth<I>(m0, m1);
+    }
+    else if constexpr (size == 3)
+    {
+        auto& [m0, m1, m2] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2);
+    }
+    else if constexpr (size == 4)
+    {
+        auto& [m0, m1, m2, m3] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3);
+    }
+    else if constexpr (size == 5)
+    {
+        auto& [m0, m1, m2, m3, m4] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4);
+    }
+    else if constexpr (size == 6)
+    {
+        auto& [m0, m1, m2, m3, m4, m5] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5);
+    }
+    else if constexpr (size == 7)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6);
+    }
+    else if constexpr (size == 8)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7);
+    }
+    else if constexpr (size == 9)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8);
+    }
+    else if constexpr (size == 10)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9);
+    }
+    else if constexpr (size == 11)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10);
+    }
+    else if constexpr (size == 12)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11);
+    }
+    else if constexpr (size == 13)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12);
+    }
+    else if constexpr (size == 14)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13);
+    }
+    else if constexpr (size == 15)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14);
+    }
+    else if constexpr (size == 16)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15);
+    }
+    else if constexpr (size == 17)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16);
+    }
+    else if constexpr (size == 18)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17);
+    }
+    else if constexpr (size == 19)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18);
+    }
+    else if constexpr (size == 20)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19);
+    }
+    else if constexpr (size == 21)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20);
+    }
+    else if constexpr (size == 22)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21);
+    }
+    else if constexpr (size == 23)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22);
+    }
+    else if constexpr (size == 24)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23);
+    }
+    else if constexpr (size == 25)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24);
+    }
+    else if constexpr (size == 26)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25);
+    }
+    else if constexpr (size == 27)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26);
+    }
+    else if constexpr (size == 28)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27);
+    }
+    else if constexpr (size == 29)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28);
+    }
+    else if constexpr (size == 30)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29);
+    }
+    else if constexpr (size == 31)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30);
+    }
+    else if constexpr (size == 32)
+    {
+        auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31] = agg;
+        return detail::aggregate_nth<I>(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31);
+    }
+}
+} // namespace detail
+} // namespace hera
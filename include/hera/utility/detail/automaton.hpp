@@ -0,0 +1,338 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// constexpr construction of byte based automatons. A nondeterministic
+// automaton is assembled during constant evaluation, turned into a
+// deterministic one by subset construction and finally copied into fixed
+// size tables which can be stored in static constexpr variables.
+
+namespace hera
+{
+namespace detail
+{
+struct nfa_edge
+{
+    unsigned char first;
+    unsigned char last;
+    std::size_t   target;
+};
+
+struct nfa_state
+{
+    std::vector<nfa_edge>    edges{};
+    std::vector<std::size_t> epsilon{};
+    // smaller tags take precedence if several accepting states are reached
+    int accept = -1;
+};
+
+struct nfa
+{
+    std::vector<nfa_state> states{};
+    std::size_t            start = 0;
+
+    constexpr std::size_t add_state()
+    {
+        states.emplace_back();
+        return states.size() - 1;
+    }
+
+    constexpr void add_edge(std::size_t   from,
+                            unsigned char first,
+                            unsigned char last,
+                            std::size_t   to)
+    {
+        states[from].edges.push_back(nfa_edge{first, last, to});
+    }
+
+    constexpr void add_edge(std::size_t from, unsigned char byte, std::size_t to)
+    {
+        add_edge(from, byte, byte, to);
+    }
+
+    constexpr void add_epsilon(std::size_t from, std::size_t to)
+    {
+        states[from].epsilon.push_back(to);
+    }
+};
+
+struct dfa
+{
+    std::array<unsigned char, 256> byte_class{};
+    std::size_t                    classes = 0;
+    std::size_t                    states  = 0;
+    // states * classes entries, state 0 is the dead state and 1 the start
+    std::vector<std::size_t> next{};
+    std::vector<int>         accept{};
+};
+
+class nfa_state_set
+{
+private:
+    std::vector<std::uint64_t> bits_;
+
+public:
+    constexpr explicit nfa_state_set(std::size_t states)
+        : bits_((states + 63) / 64, 0)
+    {}
+
+    constexpr bool contains(std::size_t state) const
+    {
+        return (bits_[state / 64] >> (state % 64)) & 1;
+    }
+
+    constexpr bool insert(std::size_t state)
+    {
+        if (contains(state))
+        {
+            return false;
+        }
+
+        bits_[state / 64] |= std::uint64_t{1} << (state % 64);
+        return true;
+    }
+
+    constexpr void insert(const nfa_state_set& other)
+    {
+        for (std::size_t i = 0; i < bits_.size(); ++i)
+        {
+            bits_[i] |= other.bits_[i];
+        }
+    }
+
+    constexpr bool empty() const
+    {
+        for (auto word : bits_)
+        {
+            if (word != 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// the members in ascending order
+    constexpr std::vector<std::size_t> states() const
+    {
+        std::vector<std::size_t> result{};
+
+        for (std::size_t i = 0; i < bits_.size(); ++i)
+        {
+            for (auto word = bits_[i]; word != 0; word &= word - 1)
+            {
+                result.push_back(i * 64 +
+                                 static_cast<std::size_t>(std::countr_zero(word)));
+            }
+        }
+
+        return result;
+    }
+
+    constexpr std::uint64_t hash() const
+    {
+        std::uint64_t result = 0;
+
+        for (auto word : bits_)
+        {
+            result = (result ^ word) * 0x100000001b3;
+        }
+
+        return result;
+    }
+
+    friend constexpr bool operator==(const nfa_state_set&,
+                                     const nfa_state_set&) = default;
+};
+
+constexpr void epsilon_closure(const nfa& automaton, nfa_state_set& set)
+{
+    std::vector<std::size_t> pending = set.states();
+
+    while (!pending.empty())
+    {
+        const auto state = pending.back();
+        pending.pop_back();
+
+        for (auto target : automaton.states[state].epsilon)
+        {
+            if (set.insert(target))
+            {
+                pending.push_back(target);
+            }
+        }
+    }
+}
+
+/// subset construction, bytes which no edge tells apart share a class
+constexpr dfa determinize(const nfa& automaton)
+{
+    dfa result{};
+
+    std::array<bool, 257> boundary{};
+    boundary[0] = true;
+
+    for (const auto& state : automaton.states)
+    {
+        for (const auto& edge : state.edges)
+        {
+            boundary[edge.first]    = true;
+            boundary[edge.last + 1] = true;
+        }
+    }
+
+    for (std::size_t byte = 0; byte < 256; ++byte)
+    {
+        if (boundary[byte])
+        {
+            ++result.classes;
+        }
+
+        result.byte_class[byte] =
+            static_cast<unsigned char>(result.classes - 1);
+    }
+
+    const auto nfa_states = automaton.states.size();
+
+    // the closure of every state is computed once and merged afterwards
+    std::vector<nfa_state_set> closures{};
+    for (std::size_t state = 0; state < nfa_states; ++state)
+    {
+        closures.emplace_back(nfa_states);
+        closures.back().insert(state);
+        epsilon_closure(automaton, closures.back());
+    }
+
+    std::vector<nfa_state_set> sets{};
+    std::vector<std::uint64_t> hashes{};
+
+    sets.emplace_back(nfa_states); // dead state
+    sets.push_back(closures[automaton.start]);
+
+    for (const auto& set : sets)
+    {
+        hashes.push_back(set.hash());
+    }
+
+    for (std::size_t current = 0; current < sets.size(); ++current)
+    {
+        const auto members = sets[current].states();
+
+        std::vector<nfa_state_set> targets(result.classes,
+                                           nfa_state_set{nfa_states});
+
+        for (auto state : members)
+        {
+            for (const auto& edge : automaton.states[state].edges)
+            {
+                const auto last = result.byte_class[edge.last];
+
+                for (std::size_t cls = result.byte_class[edge.first];
+                     cls <= last;
+                     ++cls)
+                {
+                    targets[cls].insert(closures[edge.target]);
+                }
+            }
+        }
+
+        for (const auto& target : targets)
+        {
+            const auto hash = target.hash();
+
+            std::size_t index = 0;
+            while (index < sets.size() &&
+                   !(hashes[index] == hash && sets[index] == target))
+            {
+                ++index;
+            }
+
+            if (index == sets.size())
+            {
+                sets.push_back(target);
+                hashes.push_back(hash);
+            }
+
+            result.next.push_back(index);
+        }
+
+        int accept = -1;
+        for (auto state : members)
+        {
+            const auto tag = automaton.states[state].accept;
+
+            if (tag >= 0 && (accept < 0 || tag < accept))
+            {
+                accept = tag;
+            }
+        }
+
+        result.accept.push_back(accept);
+    }
+
+    result.states = sets.size();
+    return result;
+}
+
+template<std::size_t States>
+using dfa_state_t = std::conditional_t<
+    (States <= 0xff),
+    std::uint8_t,
+    std::conditional_t<(States <= 0xffff), std::uint16_t, std::uint32_t>>;
+
+template<std::size_t States, std::size_t Classes>
+struct dfa_table
+{
+    using state_type = dfa_state_t<States>;
+
+    static constexpr state_type  dead    = 0;
+    static constexpr state_type  start   = 1;
+    static constexpr std::size_t states  = States;
+    static constexpr std::size_t classes = Classes;
+
+    std::array<unsigned char, 256>          byte_class{};
+    std::array<state_type, States * Classes> next{};
+    std::array<int, States>                  accept{};
+
+    constexpr state_type step(state_type state, unsigned char byte) const
+        noexcept
+    {
+        return next[state * Classes + byte_class[byte]];
+    }
+};
+
+/// `Source::make_nfa()` is evaluated twice, once to size the tables and once
+/// to fill them
+template<typename Source>
+constexpr auto make_dfa_table()
+{
+    constexpr auto shape = [] {
+        const auto automaton = detail::determinize(Source::make_nfa());
+        return std::array<std::size_t, 2>{automaton.states, automaton.classes};
+    }();
+
+    dfa_table<shape[0], shape[1]> table{};
+
+    const auto automaton = detail::determinize(Source::make_nfa());
+
+    table.byte_class = automaton.byte_class;
+    for (std::size_t i = 0; i < automaton.next.size(); ++i)
+    {
+        table.next[i] =
+            static_cast<typename decltype(table)::state_type>(automaton.next[i]);
+    }
+
+    for (std::size_t i = 0; i < automaton.accept.size(); ++i)
+    {
+        table.accept[i] = automaton.accept[i];
+    }
+
+    return table;
+}
+} // namespace detail
+} // namespace hera
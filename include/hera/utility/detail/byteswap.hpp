@@ -0,0 +1,111 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// byte order conversion and unaligned loads/stores of scalars
+
+namespace hera
+{
+namespace detail
+{
+template<std::size_t Size>
+struct byteswap_uint;
+
+template<>
+struct byteswap_uint<1>
+{
+    using type = std::uint8_t;
+};
+
+template<>
+struct byteswap_uint<2>
+{
+    using type = std::uint16_t;
+};
+
+template<>
+struct byteswap_uint<4>
+{
+    using type = std::uint32_t;
+};
+
+template<>
+struct byteswap_uint<8>
+{
+    using type = std::uint64_t;
+};
+
+template<typename T>
+concept byteswappable = // clang-format off
+    (std::is_arithmetic_v<T> || std::is_enum_v<T>) &&
+    requires
+    {
+        typename byteswap_uint<sizeof(T)>::type;
+    }; // clang-format on
+
+constexpr std::uint8_t byteswap_uint_value(std::uint8_t value) noexcept
+{
+    return value;
+}
+
+constexpr std::uint16_t byteswap_uint_value(std::uint16_t value) noexcept
+{
+    return __builtin_bswap16(value);
+}
+
+constexpr std::uint32_t byteswap_uint_value(std::uint32_t value) noexcept
+{
+    return __builtin_bswap32(value);
+}
+
+constexpr std::uint64_t byteswap_uint_value(std::uint64_t value) noexcept
+{
+    return __builtin_bswap64(value);
+}
+
+/// `value` with its bytes in reverse order
+template<byteswappable T>
+constexpr T byteswap(T value) noexcept
+{
+    using uint_type = typename byteswap_uint<sizeof(T)>::type;
+
+    return std::bit_cast<T>(
+        byteswap_uint_value(std::bit_cast<uint_type>(value)));
+}
+
+/// converts between native byte order and `Order`, in either direction
+template<std::endian Order, typename T>
+constexpr T to_endian(T value) noexcept
+{
+    if constexpr (Order == std::endian::native)
+    {
+        return value;
+    }
+    else
+    {
+        return byteswap(value);
+    }
+}
+
+/// reads a `T` stored in `Order` at a possibly unaligned address
+template<typename T, std::endian Order = std::endian::native>
+T load_unaligned(const std::byte* src) noexcept
+{
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    return to_endian<Order>(value);
+}
+
+/// writes `value` in `Order` to a possibly unaligned address
+template<std::endian Order = std::endian::native, typename T>
+void store_unaligned(std::byte* dest, T value) noexcept
+{
+    value = to_endian<Order>(value);
+    std::memcpy(dest, &value, sizeof(T));
+}
+} // namespace detail
+} // namespace hera
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "hera/get.hpp"
+#include "hera/size.hpp"
+#include "hera/utility/detail/perfect_hash.hpp"
+
+// hashing and comparison of the keys rows are grouped or joined by
+
+namespace hera
+{
+namespace detail
+{
+/// the type of element `I` of the rows of `R`
+template<typename R, std::size_t I>
+using group_element_t = std::remove_cvref_t<decltype(
+    hera::get<I>(*std::ranges::begin(std::declval<R&>())))>;
+
+template<typename T>
+concept group_string_key =
+    std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>;
+
+/// `bool` can't be a table column, use a byte instead
+template<typename T>
+concept group_key = // clang-format off
+    (std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+    std::is_enum_v<T> ||
+    std::is_floating_point_v<T> ||
+    group_string_key<T>; // clang-format on
+
+template<typename T>
+std::uint64_t group_hash(const T& key) noexcept
+{
+    if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+    {
+        return detail::hash_mix(static_cast<std::uint64_t>(key));
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        // -0.0 and 0.0 are equal and have to hash alike
+        const T normalized = key == T{} ? T{} : key;
+
+        if constexpr (sizeof(T) == sizeof(std::uint32_t))
+        {
+            return detail::hash_mix(std::bit_cast<std::uint32_t>(normalized));
+        }
+        else
+        {
+            return detail::hash_mix(std::bit_cast<std::uint64_t>(normalized));
+        }
+    }
+    else if constexpr (group_string_key<T>)
+    {
+        return detail::string_hash(key, 0);
+    }
+    else
+    {
+        // composite keys
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            std::uint64_t res = 0;
+            ((res = detail::hash_mix(res ^
+                                     detail::group_hash(hera::get<Is>(key)))),
+             ...);
+            return res;
+        }
+        (std::make_index_sequence<hera::size_v<T>>{});
+    }
+}
+
+/// `rhs` may be a composite key of references to the elements of a row
+template<typename T, typename U>
+bool group_key_equal(const T& lhs, const U& rhs) noexcept
+{
+    if constexpr (group_key<T>)
+    {
+        return lhs == rhs;
+    }
+    else
+    {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return ((hera::get<Is>(lhs) == hera::get<Is>(rhs)) && ...);
+        }
+        (std::make_index_sequence<hera::size_v<T>>{});
+    }
+}
+} // namespace detail
+} // namespace hera
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+// hash functions which are usable during constant evaluation
+
+namespace hera
+{
+namespace detail
+{
+inline constexpr std::uint64_t fnv1a_offset_basis = 0xcbf29ce484222325ull;
+inline constexpr std::uint64_t fnv1a_prime        = 0x100000001b3ull;
+
+template<typename CharT>
+constexpr std::uint64_t
+fnv1a(std::basic_string_view<CharT> str,
+      std::uint64_t                 hash = fnv1a_offset_basis) noexcept
+{
+    for (CharT ch : str)
+    {
+        hash ^= static_cast<std::uint64_t>(ch);
+        hash *= fnv1a_prime;
+    }
+
+    return hash;
+}
+} // namespace detail
+} // namespace hera
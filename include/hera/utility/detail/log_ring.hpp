@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+// a single producer single consumer byte ring for variable sized records.
+// Records never wrap around the end of the buffer, a record which doesn't fit
+// into the remaining space is preceded by a wrap marker and starts at the
+// front instead.
+
+namespace hera
+{
+namespace detail
+{
+struct log_descriptor;
+
+struct log_record_header
+{
+    // null marks the remainder of the buffer as unused
+    const log_descriptor* descriptor;
+    std::uint32_t         size;
+    std::uint32_t         reserved;
+};
+
+inline constexpr std::size_t log_record_alignment = alignof(log_record_header);
+
+constexpr std::size_t log_record_size(std::size_t payload) noexcept
+{
+    const auto size = sizeof(log_record_header) + payload;
+    return (size + log_record_alignment - 1) & ~(log_record_alignment - 1);
+}
+
+class log_ring
+{
+public:
+    static constexpr std::size_t capacity = std::size_t{1} << 20;
+
+private:
+    static constexpr std::size_t mask_ = capacity - 1;
+
+    std::unique_ptr<std::byte[]> data_{new std::byte[capacity]};
+
+    // positions grow monotonically, the offset into the buffer is the position
+    // modulo the capacity
+    alignas(64) std::atomic<std::size_t> head_{0};
+    alignas(64) std::atomic<std::size_t> tail_{0};
+
+    // producer side
+    alignas(64) std::size_t cached_tail_ = 0;
+    std::size_t             reserved_    = 0;
+
+    std::atomic<bool> closed_{false};
+
+public:
+    /// contiguous space for `size` bytes, a multiple of the record alignment,
+    /// or null if the ring is full
+    std::byte* reserve(std::size_t size) noexcept
+    {
+        const auto head   = head_.load(std::memory_order_relaxed);
+        const auto offset = head & mask_;
+        const auto skip   = offset + size > capacity ? capacity - offset : 0;
+
+        if (skip + size > capacity - (head - cached_tail_))
+        {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+
+            if (skip + size > capacity - (head - cached_tail_))
+            {
+                return nullptr;
+            }
+        }
+
+        if (skip != 0)
+        {
+            const log_descriptor* marker = nullptr;
+            std::memcpy(data_.get() + offset, &marker, sizeof(marker));
+        }
+
+        reserved_ = head + skip + size;
+        return data_.get() + ((head + skip) & mask_);
+    }
+
+    /// publishes the last reservation
+    void commit() noexcept
+    {
+        head_.store(reserved_, std::memory_order_release);
+    }
+
+    /// calls `fn(header, payload)` for every published record, returns
+    /// whether there were any
+    template<typename F>
+    bool consume(F&& fn)
+    {
+        const auto head = head_.load(std::memory_order_acquire);
+        auto       tail = tail_.load(std::memory_order_relaxed);
+
+        if (head == tail)
+        {
+            return false;
+        }
+
+        while (tail != head)
+        {
+            const auto offset = tail & mask_;
+
+            log_record_header header;
+            std::memcpy(&header.descriptor,
+                        data_.get() + offset,
+                        sizeof(header.descriptor));
+
+            if (header.descriptor == nullptr)
+            {
+                tail += capacity - offset;
+                continue;
+            }
+
+            std::memcpy(&header, data_.get() + offset, sizeof(header));
+            fn(header, data_.get() + offset + sizeof(header));
+
+            tail += log_record_size(header.size);
+        }
+
+        tail_.store(tail, std::memory_order_release);
+        return true;
+    }
+
+    /// marks the ring as abandoned by its producer
+    void close() noexcept
+    {
+        closed_.store(true, std::memory_order_release);
+    }
+
+    bool closed() const noexcept
+    {
+        return closed_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const noexcept
+    {
+        return head_.load(std::memory_order_acquire) ==
+               tail_.load(std::memory_order_acquire);
+    }
+};
+} // namespace detail
+} // namespace hera
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "hera/get.hpp"
+#include "hera/size.hpp"
+#include "hera/view/interface.hpp"
+
+namespace hera
+{
+namespace detail
+{
+template<template<typename> typename Trait,
+         typename T,
+         typename = std::make_index_sequence<hera::size_v<T>>>
+inline constexpr bool packed_range_v = false;
+
+/// bounded ranges whose elements all satisfy `Trait` and fill the whole
+/// object, so its bytes stand for its elements, views and ranges holding
+/// references refer to their elements and never are
+template<template<typename> typename Trait, typename T, std::size_t... Is> // clang-format off
+    requires std::is_trivially_copyable_v<T> &&
+             std::has_unique_object_representations_v<T> &&
+             (!std::is_base_of_v<view_base, T>)
+inline constexpr bool packed_range_v<Trait, T, std::index_sequence<Is...>> = // clang-format on
+    ((Trait<std::remove_cvref_t<decltype(
+          hera::get<Is>(std::declval<const T&>()))>>::value &&
+      ...) &&
+     (sizeof(std::remove_cvref_t<decltype(
+          hera::get<Is>(std::declval<const T&>()))>) +
+      ... + 0) == sizeof(T));
+} // namespace detail
+} // namespace hera
@@ -0,0 +1,271 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+// a hash and displace perfect hash over a set of strings known at compile
+// time. A lookup costs one pass over the queried string, an integer mix and a
+// single comparison against the candidate key.
+
+namespace hera
+{
+namespace detail
+{
+constexpr std::uint64_t hash_mix(std::uint64_t x) noexcept
+{
+    // finalizer of murmur3
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdull;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ull;
+    x ^= x >> 33;
+    return x;
+}
+
+// little endian load of `count` bytes
+constexpr std::uint64_t load_le(const char* ptr, std::size_t count) noexcept
+{
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        word |= static_cast<std::uint64_t>(static_cast<unsigned char>(ptr[i]))
+                << (8 * i);
+    }
+
+    return word;
+}
+
+template<typename T>
+inline T load_unaligned(const char* ptr) noexcept
+{
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    return value;
+}
+
+// same result as load_le(str.data() + pos, count) but without a loop over the
+// bytes at runtime, reads which would leave the word are served by
+// overlapping loads inside of `str`
+constexpr std::uint64_t
+load_le_tail(std::string_view str, std::size_t pos, std::size_t count) noexcept
+{
+    if (std::is_constant_evaluated() ||
+        std::endian::native != std::endian::little)
+    {
+        return detail::load_le(str.data() + pos, count);
+    }
+
+    const char* ptr = str.data() + pos;
+
+    if (count == 8)
+    {
+        return detail::load_unaligned<std::uint64_t>(ptr);
+    }
+
+    if (str.size() >= 8)
+    {
+        return detail::load_unaligned<std::uint64_t>(str.data() + str.size() -
+                                                      8) >>
+               (8 * (8 - count));
+    }
+
+    if (count >= 4)
+    {
+        const std::uint64_t low = detail::load_unaligned<std::uint32_t>(ptr);
+        const std::uint64_t high =
+            detail::load_unaligned<std::uint32_t>(ptr + count - 4);
+
+        return low | ((high >> (8 * (8 - count))) << 32);
+    }
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    const auto byte = [&](std::size_t i) {
+        return static_cast<std::uint64_t>(static_cast<unsigned char>(ptr[i]))
+               << (8 * i);
+    };
+
+    return byte(0) | byte(count / 2) | byte(count - 1);
+}
+
+constexpr std::uint64_t hash_step(std::uint64_t hash,
+                                  std::uint64_t word) noexcept
+{
+    hash = (hash ^ word) * 0x9e3779b97f4a7c15ull;
+    return hash ^ (hash >> 32);
+}
+
+/// hashes a word at a time, yields the same value during constant evaluation
+/// and at runtime.
+constexpr std::uint64_t string_hash(std::string_view str,
+                                    std::uint64_t    seed) noexcept
+{
+    auto        hash = seed ^ str.size();
+    std::size_t pos  = 0;
+
+    for (; pos + 8 <= str.size(); pos += 8)
+    {
+        hash = detail::hash_step(hash, detail::load_le_tail(str, pos, 8));
+    }
+
+    if (pos != str.size())
+    {
+        hash = detail::hash_step(
+            hash, detail::load_le_tail(str, pos, str.size() - pos));
+    }
+
+    return hash_mix(hash);
+}
+
+template<std::size_t N>
+struct perfect_hash
+{
+    static constexpr std::size_t capacity = std::bit_ceil(N == 0 ? 1 : N);
+    static constexpr std::size_t buckets  = capacity;
+    static constexpr std::size_t empty    = N;
+    static constexpr int         shift    = 64 - std::countr_zero(capacity);
+
+    std::uint64_t                           seed{};
+    std::array<std::uint32_t, buckets>      displacement{};
+    std::array<std::uint32_t, capacity>     slots{};
+
+    constexpr std::size_t slot_of(std::uint64_t hash) const noexcept
+    {
+        const auto bucket = hash & (buckets - 1);
+        const auto mixed =
+            (hash ^ displacement[bucket]) * 0xd6e8feb86659fd93ull;
+
+        // a shift by 64 is undefined, a single slot always maps to 0
+        return capacity == 1 ? 0 : static_cast<std::size_t>(mixed >> shift);
+    }
+
+    /// returns the index of the only key which might equal `str`, or `empty`
+    constexpr std::size_t candidate(std::string_view str) const noexcept
+    {
+        return slots[slot_of(detail::string_hash(str, seed))];
+    }
+};
+
+template<std::size_t N>
+constexpr bool has_duplicate_keys(
+    const std::array<std::string_view, N>& keys) noexcept
+{
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        for (std::size_t j = i + 1; j < N; ++j)
+        {
+            if (keys[i] == keys[j])
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// tries to place all keys for the given seed, returns false if a bucket could
+// not be resolved
+template<std::size_t N>
+constexpr bool try_build_perfect_hash(const std::array<std::string_view, N>& keys,
+                                      perfect_hash<N>& table) noexcept
+{
+    using table_type = perfect_hash<N>;
+
+    constexpr std::uint32_t max_displacement = 1u << 16;
+
+    std::array<std::uint64_t, N>                       hashes{};
+    std::array<std::size_t, table_type::buckets>       bucket_size{};
+    std::array<bool, table_type::capacity>             used{};
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        hashes[i] = detail::string_hash(keys[i], table.seed);
+        ++bucket_size[hashes[i] & (table_type::buckets - 1)];
+    }
+
+    for (auto& slot : table.slots)
+    {
+        slot = table_type::empty;
+    }
+
+    // place the largest buckets first while there is still room
+    for (std::size_t size = N; size > 0; --size)
+    {
+        for (std::size_t bucket = 0; bucket < table_type::buckets; ++bucket)
+        {
+            if (bucket_size[bucket] != size)
+            {
+                continue;
+            }
+
+            bool placed = false;
+            for (std::uint32_t disp = 0; !placed && disp < max_displacement;
+                 ++disp)
+            {
+                table.displacement[bucket] = disp;
+
+                std::array<bool, table_type::capacity> taken = used;
+
+                placed = true;
+                for (std::size_t i = 0; i < N && placed; ++i)
+                {
+                    if ((hashes[i] & (table_type::buckets - 1)) != bucket)
+                    {
+                        continue;
+                    }
+
+                    const auto slot = table.slot_of(hashes[i]);
+                    placed          = !taken[slot];
+                    taken[slot]     = true;
+                }
+
+                if (placed)
+                {
+                    used = taken;
+                }
+            }
+
+            if (!placed)
+            {
+                return false;
+            }
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                if ((hashes[i] & (table_type::buckets - 1)) == bucket)
+                {
+                    table.slots[table.slot_of(hashes[i])] =
+                        static_cast<std::uint32_t>(i);
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+template<std::size_t N>
+constexpr perfect_hash<N>
+make_perfect_hash(const std::array<std::string_view, N>& keys) noexcept
+{
+    perfect_hash<N> table{};
+
+    for (std::uint64_t seed = 0;; ++seed)
+    {
+        table.seed = detail::hash_mix(seed + 1);
+
+        if (detail::try_build_perfect_hash(keys, table))
+        {
+            return table;
+        }
+    }
+}
+} // namespace detail
+} // namespace hera
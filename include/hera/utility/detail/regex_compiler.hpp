@@ -0,0 +1,1048 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "hera/utility/detail/automaton.hpp"
+
+// constexpr compilation of regular expressions. The pattern is parsed into a
+// syntax tree which is lowered into a small program of the kind run by a Pike
+// VM. The same program doubles as the nondeterministic automaton from which
+// the deterministic matchers are built.
+//
+// Supported syntax: literals, `.`, escapes (\d \w \s, their negations, \n \t
+// \r \f \v and escaped punctuation), classes `[a-z_]` and `[^...]`, capturing
+// `(...)` and non capturing `(?:...)` groups, `|` and the quantifiers `*`,
+// `+`, `?`, `{n}`, `{n,}` and `{n,m}`, each optionally lazy.
+
+namespace hera
+{
+namespace detail
+{
+using byte_set = std::array<std::uint64_t, 4>;
+
+constexpr void
+byte_set_insert(byte_set& set, unsigned char first, unsigned char last) noexcept
+{
+    for (unsigned byte = first; byte <= last; ++byte)
+    {
+        set[byte / 64] |= std::uint64_t{1} << (byte % 64);
+    }
+}
+
+constexpr bool byte_set_contains(const byte_set& set, unsigned char byte) noexcept
+{
+    return (set[byte / 64] >> (byte % 64)) & 1;
+}
+
+constexpr byte_set byte_set_complement(byte_set set) noexcept
+{
+    for (auto& word : set)
+    {
+        word = ~word;
+    }
+
+    return set;
+}
+
+constexpr byte_set byte_set_union(byte_set lhs, const byte_set& rhs) noexcept
+{
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        lhs[i] |= rhs[i];
+    }
+
+    return lhs;
+}
+
+inline constexpr std::size_t regex_unbounded = static_cast<std::size_t>(-1);
+
+enum class regex_node_kind
+{
+    empty,
+    bytes,
+    concat,
+    alternate,
+    group,
+    repeat,
+};
+
+struct regex_node
+{
+    regex_node_kind          kind = regex_node_kind::empty;
+    byte_set                 bytes{};
+    std::vector<std::size_t> children{};
+    // capture index of a group, non capturing groups aren't kept in the tree
+    std::size_t group = 0;
+    std::size_t min   = 0;
+    std::size_t max   = 0;
+    bool        lazy  = false;
+};
+
+struct regex_ast
+{
+    std::vector<regex_node> nodes{};
+    std::size_t             root = 0;
+    // number of capturing groups, not counting the whole match
+    std::size_t groups = 0;
+    bool        valid  = true;
+};
+
+class regex_parser
+{
+private:
+    std::string_view pattern_;
+    std::size_t      pos_ = 0;
+    regex_ast        ast_{};
+
+public:
+    constexpr explicit regex_parser(std::string_view pattern)
+        : pattern_{pattern}
+    {}
+
+    constexpr regex_ast parse() &&
+    {
+        ast_.root = parse_alternate();
+
+        if (pos_ != pattern_.size())
+        {
+            ast_.valid = false;
+        }
+
+        return std::move(ast_);
+    }
+
+private:
+    constexpr bool at_end() const noexcept
+    {
+        return pos_ == pattern_.size();
+    }
+
+    constexpr char peek() const noexcept
+    {
+        return pattern_[pos_];
+    }
+
+    constexpr bool consume(char ch) noexcept
+    {
+        if (!at_end() && peek() == ch)
+        {
+            ++pos_;
+            return true;
+        }
+
+        return false;
+    }
+
+    constexpr std::size_t add(regex_node node)
+    {
+        ast_.nodes.push_back(std::move(node));
+        return ast_.nodes.size() - 1;
+    }
+
+    constexpr std::size_t fail()
+    {
+        ast_.valid = false;
+        pos_       = pattern_.size();
+        return add(regex_node{});
+    }
+
+    constexpr std::size_t parse_alternate()
+    {
+        regex_node node{regex_node_kind::alternate};
+        node.children.push_back(parse_concat());
+
+        while (consume('|'))
+        {
+            node.children.push_back(parse_concat());
+        }
+
+        if (node.children.size() == 1)
+        {
+            return node.children[0];
+        }
+
+        return add(std::move(node));
+    }
+
+    constexpr std::size_t parse_concat()
+    {
+        regex_node node{regex_node_kind::concat};
+
+        while (!at_end() && peek() != '|' && peek() != ')')
+        {
+            node.children.push_back(parse_repeat());
+        }
+
+        return add(std::move(node));
+    }
+
+    constexpr bool parse_number(std::size_t& value)
+    {
+        const auto first = pos_;
+        value            = 0;
+
+        while (!at_end() && peek() >= '0' && peek() <= '9')
+        {
+            value = value * 10 + static_cast<std::size_t>(peek() - '0');
+            ++pos_;
+        }
+
+        return pos_ != first;
+    }
+
+    constexpr std::size_t parse_repeat()
+    {
+        auto atom = parse_atom();
+
+        while (!at_end())
+        {
+            std::size_t min = 0;
+            std::size_t max = regex_unbounded;
+
+            if (consume('*'))
+            {}
+            else if (consume('+'))
+            {
+                min = 1;
+            }
+            else if (consume('?'))
+            {
+                max = 1;
+            }
+            else if (consume('{'))
+            {
+                if (!parse_number(min))
+                {
+                    return fail();
+                }
+
+                max = min;
+                if (consume(','))
+                {
+                    max = parse_number(max) ? max : regex_unbounded;
+                }
+
+                if (!consume('}') || max < min)
+                {
+                    return fail();
+                }
+            }
+            else
+            {
+                break;
+            }
+
+            regex_node node{regex_node_kind::repeat};
+            node.children.push_back(atom);
+            node.min  = min;
+            node.max  = max;
+            node.lazy = consume('?');
+
+            atom = add(std::move(node));
+        }
+
+        return atom;
+    }
+
+    static constexpr byte_set class_escape(char ch, bool& known)
+    {
+        byte_set set{};
+        known = true;
+
+        switch (ch)
+        {
+        case 'd':
+        case 'D':
+            byte_set_insert(set, '0', '9');
+            break;
+        case 'w':
+        case 'W':
+            byte_set_insert(set, 'a', 'z');
+            byte_set_insert(set, 'A', 'Z');
+            byte_set_insert(set, '0', '9');
+            byte_set_insert(set, '_', '_');
+            break;
+        case 's':
+        case 'S':
+            byte_set_insert(set, ' ', ' ');
+            byte_set_insert(set, '\t', '\r');
+            break;
+        default:
+            known = false;
+            return set;
+        }
+
+        return ch >= 'A' && ch <= 'Z' ? byte_set_complement(set) : set;
+    }
+
+    static constexpr unsigned char literal_escape(char ch)
+    {
+        switch (ch)
+        {
+        case 'n':
+            return '\n';
+        case 't':
+            return '\t';
+        case 'r':
+            return '\r';
+        case 'f':
+            return '\f';
+        case 'v':
+            return '\v';
+        case '0':
+            return '\0';
+        default:
+            return static_cast<unsigned char>(ch);
+        }
+    }
+
+    // the bytes of an escape sequence following the backslash
+    constexpr byte_set parse_escape()
+    {
+        if (at_end())
+        {
+            ast_.valid = false;
+            return {};
+        }
+
+        const auto ch = pattern_[pos_++];
+
+        bool known = false;
+        auto set   = class_escape(ch, known);
+
+        if (!known)
+        {
+            // letters without meaning are reserved
+            if ((ch >= 'a' && ch <= 'z' && literal_escape(ch) == ch) ||
+                (ch >= 'A' && ch <= 'Z'))
+            {
+                ast_.valid = false;
+            }
+
+            const auto byte = literal_escape(ch);
+            byte_set_insert(set, byte, byte);
+        }
+
+        return set;
+    }
+
+    constexpr std::size_t parse_class()
+    {
+        const bool negate = consume('^');
+        byte_set   set{};
+        bool       first = true;
+
+        while (!at_end() && (first || peek() != ']'))
+        {
+            first = false;
+
+            if (consume('\\'))
+            {
+                set = byte_set_union(set, parse_escape());
+                continue;
+            }
+
+            const auto low = static_cast<unsigned char>(pattern_[pos_++]);
+            auto       high = low;
+
+            if (pos_ + 1 < pattern_.size() && peek() == '-' &&
+                pattern_[pos_ + 1] != ']')
+            {
+                ++pos_;
+
+                if (consume('\\'))
+                {
+                    const auto escaped = parse_escape();
+                    high               = 0;
+                    while (!byte_set_contains(escaped, high) && high != 0xff)
+                    {
+                        ++high;
+                    }
+                }
+                else
+                {
+                    high = static_cast<unsigned char>(pattern_[pos_++]);
+                }
+
+                if (high < low)
+                {
+                    return fail();
+                }
+            }
+
+            byte_set_insert(set, low, high);
+        }
+
+        if (!consume(']'))
+        {
+            return fail();
+        }
+
+        return add(
+            regex_node{regex_node_kind::bytes,
+                       negate ? byte_set_complement(set) : set});
+    }
+
+    constexpr std::size_t parse_atom()
+    {
+        const auto ch = pattern_[pos_++];
+
+        switch (ch)
+        {
+        case '(':
+        {
+            const bool capture = !consume('?');
+            if (!capture && !consume(':'))
+            {
+                return fail();
+            }
+
+            const auto group = capture ? ++ast_.groups : 0;
+            const auto inner = parse_alternate();
+
+            if (!consume(')'))
+            {
+                return fail();
+            }
+
+            if (!capture)
+            {
+                return inner;
+            }
+
+            regex_node node{regex_node_kind::group};
+            node.children.push_back(inner);
+            node.group = group;
+            return add(std::move(node));
+        }
+        case '[':
+            return parse_class();
+        case '.':
+        {
+            byte_set set{};
+            byte_set_insert(set, '\n', '\n');
+            return add(
+                regex_node{regex_node_kind::bytes, byte_set_complement(set)});
+        }
+        case '\\':
+            return add(regex_node{regex_node_kind::bytes, parse_escape()});
+        case '*':
+        case '+':
+        case '?':
+        case '{':
+        case '^':
+        case '$':
+            return fail();
+        default:
+        {
+            byte_set set{};
+            byte_set_insert(set,
+                            static_cast<unsigned char>(ch),
+                            static_cast<unsigned char>(ch));
+            return add(regex_node{regex_node_kind::bytes, set});
+        }
+        }
+    }
+};
+
+enum class regex_op : unsigned char
+{
+    // consume a byte of sets[x]
+    bytes,
+    // continue at x, then at y with lower priority
+    split,
+    jump,
+    // record the position in capture slot x
+    save,
+    match,
+};
+
+struct regex_inst
+{
+    regex_op    op = regex_op::match;
+    std::size_t x  = 0;
+    std::size_t y  = 0;
+};
+
+struct regex_program_builder
+{
+    std::vector<regex_inst> insts{};
+    std::vector<byte_set>   sets{};
+    // capture groups including the whole match as group 0
+    std::size_t groups = 1;
+    bool        valid  = true;
+
+    constexpr std::size_t add(regex_inst inst)
+    {
+        insts.push_back(inst);
+        return insts.size() - 1;
+    }
+
+    constexpr void emit(const regex_ast& ast, std::size_t index)
+    {
+        const auto& node = ast.nodes[index];
+
+        switch (node.kind)
+        {
+        case regex_node_kind::empty:
+            break;
+        case regex_node_kind::bytes:
+            sets.push_back(node.bytes);
+            add({regex_op::bytes, sets.size() - 1});
+            break;
+        case regex_node_kind::concat:
+            for (auto child : node.children)
+            {
+                emit(ast, child);
+            }
+            break;
+        case regex_node_kind::alternate:
+        {
+            std::vector<std::size_t> jumps{};
+
+            for (std::size_t i = 0; i + 1 < node.children.size(); ++i)
+            {
+                const auto split = add({regex_op::split, insts.size() + 1});
+                emit(ast, node.children[i]);
+                jumps.push_back(add({regex_op::jump}));
+                insts[split].y = insts.size();
+            }
+
+            emit(ast, node.children.back());
+
+            for (auto jump : jumps)
+            {
+                insts[jump].x = insts.size();
+            }
+            break;
+        }
+        case regex_node_kind::group:
+            add({regex_op::save, 2 * node.group});
+            emit(ast, node.children[0]);
+            add({regex_op::save, 2 * node.group + 1});
+            break;
+        case regex_node_kind::repeat:
+        {
+            for (std::size_t i = 0; i < node.min; ++i)
+            {
+                emit(ast, node.children[0]);
+            }
+
+            std::vector<std::size_t> splits{};
+
+            if (node.max == regex_unbounded)
+            {
+                const auto split = add({regex_op::split});
+                emit(ast, node.children[0]);
+                add({regex_op::jump, split});
+                splits.push_back(split);
+            }
+            else
+            {
+                for (std::size_t i = node.min; i < node.max; ++i)
+                {
+                    splits.push_back(add({regex_op::split}));
+                    emit(ast, node.children[0]);
+                }
+            }
+
+            for (auto split : splits)
+            {
+                const auto body = split + 1;
+                const auto exit = insts.size();
+
+                insts[split].x = node.lazy ? exit : body;
+                insts[split].y = node.lazy ? body : exit;
+            }
+            break;
+        }
+        }
+    }
+};
+
+constexpr regex_program_builder compile_regex(std::string_view pattern)
+{
+    const auto ast = regex_parser{pattern}.parse();
+
+    regex_program_builder program{};
+    program.valid  = ast.valid;
+    program.groups = ast.groups + 1;
+
+    program.add({regex_op::save, 0});
+    if (ast.valid)
+    {
+        program.emit(ast, ast.root);
+    }
+    program.add({regex_op::save, 1});
+    program.add({regex_op::match});
+
+    return program;
+}
+
+template<std::size_t Insts, std::size_t Sets, std::size_t Groups>
+struct regex_program
+{
+    static constexpr std::size_t size   = Insts;
+    static constexpr std::size_t groups = Groups;
+
+    std::array<regex_inst, Insts> insts{};
+    std::array<byte_set, Sets>    sets{};
+};
+
+/// `Pattern` is evaluated twice, once to size the program and once to fill it
+template<auto Pattern>
+constexpr auto make_regex_program()
+{
+    constexpr auto shape = [] {
+        const auto program =
+            detail::compile_regex(static_cast<std::string_view>(Pattern));
+        return std::array<std::size_t, 3>{
+            program.insts.size(), program.sets.size(), program.groups};
+    }();
+
+    regex_program<shape[0], shape[1], shape[2]> result{};
+
+    const auto program =
+        detail::compile_regex(static_cast<std::string_view>(Pattern));
+
+    for (std::size_t i = 0; i < shape[0]; ++i)
+    {
+        result.insts[i] = program.insts[i];
+    }
+
+    for (std::size_t i = 0; i < shape[1]; ++i)
+    {
+        result.sets[i] = program.sets[i];
+    }
+
+    return result;
+}
+
+/// the program as automaton, unanchored automatons match anywhere in the input
+template<auto& Program, bool Unanchored>
+struct regex_automaton
+{
+    static constexpr detail::nfa make_nfa()
+    {
+        detail::nfa automaton{};
+
+        for (std::size_t pc = 0; pc < Program.size; ++pc)
+        {
+            automaton.add_state();
+        }
+
+        for (std::size_t pc = 0; pc < Program.size; ++pc)
+        {
+            const auto& inst = Program.insts[pc];
+
+            switch (inst.op)
+            {
+            case regex_op::bytes:
+            {
+                const auto& set = Program.sets[inst.x];
+
+                for (unsigned first = 0; first < 256;)
+                {
+                    if (!byte_set_contains(set, static_cast<unsigned char>(first)))
+                    {
+                        ++first;
+                        continue;
+                    }
+
+                    auto last = first;
+                    while (last + 1 < 256 &&
+                           byte_set_contains(set,
+                                             static_cast<unsigned char>(last + 1)))
+                    {
+                        ++last;
+                    }
+
+                    automaton.add_edge(pc,
+                                       static_cast<unsigned char>(first),
+                                       static_cast<unsigned char>(last),
+                                       pc + 1);
+                    first = last + 1;
+                }
+                break;
+            }
+            case regex_op::split:
+                automaton.add_epsilon(pc, inst.x);
+                automaton.add_epsilon(pc, inst.y);
+                break;
+            case regex_op::jump:
+                automaton.add_epsilon(pc, inst.x);
+                break;
+            case regex_op::save:
+                automaton.add_epsilon(pc, pc + 1);
+                break;
+            case regex_op::match:
+                automaton.states[pc].accept = 0;
+                break;
+            }
+        }
+
+        if constexpr (Unanchored)
+        {
+            automaton.start = automaton.add_state();
+            automaton.add_edge(automaton.start, 0x00, 0xff, automaton.start);
+            automaton.add_epsilon(automaton.start, 0);
+        }
+
+        return automaton;
+    }
+};
+
+struct regex_prefix
+{
+    // bytes which can start a match
+    byte_set bytes{};
+    bool     nullable = false;
+};
+
+/// the bytes consumed first by any path through the program
+template<auto& Program>
+constexpr regex_prefix make_regex_prefix()
+{
+    regex_prefix             prefix{};
+    std::vector<bool>        seen(Program.size, false);
+    std::vector<std::size_t> pending{0};
+
+    while (!pending.empty())
+    {
+        const auto pc = pending.back();
+        pending.pop_back();
+
+        if (seen[pc])
+        {
+            continue;
+        }
+
+        seen[pc] = true;
+
+        const auto& inst = Program.insts[pc];
+
+        switch (inst.op)
+        {
+        case regex_op::bytes:
+            prefix.bytes = byte_set_union(prefix.bytes, Program.sets[inst.x]);
+            break;
+        case regex_op::split:
+            pending.push_back(inst.x);
+            pending.push_back(inst.y);
+            break;
+        case regex_op::jump:
+            pending.push_back(inst.x);
+            break;
+        case regex_op::save:
+            pending.push_back(pc + 1);
+            break;
+        case regex_op::match:
+            prefix.nullable = true;
+            break;
+        }
+    }
+
+    return prefix;
+}
+
+template<auto& Program>
+inline constexpr regex_prefix regex_prefix_v = make_regex_prefix<Program>();
+
+/// whether an unanchored match may start at `pos`
+template<auto& Program>
+constexpr bool regex_may_start(std::string_view text, std::size_t pos) noexcept
+{
+    constexpr auto& prefix = regex_prefix_v<Program>;
+
+    return prefix.nullable ||
+           (pos < text.size() &&
+            byte_set_contains(prefix.bytes,
+                              static_cast<unsigned char>(text[pos])));
+}
+
+/// leftmost first submatch extraction, all state lives in fixed size arrays
+template<auto& Program>
+class pike_vm
+{
+public:
+    static constexpr std::size_t npos  = static_cast<std::size_t>(-1);
+    static constexpr std::size_t slots = 2 * Program.groups;
+
+    using captures = std::array<std::size_t, slots>;
+
+private:
+    struct thread_list
+    {
+        // only the first `size` threads are ever read
+        std::array<std::size_t, Program.size> pcs;
+        std::array<captures, Program.size>    caps;
+        std::array<bool, Program.size>        queued{};
+        std::size_t                           size = 0;
+
+        constexpr void clear() noexcept
+        {
+            queued = {};
+            size   = 0;
+        }
+    };
+
+    static constexpr void
+    add(thread_list& list, std::size_t pc, captures& caps, std::size_t pos) noexcept
+    {
+        if (list.queued[pc])
+        {
+            return;
+        }
+
+        list.queued[pc] = true;
+
+        const auto& inst = Program.insts[pc];
+
+        switch (inst.op)
+        {
+        case regex_op::jump:
+            add(list, inst.x, caps, pos);
+            break;
+        case regex_op::split:
+            add(list, inst.x, caps, pos);
+            add(list, inst.y, caps, pos);
+            break;
+        case regex_op::save:
+        {
+            const auto previous = caps[inst.x];
+            caps[inst.x]        = pos;
+            add(list, pc + 1, caps, pos);
+            caps[inst.x] = previous;
+            break;
+        }
+        default:
+            list.pcs[list.size]  = pc;
+            list.caps[list.size] = caps;
+            ++list.size;
+            break;
+        }
+    }
+
+public:
+    /// capture offsets of the leftmost match, anchored matches have to span
+    /// all of `text`
+    static constexpr bool
+    run(std::string_view text, bool anchored, captures& result) noexcept
+    {
+        thread_list lists[2];
+        auto*       current = &lists[0];
+        auto*       next    = &lists[1];
+
+        captures initial{};
+        for (auto& slot : initial)
+        {
+            slot = npos;
+        }
+
+        bool matched = false;
+
+        for (std::size_t pos = 0; pos <= text.size(); ++pos)
+        {
+            if (!matched &&
+                (anchored ? pos == 0
+                          : detail::regex_may_start<Program>(text, pos)))
+            {
+                add(*current, 0, initial, pos);
+            }
+
+            if (current->size == 0)
+            {
+                if (matched || anchored)
+                {
+                    break;
+                }
+
+                continue;
+            }
+
+            next->clear();
+
+            for (std::size_t i = 0; i < current->size; ++i)
+            {
+                const auto& inst = Program.insts[current->pcs[i]];
+
+                if (inst.op == regex_op::match)
+                {
+                    if (!anchored || pos == text.size())
+                    {
+                        // threads of lower priority are cut off
+                        matched = true;
+                        result  = current->caps[i];
+                        break;
+                    }
+                }
+                else if (pos < text.size() &&
+                         byte_set_contains(Program.sets[inst.x],
+                                           static_cast<unsigned char>(text[pos])))
+                {
+                    add(*next, current->pcs[i] + 1, current->caps[i], pos + 1);
+                }
+            }
+
+            auto* done = current;
+            current    = next;
+            next       = done;
+        }
+
+        return matched;
+    }
+};
+
+/// backtracking submatch extraction for short inputs
+///
+/// Every (instruction, position) pair is tried at most once, which bounds the
+/// work like the Pike VM but without copying the captures of each thread. The
+/// visited set and the backtracking stack have a fixed size, `run` gives up
+/// on inputs that don't fit.
+template<auto& Program>
+class bit_state
+{
+public:
+    using captures = typename pike_vm<Program>::captures;
+
+private:
+    static constexpr std::size_t npos     = pike_vm<Program>::npos;
+    static constexpr std::size_t max_bits = 16384;
+    static constexpr std::size_t max_jobs = 512;
+
+    struct job
+    {
+        // npos restores `pos` into capture slot `slot`
+        std::size_t pc;
+        std::size_t pos;
+        std::size_t slot;
+    };
+
+public:
+    static constexpr bool fits(std::size_t length) noexcept
+    {
+        return Program.size * (length + 1) <= max_bits;
+    }
+
+    enum class outcome
+    {
+        matched,
+        failed,
+        overflow,
+    };
+
+    static constexpr outcome
+    run(std::string_view text, bool anchored, captures& result) noexcept
+    {
+        const auto stride = text.size() + 1;
+
+        // only the words covering the input are used
+        std::array<std::uint64_t, max_bits / 64> visited;
+        for (std::size_t i = 0; i < (Program.size * stride + 63) / 64; ++i)
+        {
+            visited[i] = 0;
+        }
+
+        std::array<job, max_jobs> jobs;
+        std::size_t               size = 0;
+
+        captures caps{};
+        for (auto& slot : caps)
+        {
+            slot = npos;
+        }
+
+        const std::size_t last_start = anchored ? 0 : text.size();
+
+        for (std::size_t start = 0; start <= last_start; ++start)
+        {
+            if (!anchored && !detail::regex_may_start<Program>(text, start))
+            {
+                continue;
+            }
+
+            jobs[size++] = job{0, start, 0};
+
+            while (size != 0)
+            {
+                --size;
+
+                auto pc  = jobs[size].pc;
+                auto pos = jobs[size].pos;
+
+                if (pc == npos)
+                {
+                    caps[jobs[size].slot] = pos;
+                    continue;
+                }
+
+                for (;;)
+                {
+                    const auto bit = pc * stride + pos;
+                    if ((visited[bit / 64] >> (bit % 64)) & 1)
+                    {
+                        break;
+                    }
+
+                    visited[bit / 64] |= std::uint64_t{1} << (bit % 64);
+
+                    const auto& inst = Program.insts[pc];
+
+                    if (inst.op == regex_op::bytes)
+                    {
+                        if (pos == text.size() ||
+                            !byte_set_contains(
+                                Program.sets[inst.x],
+                                static_cast<unsigned char>(text[pos])))
+                        {
+                            break;
+                        }
+
+                        ++pc;
+                        ++pos;
+                        continue;
+                    }
+
+                    if (inst.op == regex_op::match)
+                    {
+                        if (!anchored || pos == text.size())
+                        {
+                            result = caps;
+                            return outcome::matched;
+                        }
+
+                        break;
+                    }
+
+                    if (size == max_jobs)
+                    {
+                        return outcome::overflow;
+                    }
+
+                    if (inst.op == regex_op::split)
+                    {
+                        jobs[size++] = job{inst.y, pos, 0};
+                        pc           = inst.x;
+                    }
+                    else if (inst.op == regex_op::jump)
+                    {
+                        pc = inst.x;
+                    }
+                    else
+                    {
+                        jobs[size++] = job{npos, caps[inst.x], inst.x};
+                        caps[inst.x] = pos;
+                        ++pc;
+                    }
+                }
+            }
+        }
+
+        return outcome::failed;
+    }
+};
+} // namespace detail
+} // namespace hera
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HERA_SSE2 1
+#endif
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define HERA_SSSE3 1
+#endif
+
+// small wrappers around the vector instructions used by the byte scanning
+// algorithms. Every function has a scalar fallback returning the same result.
+
+namespace hera
+{
+namespace detail
+{
+inline constexpr std::size_t simd_width = 16;
+
+/// bit i is set if p[i] equals any of `bytes`, for the 16 bytes at p
+template<typename... Bytes>
+inline std::uint32_t eq_mask16(const char* p, Bytes... bytes) noexcept
+{
+#if defined(HERA_SSE2)
+    const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const auto eq    = [&](char byte) {
+        return _mm_cmpeq_epi8(block, _mm_set1_epi8(byte));
+    };
+
+    __m128i matches = _mm_setzero_si128();
+    ((matches = _mm_or_si128(matches, eq(bytes))), ...);
+
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(matches));
+#else
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < simd_width; ++i)
+    {
+        mask |= std::uint32_t{((p[i] == bytes) || ...)} << i;
+    }
+    return mask;
+#endif
+}
+
+/// bit i is set if p[i] equals any of `bytes`, for the 64 bytes at p
+template<typename... Bytes>
+inline std::uint64_t eq_mask64(const char* p, Bytes... bytes) noexcept
+{
+#if defined(HERA_SSE2)
+    // broadcast every byte once for all four blocks
+    const __m128i needles[] = {_mm_set1_epi8(static_cast<char>(bytes))...};
+
+    std::uint64_t mask = 0;
+    for (std::size_t i = 0; i < 64; i += simd_width)
+    {
+        const auto block =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+
+        __m128i matches = _mm_setzero_si128();
+        for (const auto& needle : needles)
+        {
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, needle));
+        }
+
+        mask |= std::uint64_t{static_cast<std::uint32_t>(
+                    _mm_movemask_epi8(matches))}
+                << i;
+    }
+
+    return mask;
+#else
+    std::uint64_t mask = 0;
+
+    for (std::size_t i = 0; i < 64; i += simd_width)
+    {
+        mask |= std::uint64_t{detail::eq_mask16(p + i, bytes...)} << i;
+    }
+
+    return mask;
+#endif
+}
+
+/// reverses the bytes of every `Size` byte element in the 16 bytes at `src`
+template<std::size_t Size>
+inline void byteswap16(const std::byte* src, std::byte* dest) noexcept
+{
+    static_assert(Size == 2 || Size == 4 || Size == 8);
+
+#if defined(HERA_SSSE3)
+    constexpr auto at = [](int i) {
+        return static_cast<char>(i - i % Size + Size - 1 - i % Size);
+    };
+
+    const auto mask = _mm_setr_epi8(at(0), at(1), at(2), at(3),
+                                    at(4), at(5), at(6), at(7),
+                                    at(8), at(9), at(10), at(11),
+                                    at(12), at(13), at(14), at(15));
+
+    const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest),
+                     _mm_shuffle_epi8(block, mask));
+#elif defined(HERA_SSE2)
+    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+    // reverse the 16 bit words within every element, then the bytes within
+    // every word
+    if constexpr (Size == 4)
+    {
+        block = _mm_shufflelo_epi16(block, _MM_SHUFFLE(2, 3, 0, 1));
+        block = _mm_shufflehi_epi16(block, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+    else if constexpr (Size == 8)
+    {
+        block = _mm_shufflelo_epi16(block, _MM_SHUFFLE(0, 1, 2, 3));
+        block = _mm_shufflehi_epi16(block, _MM_SHUFFLE(0, 1, 2, 3));
+    }
+
+    block = _mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), block);
+#else
+    std::byte block[simd_width];
+    for (std::size_t i = 0; i < simd_width; ++i)
+    {
+        block[i] = src[i - i % Size + Size - 1 - i % Size];
+    }
+    std::memcpy(dest, block, simd_width);
+#endif
+}
+} // namespace detail
+} // namespace hera
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string_view>
+
+namespace hera
+{
+namespace detail
+{
+// extract the spelling of T from the signature of this very function
+template<typename T>
+constexpr std::string_view type_name() noexcept
+{
+#if defined(__clang__)
+    constexpr std::string_view signature = __PRETTY_FUNCTION__;
+    constexpr std::string_view prefix    = "T = ";
+    constexpr std::string_view suffix    = "]";
+#elif defined(__GNUC__)
+    constexpr std::string_view signature = __PRETTY_FUNCTION__;
+    constexpr std::string_view prefix    = "T = ";
+    constexpr std::string_view suffix    = "; std::string_view =";
+#elif defined(_MSC_VER)
+    constexpr std::string_view signature = __FUNCSIG__;
+    constexpr std::string_view prefix    = "type_name<";
+    constexpr std::string_view suffix    = ">(void)";
+#endif
+
+    constexpr auto first = signature.find(prefix) + prefix.size();
+    constexpr auto last  = signature.rfind(suffix);
+
+    return signature.substr(first, last - first);
+}
+} // namespace detail
+} // namespace hera
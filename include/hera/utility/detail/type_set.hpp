@@ -0,0 +1,161 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "hera/type.hpp"
+
+// constexpr building blocks for set operations on type lists. Instead of
+// recursing over the packs every type is mapped to a key and the operations
+// run as loops over arrays of those keys.
+
+namespace hera
+{
+namespace detail
+{
+/// the hash of a type and the position of its first occurrence among all
+/// types of an operation, which tells apart unnamed types spelled alike
+///
+/// Unlike the addresses of per type variables the position stays a constant
+/// expression for types with internal linkage in every build mode.
+struct type_key
+{
+    std::uint64_t hash;
+    std::size_t   id;
+
+    friend constexpr bool operator==(const type_key& lhs,
+                                     const type_key& rhs) noexcept
+    {
+        return lhs.hash == rhs.hash && lhs.id == rhs.id;
+    }
+};
+
+template<typename T, typename... Ts>
+constexpr std::size_t type_position() noexcept
+{
+    std::size_t res = 0;
+    static_cast<void>(((!std::is_same_v<T, Ts> && (++res, true)) && ...));
+    return res;
+}
+
+/// the keys of `Ts` within an operation on the types `All`
+template<typename... All>
+struct type_keys
+{
+    template<typename... Ts>
+    static constexpr std::array<type_key, sizeof...(Ts)> of{
+        type_key{hera::type_<Ts>::hash(), type_position<Ts, All...>()}...};
+};
+
+// open addressing set with linear probing, sized to stay at most half full
+template<std::size_t N>
+class type_key_set
+{
+private:
+    static constexpr std::size_t capacity_ = std::bit_ceil(2 * N + 1);
+
+    std::array<type_key, capacity_> keys_{};
+    std::array<bool, capacity_>     used_{};
+
+    constexpr std::size_t find_slot(const type_key& key) const noexcept
+    {
+        auto slot = static_cast<std::size_t>(key.hash) & (capacity_ - 1);
+
+        while (used_[slot] && !(keys_[slot] == key))
+        {
+            slot = (slot + 1) & (capacity_ - 1);
+        }
+
+        return slot;
+    }
+
+public:
+    /// returns false if the key was already present
+    constexpr bool insert(const type_key& key) noexcept
+    {
+        const auto slot = find_slot(key);
+
+        if (used_[slot])
+        {
+            return false;
+        }
+
+        keys_[slot] = key;
+        used_[slot] = true;
+        return true;
+    }
+
+    constexpr bool contains(const type_key& key) const noexcept
+    {
+        return used_[find_slot(key)];
+    }
+};
+
+enum class type_set_op
+{
+    unique,
+    intersection,
+    difference,
+};
+
+template<std::size_t N>
+struct type_selection
+{
+    std::array<std::size_t, N> indices{};
+    std::size_t                count{};
+};
+
+// select the first occurrence of each key in lhs, restricted by the presence
+// of the key in rhs depending on the operation
+template<type_set_op Op, std::size_t N, std::size_t M>
+constexpr type_selection<N>
+select_types(const std::array<type_key, N>& lhs,
+             const std::array<type_key, M>& rhs) noexcept
+{
+    type_key_set<M> other{};
+    for (const auto& key : rhs)
+    {
+        other.insert(key);
+    }
+
+    type_key_set<N>   seen{};
+    type_selection<N> selection{};
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        if (!seen.insert(lhs[i]))
+        {
+            continue;
+        }
+
+        if constexpr (Op == type_set_op::intersection)
+        {
+            if (!other.contains(lhs[i]))
+            {
+                continue;
+            }
+        }
+        else if constexpr (Op == type_set_op::difference)
+        {
+            if (other.contains(lhs[i]))
+            {
+                continue;
+            }
+        }
+
+        selection.indices[selection.count++] = i;
+    }
+
+    return selection;
+}
+
+template<typename U, typename... Ts>
+constexpr bool type_keys_contain() noexcept
+{
+    return (std::is_same_v<U, Ts> || ...);
+}
+} // namespace detail
+} // namespace hera
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+
+#include "hera/utility/detail/aggregate.hpp"
+#include "hera/view/interface.hpp"
+
+namespace hera
+{
+/// the members of an aggregate as a bounded range of references
+///
+/// Unlike `enable_aggregate_range` this works for any reflectable aggregate
+/// without opting in, the aggregate isn't copied.
+template<typename Agg> // clang-format off
+    requires std::is_object_v<Agg> &&
+             hera::detail::reflectable_aggregate<std::remove_cv_t<Agg>>
+class aggregate_view : public view_interface<aggregate_view<Agg>> // clang-format on
+{
+private:
+    Agg* base_;
+
+    static constexpr std::size_t size_ =
+        hera::detail::aggregate_size_v<std::remove_cv_t<Agg>>;
+
+public:
+    explicit constexpr aggregate_view(Agg& agg) noexcept
+        : base_{std::addressof(agg)}
+    {}
+
+    constexpr std::integral_constant<std::size_t, size_> size() const noexcept
+    {
+        return {};
+    }
+
+    template<std::size_t I> // clang-format off
+        requires (I < size_)
+    constexpr auto& get() const noexcept // clang-format on
+    {
+        return hera::detail::aggregate_get<I>(*base_);
+    }
+};
+
+template<typename Agg>
+aggregate_view(Agg&) -> aggregate_view<Agg>;
+
+template<typename Agg>
+inline constexpr bool enable_safe_range<aggregate_view<Agg>> = true;
+
+namespace views
+{
+struct aggregate_fn
+{
+    template<typename Agg>
+    constexpr auto operator()(Agg& agg) const noexcept
+        -> decltype(hera::aggregate_view{agg})
+    {
+        return hera::aggregate_view{agg};
+    }
+};
+
+inline constexpr auto aggregate = aggregate_fn{};
+} // namespace views
+} // namespace hera
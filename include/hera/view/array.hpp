@@ -41,6 +41,11 @@ public:
         assert(std::size(container) >= N);
     }
 
+    constexpr T* data() const noexcept
+    {
+        return data_;
+    }
+
     constexpr auto size() const noexcept
         -> std::integral_constant<std::size_t, N>
     {
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <bit>
+#include <type_traits>
+
+#include "hera/ranges.hpp"
+#include "hera/utility/detail/byteswap.hpp"
+#include "hera/view/detail/closure.hpp"
+#include "hera/view/transform.hpp"
+
+namespace hera
+{
+namespace detail
+{
+/// swaps integral, floating point and enum values if `Swap`, anything else is
+/// passed through
+template<bool Swap>
+struct byteswap_element
+{
+    template<typename T>
+    constexpr decltype(auto) operator()(T&& value) const noexcept
+    {
+        using value_type = std::remove_cvref_t<T>;
+
+        if constexpr (byteswappable<value_type> &&
+                      !std::is_same_v<value_type, bool>)
+        {
+            if constexpr (Swap)
+            {
+                return detail::byteswap(static_cast<value_type>(value));
+            }
+            else
+            {
+                return static_cast<value_type>(value);
+            }
+        }
+        else if constexpr (std::is_lvalue_reference_v<T>)
+        {
+            return static_cast<T&&>(value);
+        }
+        else
+        {
+            // temporaries of the underlying view would dangle
+            return value_type(static_cast<T&&>(value));
+        }
+    }
+};
+} // namespace detail
+
+namespace views
+{
+template<bool Swap>
+struct byteswap_fn : public detail::pipeable_interface<byteswap_fn<Swap>>
+{
+    template<hera::range R>
+    constexpr auto operator()(R&& r) const noexcept(
+        noexcept(hera::transform_view{std::forward<R>(r),
+                                      detail::byteswap_element<Swap>{}}))
+        -> decltype(hera::transform_view{std::forward<R>(r),
+                                         detail::byteswap_element<Swap>{}})
+    {
+        return hera::transform_view{std::forward<R>(r),
+                                    detail::byteswap_element<Swap>{}};
+    }
+};
+
+/// reverses the bytes of the arithmetic and enum elements as they're
+/// accessed
+inline constexpr auto byteswap = byteswap_fn<true>{};
+
+/// converts arithmetic and enum elements stored in `Order` to native byte
+/// order, a plain transform on hosts using `Order`
+template<std::endian Order>
+inline constexpr auto from_endian =
+    byteswap_fn<Order != std::endian::native>{};
+} // namespace views
+} // namespace hera
@@ -0,0 +1,164 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "hera/algorithm/for_each.hpp"
+#include "hera/serialize.hpp"
+#include "hera/view/aggregate.hpp"
+#include "hera/view/transform.hpp"
+#include "hera/view/zip.hpp"
+
+namespace
+{
+struct quote
+{
+    std::uint64_t id;
+    double        price;
+    std::int32_t  quantity;
+};
+
+struct order
+{
+    int                  id;
+    std::string          symbol;
+    std::unique_ptr<int> owner;
+    quote                last;
+};
+
+struct borrowed
+{
+    int&               value;
+    const std::string& name;
+};
+
+struct empty
+{};
+
+// more members than structured bindings are generated for
+struct big
+{
+    int m0;
+    int m1;
+    int m2;
+    int m3;
+    int m4;
+    int m5;
+    int m6;
+    int m7;
+    int m8;
+    int m9;
+    int m10;
+    int m11;
+    int m12;
+    int m13;
+    int m14;
+    int m15;
+    int m16;
+    int m17;
+    int m18;
+    int m19;
+    int m20;
+    int m21;
+    int m22;
+    int m23;
+    int m24;
+    int m25;
+    int m26;
+    int m27;
+    int m28;
+    int m29;
+    int m30;
+    int m31;
+    int m32;
+    int m33;
+    int m34;
+};
+} // namespace
+
+template<>
+inline constexpr bool hera::enable_aggregate_range<quote> = true;
+
+TEST_CASE("aggregate")
+{
+    SECTION("field count")
+    {
+        STATIC_REQUIRE(hera::detail::aggregate_size_v<quote> == 3);
+        STATIC_REQUIRE(hera::detail::aggregate_size_v<order> == 4);
+        STATIC_REQUIRE(hera::detail::aggregate_size_v<borrowed> == 2);
+        STATIC_REQUIRE(hera::detail::aggregate_size_v<empty> == 0);
+
+        STATIC_REQUIRE(hera::detail::reflectable_aggregate<quote>);
+        STATIC_REQUIRE(!hera::detail::reflectable_aggregate<big>);
+    }
+
+    SECTION("view")
+    {
+        order o{1, "abc", std::make_unique<int>(7), {2, 0.5, 3}};
+
+        auto fields = hera::views::aggregate(o);
+        STATIC_REQUIRE(hera::bounded_range<decltype(fields)>);
+        REQUIRE(hera::size(fields) == 4);
+
+        // no copies
+        REQUIRE(&hera::get<1>(fields) == &o.symbol);
+        REQUIRE(*hera::get<2>(fields) == 7);
+
+        hera::get<0>(fields) = 5;
+        REQUIRE(o.id == 5);
+
+        const auto& co      = o;
+        auto        cfields = hera::aggregate_view{co};
+        STATIC_REQUIRE(
+            std::is_same_v<decltype(hera::get<1>(cfields)), const std::string&>);
+
+        int         value = 1;
+        std::string name  = "n";
+        borrowed    b{value, name};
+        hera::get<0>(hera::aggregate_view{b}) = 2;
+        REQUIRE(value == 2);
+        REQUIRE(&hera::get<1>(hera::aggregate_view{b}) == &name);
+    }
+
+    SECTION("opted in aggregates are ranges")
+    {
+        STATIC_REQUIRE(hera::bounded_range<quote>);
+        STATIC_REQUIRE_FALSE(hera::range<order>);
+
+        quote q{1, 2.5, 3};
+
+        double sum = 0;
+        hera::for_each(q, [&](auto x) { sum += x; });
+        REQUIRE(sum == 6.5);
+
+        auto doubled = hera::ref_view{q} |
+                       hera::views::transform([](auto x) { return x * 2; });
+        REQUIRE(hera::get<1>(doubled) == 5.0);
+
+        const quote other{4, 5.0, 6};
+        auto        zipped = hera::zip_view{q, other};
+        REQUIRE(hera::get<0>(hera::get<2>(zipped)) == 3);
+        REQUIRE(hera::get<1>(hera::get<2>(zipped)) == 6);
+
+        hera::get<2>(q) = 10;
+        REQUIRE(q.quantity == 10);
+    }
+
+    SECTION("serialization")
+    {
+        const quote q{9, -1.5, 42};
+
+        std::array<std::byte, hera::serialized_size_v<quote>> buffer;
+        REQUIRE(hera::serialize(q, buffer) == sizeof(buffer));
+
+        quote back{};
+        REQUIRE(hera::deserialize(buffer, back) == sizeof(buffer));
+        REQUIRE(back.id == 9);
+        REQUIRE(back.price == -1.5);
+        REQUIRE(back.quantity == 42);
+    }
+}
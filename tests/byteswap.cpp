@@ -0,0 +1,133 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "hera/algorithm/byteswap.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/view/byteswap.hpp"
+#include "hera/view/ref.hpp"
+#include "hera/view/reorder.hpp"
+#include "hera/view/transform.hpp"
+
+namespace
+{
+enum class side : std::uint16_t
+{
+    buy  = 0x0100,
+    sell = 0x0200
+};
+
+template<typename T>
+void require_swapped(const std::vector<T>& original,
+                     const std::vector<T>& swapped)
+{
+    REQUIRE(original.size() == swapped.size());
+    for (std::size_t i = 0; i != original.size(); ++i)
+    {
+        REQUIRE(hera::detail::byteswap(original[i]) == swapped[i]);
+    }
+}
+
+template<typename T>
+void check_bulk()
+{
+    // odd sizes exercise the scalar tail
+    for (std::size_t n : {0, 1, 7, 16, 33, 100})
+    {
+        std::vector<T> values(n);
+        std::iota(values.begin(), values.end(), T{1});
+        for (auto& v : values)
+        {
+            v = static_cast<T>(v * 0x01020304050607);
+        }
+
+        auto swapped = values;
+        hera::byteswap(std::span<T>{swapped});
+        require_swapped(values, swapped);
+
+        std::vector<T> copy(n);
+        hera::byteswap_copy(std::span<const T>{values}, std::span<T>{copy});
+        require_swapped(values, copy);
+    }
+}
+} // namespace
+
+TEST_CASE("byteswap")
+{
+    SECTION("scalars")
+    {
+        STATIC_REQUIRE(hera::detail::byteswap(std::uint16_t{0x0102}) ==
+                       0x0201);
+        STATIC_REQUIRE(
+            hera::detail::byteswap(std::int64_t{0x0102030405060708}) ==
+            0x0807060504030201);
+        STATIC_REQUIRE(hera::detail::byteswap(side::buy) == side{0x0001});
+        STATIC_REQUIRE(hera::detail::byteswap(hera::detail::byteswap(1.5)) ==
+                       1.5);
+    }
+
+    SECTION("view")
+    {
+        auto wire = hera::tuple{std::uint32_t{0x01000000},
+                                std::string{"abc"},
+                                hera::detail::byteswap(2.5f),
+                                side{0x0100}};
+
+        auto decoded = wire | hera::views::byteswap;
+
+        REQUIRE(hera::size(decoded) == 4);
+        REQUIRE(hera::get<0>(decoded) == 1u);
+        REQUIRE(hera::get<1>(decoded) == "abc");
+        REQUIRE(hera::get<2>(decoded) == 2.5f);
+        REQUIRE(hera::get<3>(decoded) == side{0x0001});
+
+        // strings are passed through by reference
+        auto referenced = hera::ref_view{wire} | hera::views::byteswap;
+        REQUIRE(&hera::get<1>(referenced) == &hera::get<1>(wire));
+
+        auto native = wire | hera::views::from_endian<std::endian::native>;
+        REQUIRE(hera::get<0>(native) == 0x01000000u);
+    }
+
+    SECTION("composition")
+    {
+        auto wire = hera::tuple{hera::detail::byteswap(std::int32_t{7}),
+                                hera::detail::byteswap(std::int64_t{-3}),
+                                hera::detail::byteswap(std::int16_t{5})};
+
+        auto decoded =
+            wire | hera::views::reorder(hera::index_sequence<2, 0>{}) |
+            hera::views::byteswap |
+            hera::views::transform([](auto x) { return x * 2; });
+
+        REQUIRE(hera::size(decoded) == 2);
+        REQUIRE(hera::get<0>(decoded) == 10);
+        REQUIRE(hera::get<1>(decoded) == 14);
+
+        auto swapped_first = hera::views::byteswap(
+            hera::views::transform(wire, [](auto x) { return x; }));
+        REQUIRE(hera::get<1>(swapped_first) == -3);
+    }
+
+    SECTION("bulk")
+    {
+        check_bulk<std::uint16_t>();
+        check_bulk<std::uint32_t>();
+        check_bulk<std::int64_t>();
+        check_bulk<std::uint8_t>();
+
+        std::array<double, 5> doubles{1.0, -2.0, 0.5, 1e100, 3.0};
+        auto                  swapped = doubles;
+        hera::byteswap(hera::array_view{swapped});
+        hera::byteswap(std::span<double>{swapped.data(), 3});
+        REQUIRE(swapped[0] == 1.0);
+        REQUIRE(swapped[2] == 0.5);
+        REQUIRE(swapped[4] == hera::detail::byteswap(3.0));
+    }
+}
@@ -0,0 +1,224 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "hera/compare.hpp"
+#include "hera/container/pair.hpp"
+#include "hera/container/tuple.hpp"
+
+namespace
+{
+/// only orderable through `<`
+struct legacy
+{
+    int value;
+
+    friend constexpr bool operator<(const legacy& lhs, const legacy& rhs)
+    {
+        return lhs.value < rhs.value;
+    }
+
+    friend constexpr bool operator==(const legacy& lhs, const legacy& rhs)
+    {
+        return lhs.value == rhs.value;
+    }
+};
+
+/// equal whenever the ids are, whatever the bytes of the rest
+struct by_id
+{
+    std::uint32_t id;
+    std::uint32_t revision;
+
+    friend constexpr bool operator==(const by_id& lhs, const by_id& rhs)
+    {
+        return lhs.id == rhs.id;
+    }
+};
+} // namespace
+
+TEST_CASE("compare")
+{
+    SECTION("constant evaluation")
+    {
+        constexpr hera::tuple<int, char> a{1, 'a'};
+        constexpr hera::tuple<int, char> b{1, 'b'};
+
+        static_assert(a == a);
+        static_assert(a != b);
+        static_assert(a < b);
+        static_assert((b <=> a) == std::strong_ordering::greater);
+        static_assert(hera::equal(a, b, hera::index_sequence<0>{}));
+    }
+
+    SECTION("tuples")
+    {
+        using row = hera::tuple<std::int64_t, std::string, double>;
+
+        const row a{1, "b", 2.0};
+        const row b{1, "b", 2.5};
+        const row c{1, "a", 9.0};
+
+        REQUIRE(a == row{1, "b", 2.0});
+        REQUIRE(a != b);
+        REQUIRE(a < b);
+        REQUIRE(c < a);
+        REQUIRE(b > c);
+        REQUIRE(a <= a);
+        static_assert(
+            std::is_same_v<decltype(a <=> b), std::partial_ordering>);
+
+        // different element types
+        REQUIRE(hera::tuple<int, long>{1, 2} == hera::tuple<long, int>{1, 2});
+        REQUIRE(hera::tuple<int, long>{1, 2} < hera::tuple<long, int>{1, 3});
+
+        // nested tuples and `<` only elements
+        using inner  = hera::tuple<int, int>;
+        using nested = hera::tuple<inner, legacy>;
+        REQUIRE(nested{inner{1, 2}, legacy{3}} ==
+                nested{inner{1, 2}, legacy{3}});
+        REQUIRE(nested{inner{1, 2}, legacy{3}} <
+                nested{inner{1, 2}, legacy{4}});
+        REQUIRE(nested{inner{1, 3}, legacy{0}} >
+                nested{inner{1, 2}, legacy{4}});
+        static_assert(std::is_same_v<decltype(nested{} <=> nested{}),
+                                     std::weak_ordering>);
+
+        // unordered floats
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        REQUIRE(hera::tuple<int, double>{1, nan} !=
+                hera::tuple<int, double>{1, nan});
+        REQUIRE((hera::tuple<int, double>{1, nan} <=>
+                 hera::tuple<int, double>{1, 0.0}) ==
+                std::partial_ordering::unordered);
+        REQUIRE(hera::tuple<double>{0.0} == hera::tuple<double>{-0.0});
+    }
+
+    SECTION("packed tuples")
+    {
+        using ints = hera::tuple<std::uint32_t, std::int32_t>;
+        static_assert(hera::detail::bytes_equal<ints>::value);
+        static_assert(!hera::detail::bytes_ordered<ints>::value);
+
+        REQUIRE(ints{1, -1} == ints{1, -1});
+        REQUIRE(ints{1, -1} < ints{1, 0});
+        REQUIRE(ints{256, 0} > ints{1, 0});
+
+        using octets = std::array<std::uint8_t, 3>;
+        using bytes  = hera::tuple<std::uint8_t, octets>;
+        static_assert(hera::detail::bytes_ordered<bytes>::value);
+
+        REQUIRE(bytes{1, octets{2, 3, 4}} == bytes{1, octets{2, 3, 4}});
+        REQUIRE(bytes{1, octets{2, 3, 4}} < bytes{1, octets{2, 4, 0}});
+        REQUIRE(bytes{2, octets{0, 0, 0}} > bytes{1, octets{9, 9, 9}});
+
+        // padding, floats and user defined equality are compared by element
+        static_assert(!hera::detail::bytes_equal<
+                      hera::tuple<std::uint8_t, std::uint64_t>>::value);
+        static_assert(!hera::detail::bytes_equal<
+                      hera::tuple<std::int64_t, double>>::value);
+        static_assert(!hera::detail::bytes_equal<
+                      hera::tuple<std::uint32_t, by_id>>::value);
+
+        REQUIRE(hera::tuple<std::uint32_t, by_id>{1, by_id{2, 3}} ==
+                hera::tuple<std::uint32_t, by_id>{1, by_id{2, 4}});
+    }
+
+    SECTION("reference elements")
+    {
+        // the bytes are the addresses, not the values
+        std::int64_t a = 5;
+        std::int64_t b = 5;
+
+        using refs = hera::tuple<std::int64_t&>;
+        static_assert(!hera::detail::bytes_equal<refs>::value);
+        static_assert(!hera::detail::bytes_ordered<refs>::value);
+
+        REQUIRE(hera::equal(refs{a}, refs{b}));
+        REQUIRE(refs{a} == refs{b});
+        REQUIRE(hera::compare(refs{a}, refs{b}) == std::strong_ordering::equal);
+
+        using ref_pair = hera::pair<std::int64_t&, std::int64_t&>;
+        static_assert(!hera::detail::bytes_equal<ref_pair>::value);
+
+        REQUIRE(hera::equal(ref_pair{a, b}, ref_pair{b, a}));
+        REQUIRE(ref_pair{a, b} == ref_pair{b, a});
+    }
+
+    SECTION("pairs")
+    {
+        const hera::pair<int, std::string> a{1, "a"};
+
+        REQUIRE(a == hera::pair<long, std::string>{1, "a"});
+        REQUIRE(a < hera::pair<int, std::string>{1, "b"});
+        REQUIRE(a > hera::pair<int, std::string>{0, "z"});
+    }
+
+    SECTION("bounded ranges")
+    {
+        const std::array<int, 3> arr{1, 2, 3};
+
+        REQUIRE(hera::equal(arr, hera::tuple<int, long, short>{1, 2, 3}));
+        REQUIRE((hera::compare(arr, hera::tuple<int, int, int>{1, 2, 4}) < 0));
+        REQUIRE(
+            hera::less(hera::pair<int, int>{1, 5}, std::array<int, 2>{2, 0}));
+    }
+
+    SECTION("subsets of fields")
+    {
+        using row = hera::tuple<int, std::string, double>;
+
+        const row a{1, "x", 2.0};
+        const row b{1, "y", 2.0};
+
+        REQUIRE(hera::equal(a, b, hera::index_sequence<0, 2>{}));
+        REQUIRE(!hera::equal(a, b, hera::index_sequence<1>{}));
+        REQUIRE((hera::compare(a, b, hera::index_sequence<2, 0>{}) == 0));
+        REQUIRE((hera::compare(b, a, hera::index_sequence<1>{}) > 0));
+
+        // the other side only has to match at the chosen positions
+        REQUIRE(hera::equal(a,
+                            hera::tuple<int, int, double>{1, 0, 2.0},
+                            hera::index_sequence<0, 2>{}));
+    }
+
+    SECTION("sorting and deduplicating")
+    {
+        using row = hera::tuple<std::string, int, double>;
+
+        std::vector<row> rows{{"b", 2, 1.0},
+                              {"a", 1, 3.0},
+                              {"b", 1, 2.0},
+                              {"a", 1, 3.0},
+                              {"b", 2, 0.5}};
+
+        std::sort(rows.begin(), rows.end());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+        REQUIRE(rows.size() == 4);
+        REQUIRE(rows[0] == row{"a", 1, 3.0});
+        REQUIRE(rows[1] == row{"b", 1, 2.0});
+        REQUIRE(rows[2] == row{"b", 2, 0.5});
+
+        // by the first two fields only
+        std::stable_sort(
+            rows.begin(), rows.end(), [](const row& l, const row& r) {
+                return hera::less(l, r, hera::index_sequence<1, 0>{});
+            });
+        REQUIRE(hera::get<1>(rows[0]) == 1);
+        REQUIRE(hera::get<0>(rows[1]) == "b");
+
+        const auto last = std::unique(
+            rows.begin(), rows.end(), [](const row& l, const row& r) {
+                return hera::equal(l, r, hera::index_sequence<0, 1>{});
+            });
+        REQUIRE(last - rows.begin() == 3);
+    }
+}
@@ -0,0 +1,161 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "hera/csv.hpp"
+
+using namespace std::string_view_literals;
+
+TEST_CASE("csv")
+{
+    SECTION("typed rows")
+    {
+        constexpr auto text = "1,2.5,abc,true\n"
+                              "-7,1e3,,0\r\n"
+                              "\n"
+                              "+3,-0.125,x y z,false"sv;
+
+        hera::csv_reader<hera::tuple<int, double, std::string_view, bool>>
+            reader{text};
+
+        auto row = reader.read();
+        REQUIRE(row);
+        REQUIRE(hera::get<0>(*row) == 1);
+        REQUIRE(hera::get<1>(*row) == 2.5);
+        REQUIRE(hera::get<2>(*row) == "abc");
+        REQUIRE(hera::get<3>(*row));
+
+        // views point into the input
+        REQUIRE(hera::get<2>(*row).data() == text.data() + 6);
+
+        row = reader.read();
+        REQUIRE(row);
+        REQUIRE(hera::get<0>(*row) == -7);
+        REQUIRE(hera::get<1>(*row) == 1000.0);
+        REQUIRE(hera::get<2>(*row).empty());
+        REQUIRE_FALSE(hera::get<3>(*row));
+
+        row = reader.read();
+        REQUIRE(row);
+        REQUIRE(hera::get<0>(*row) == 3);
+        REQUIRE(hera::get<2>(*row) == "x y z");
+
+        REQUIRE_FALSE(reader.read());
+        REQUIRE(reader.skipped() == 0);
+    }
+
+    SECTION("projection")
+    {
+        constexpr auto text = "id,name,price,qty,venue\n"
+                              "1,apple,0.5,10,X\n"
+                              "2,pear,0.75,20,Y\n"sv;
+
+        using row_type = hera::tuple<std::int64_t, std::string_view>;
+
+        hera::csv_reader<row_type, hera::index_sequence<3, 1>> reader{
+            text, {.header = true}};
+
+        STATIC_REQUIRE(decltype(reader)::columns == 4);
+
+        std::vector<row_type> rows;
+        for (const auto& row : reader)
+        {
+            rows.push_back(row);
+        }
+
+        REQUIRE(rows.size() == 2);
+        REQUIRE(hera::get<0>(rows[0]) == 10);
+        REQUIRE(hera::get<1>(rows[0]) == "apple");
+        REQUIRE(hera::get<0>(rows[1]) == 20);
+        REQUIRE(hera::get<1>(rows[1]) == "pear");
+    }
+
+    SECTION("quoting")
+    {
+        constexpr auto text = "\"a,b\",\"say \"\"hi\"\"\",1\n"
+                              "\"multi\nline\",plain,2\n"sv;
+
+        hera::csv_reader<hera::tuple<std::string_view, std::string, int>> reader{
+            text};
+
+        auto row = reader.read();
+        REQUIRE(row);
+        REQUIRE(hera::get<0>(*row) == "a,b");
+        REQUIRE(hera::get<1>(*row) == "say \"hi\"");
+        REQUIRE(hera::get<2>(*row) == 1);
+
+        row = reader.read();
+        REQUIRE(row);
+        REQUIRE(hera::get<0>(*row) == "multi\nline");
+        REQUIRE(hera::get<1>(*row) == "plain");
+        REQUIRE(hera::get<2>(*row) == 2);
+
+        REQUIRE_FALSE(reader.read());
+    }
+
+    SECTION("tsv and optional columns")
+    {
+        constexpr auto text = "1\t\tq\n2\t4.5\tr\n"sv;
+
+        hera::csv_reader<hera::tuple<int, std::optional<double>, char>> reader{
+            text, {.delimiter = '\t'}};
+
+        auto row = reader.read();
+        REQUIRE(row);
+        REQUIRE_FALSE(hera::get<1>(*row));
+        REQUIRE(hera::get<2>(*row) == 'q');
+
+        row = reader.read();
+        REQUIRE(row);
+        REQUIRE(hera::get<1>(*row) == 4.5);
+    }
+
+    SECTION("malformed rows are skipped")
+    {
+        constexpr auto text = "1,2\n"
+                              "x,3\n"
+                              "4\n"
+                              "\"5\"junk,6\n"
+                              "7,8,extra,columns\n"
+                              "\"unterminated,9\n"sv;
+
+        hera::csv_reader<hera::tuple<int, int>> reader{text};
+
+        std::vector<int> firsts;
+        for (const auto& row : reader)
+        {
+            firsts.push_back(hera::get<0>(row) * 10 + hera::get<1>(row));
+        }
+
+        REQUIRE(firsts == std::vector<int>{12, 78});
+        REQUIRE(reader.skipped() == 4);
+    }
+
+    SECTION("long rows cross scan blocks")
+    {
+        std::string text;
+        for (int i = 0; i != 200; ++i)
+        {
+            text += std::to_string(i) + "," + std::string(i % 97, 'v') + "," +
+                    std::to_string(i * 2) + "\n";
+        }
+
+        hera::csv_reader<hera::tuple<int, std::string_view, int>> reader{text};
+
+        int count = 0;
+        for (const auto& row : reader)
+        {
+            REQUIRE(hera::get<0>(row) == count);
+            REQUIRE(hera::get<1>(row).size() ==
+                    static_cast<std::size_t>(count % 97));
+            REQUIRE(hera::get<2>(row) == count * 2);
+            ++count;
+        }
+
+        REQUIRE(count == 200);
+    }
+}
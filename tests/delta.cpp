@@ -0,0 +1,125 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "hera/container/tuple.hpp"
+#include "hera/delta.hpp"
+#include "hera/serialize.hpp"
+
+namespace
+{
+// id, price, quantity, venue, flags
+using order =
+    hera::tuple<std::uint64_t, double, std::int32_t, std::string, std::uint8_t>;
+
+using position = hera::tuple<std::uint32_t, std::int32_t, std::uint64_t>;
+} // namespace
+
+TEST_CASE("delta")
+{
+    SECTION("mask width")
+    {
+        static_assert(
+            std::is_same_v<hera::delta<order>::mask_type, std::uint8_t>);
+        static_assert(std::is_same_v<hera::detail::delta_mask_t<9>,
+                                     std::uint16_t>);
+        static_assert(std::is_same_v<hera::detail::delta_mask_t<33>,
+                                     std::uint64_t>);
+    }
+
+    SECTION("changed fields only")
+    {
+        const order prev{7, 101.5, 10, "XLON", 0};
+        order       next = prev;
+
+        REQUIRE(hera::diff(prev, next).unchanged());
+
+        hera::get<2>(next) = 15;
+        hera::get<3>(next) = "XPAR";
+
+        const auto delta = hera::diff(prev, next);
+        REQUIRE(delta.mask == 0b01100);
+        REQUIRE(delta.changed_fields() == 2);
+        REQUIRE(delta.changed(3));
+        REQUIRE(!delta.changed(0));
+        REQUIRE(delta.values.size() ==
+                sizeof(std::int32_t) + sizeof(hera::serial_length) + 4);
+
+        order patched = prev;
+        REQUIRE(hera::apply_patch(patched, delta));
+        REQUIRE(patched == next);
+
+        // reused deltas are cleared first
+        hera::delta<order> reused = delta;
+        hera::diff(next, next, reused);
+        REQUIRE(reused.unchanged());
+        REQUIRE(reused.values.empty());
+    }
+
+    SECTION("floats by bytes")
+    {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+
+        const order prev{1, nan, 0, "", 0};
+        REQUIRE(hera::diff(prev, prev).unchanged());
+
+        const order next{1, -0.0, 0, "", 0};
+        REQUIRE(hera::diff(order{1, 0.0, 0, "", 0}, next).mask == 0b10);
+    }
+
+    SECTION("packed records")
+    {
+        static_assert(hera::detail::bytes_equal<position>::value);
+
+        const position prev{1, -5, 1000};
+        REQUIRE(hera::diff(prev, prev).unchanged());
+
+        const position next{1, -6, 1000};
+        const auto     delta = hera::diff(prev, next);
+        REQUIRE(delta.mask == 0b010);
+
+        position patched = prev;
+        REQUIRE(hera::apply_patch(patched, delta));
+        REQUIRE(patched == next);
+    }
+
+    SECTION("sent between processes")
+    {
+        const order prev{7, 101.5, 10, "XLON", 0};
+        const order next{7, 102.0, 10, "XLON", 3};
+
+        const auto delta = hera::diff(prev, next);
+
+        std::vector<std::byte> wire(hera::serialized_size(delta));
+        REQUIRE(hera::serialize(delta, wire) == wire.size());
+
+        const auto received = hera::deserialize<hera::delta<order>>(wire);
+        REQUIRE(received.has_value());
+        REQUIRE(received->mask == delta.mask);
+
+        // straight from the received bytes
+        order patched = prev;
+        REQUIRE(hera::apply_patch(patched, received->mask, received->values));
+        REQUIRE(patched == next);
+    }
+
+    SECTION("malformed patches")
+    {
+        order record{7, 101.5, 10, "XLON", 0};
+
+        const std::array<std::byte, 3> short_values{};
+        REQUIRE(!hera::apply_patch(record, 0b00100, short_values));
+
+        const std::array<std::byte, 5> long_values{};
+        REQUIRE(!hera::apply_patch(record, 0b00100, long_values));
+
+        // fields past the end of the record
+        REQUIRE(!hera::apply_patch(record, 0b100000, {}));
+    }
+}
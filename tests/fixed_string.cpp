@@ -0,0 +1,118 @@
+#include <catch2/catch.hpp>
+
+#include <string_view>
+#include <tuple>
+
+#include "hera/container/fixed_string.hpp"
+#include "hera/container/static_map.hpp"
+#include "hera/regex.hpp"
+
+using namespace hera::literals;
+
+template<hera::constant_string_of<char> S>
+void verify_string(S)
+{}
+
+template<hera::basic_fixed_string Name>
+struct tagged
+{
+    static constexpr std::string_view name = Name;
+};
+
+TEST_CASE("fixed_string")
+{
+    SECTION("value")
+    {
+        constexpr hera::basic_fixed_string str = "hello";
+
+        static_assert(str.size() == 5);
+        static_assert(str[1] == 'e');
+        static_assert(std::string_view{str} == "hello");
+        static_assert(str.c_str()[5] == '\0');
+
+        static_assert(str.substr<1, 3>() == hera::basic_fixed_string{"ell"});
+        static_assert(str.substr<3>() == hera::basic_fixed_string{"lo"});
+        static_assert(str.pop_back() == hera::basic_fixed_string{"hell"});
+        static_assert(str.pop_front() == hera::basic_fixed_string{"ello"});
+        static_assert(str.push_back('!') == hera::basic_fixed_string{"hello!"});
+        static_assert(str.push_front('>') == hera::basic_fixed_string{">hello"});
+        static_assert(str.erase(1) == hera::basic_fixed_string{"hllo"});
+        static_assert(str + hera::basic_fixed_string{" world"} ==
+                      hera::basic_fixed_string{"hello world"});
+        static_assert(str.clear().empty());
+        static_assert(str.compare(hera::basic_fixed_string{"help"}) < 0);
+        static_assert(!(str == hera::basic_fixed_string{"hell"}));
+
+        REQUIRE(str.str() == "hello");
+    }
+
+    SECTION("template parameter")
+    {
+        STATIC_REQUIRE(tagged<"id">::name == "id");
+        STATIC_REQUIRE(
+            std::is_same_v<tagged<"id">, tagged<hera::basic_fixed_string{"id"}>>);
+    }
+
+    SECTION("constant")
+    {
+        auto str = "hello"_fs;
+
+        verify_string(str);
+
+        static_assert(hera::size_v<decltype(str)> == 5);
+        static_assert(decltype(hera::get<0>(str))::value == 'h');
+        static_assert(decltype(hera::get<4>(str))::value == 'o');
+        static_assert(std::tuple_size_v<decltype(str)> == 5);
+
+        static_assert(decltype(str.substr<0>() == str)::value);
+        static_assert(decltype(str.substr<1, 2>() == "el"_fs)::value);
+        static_assert(decltype(str.pop_back() == "hell"_fs)::value);
+        static_assert(decltype(str.pop_front() == "ello"_fs)::value);
+        static_assert(decltype(str.erase<4>().erase<1>() == "hll"_fs)::value);
+        static_assert(
+            decltype(str.clear().push_back<'h'>().push_front<'o'>() ==
+                     "oh"_fs)::value);
+        static_assert(decltype(str.append("!"_fs) == "hello!"_fs)::value);
+        static_assert(decltype(str != "help"_fs)::value);
+        static_assert(decltype(str.compare("help"_fs))::value < 0);
+        static_assert(decltype(str.clear().empty())::value);
+
+        REQUIRE(str[0] == 'h');
+        REQUIRE(str.str() == "hello");
+        REQUIRE(std::string_view{str.data()} == "hello");
+    }
+
+    SECTION("interconversion")
+    {
+        auto fs = "hello"_fs;
+        auto s  = "hello"_s;
+
+        static_assert(decltype(fs == s)::value);
+        static_assert(decltype(s == fs)::value);
+        static_assert(decltype(fs != "world"_s)::value);
+
+        static_assert(hera::to_fixed_string(s) == hera::basic_fixed_string{"hello"});
+        static_assert(hera::to_fixed_string(fs) == hera::basic_fixed_string{"hello"});
+
+        static_assert(
+            std::is_same_v<decltype(hera::to_basic_string(fs)), decltype(s)>);
+        static_assert(
+            std::is_same_v<decltype(hera::to_basic_string<
+                                    hera::basic_fixed_string{"hi"}>()),
+                           decltype("hi"_s)>);
+    }
+
+    SECTION("constant_string users")
+    {
+        auto map = hera::static_map{hera::pair{"host"_fs, 1},
+                                    hera::pair{"accept"_s, 2}};
+
+        REQUIRE(map.index_of("host") == 0);
+        REQUIRE(map.index_of("accept") == 1);
+
+        using re = hera::regex<"[a-z]+([0-9]+)"_fs>;
+
+        STATIC_REQUIRE(re::match("abc123"));
+        REQUIRE(hera::get<1>(*re::match_captures("abc123")) == "123");
+    }
+}
@@ -0,0 +1,116 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+
+#include "hera/format.hpp"
+
+using namespace hera::literals;
+
+namespace
+{
+template<auto Fmt, typename... Args>
+concept valid_format = requires(const Args&... args)
+{
+    hera::format<Fmt>(args...);
+};
+} // namespace
+
+TEST_CASE("format")
+{
+    SECTION("literals and arguments")
+    {
+        REQUIRE(hera::format<"{}: {} ms"_s>("GET /", 42) == "GET /: 42 ms");
+        REQUIRE(hera::format<"no arguments"_s>() == "no arguments");
+        REQUIRE(hera::format<"{}"_s>(std::string{"text"}) == "text");
+        REQUIRE(hera::format<"{{{}}}"_s>(1) == "{1}");
+        REQUIRE(hera::format<"{1} {0}"_s>("a", 'b') == "b a");
+        REQUIRE(hera::format<"{} {}"_s>(true, false) == "true false");
+        REQUIRE(hera::format<"{}{}"_s>("key="_s, 'v') == "key=v");
+    }
+
+    SECTION("integers")
+    {
+        REQUIRE(hera::format<"{}"_s>(std::numeric_limits<std::int64_t>::min()) ==
+                "-9223372036854775808");
+        REQUIRE(hera::format<"{}"_s>(std::numeric_limits<std::uint64_t>::max()) ==
+                "18446744073709551615");
+        REQUIRE(hera::format<"{:x} {:X} {:o} {:b}"_s>(255, 255, 8, 5) ==
+                "ff FF 10 101");
+        REQUIRE(hera::format<"{:c}{:d}"_s>(65, 'A') == "A65");
+    }
+
+    SECTION("minimum values in every base")
+    {
+        constexpr auto min32 = std::numeric_limits<std::int32_t>::min();
+        constexpr auto min64 = std::numeric_limits<std::int64_t>::min();
+
+        REQUIRE(hera::format<"{:b}"_s>(min32) ==
+                "-10000000000000000000000000000000");
+        REQUIRE(hera::format<"{:o}"_s>(min32) == "-20000000000");
+        REQUIRE(hera::format<"{:x}"_s>(min32) == "-80000000");
+        REQUIRE(hera::format<"{:b} {:o} {:X}"_s>(std::int8_t{-128},
+                                                 std::int8_t{-128},
+                                                 std::int8_t{-128}) ==
+                "-10000000 -200 -80");
+        REQUIRE(hera::format<"{:b}"_s>(min64) == "-1" + std::string(63, '0'));
+        REQUIRE(hera::format<"{:o}"_s>(min64) == "-1" + std::string(21, '0'));
+        REQUIRE(hera::format<"{:x}"_s>(min64) == "-8" + std::string(15, '0'));
+        REQUIRE(hera::format<"{:b}"_s>(
+                    std::numeric_limits<std::uint32_t>::max()) ==
+                std::string(32, '1'));
+    }
+
+    SECTION("floating point")
+    {
+        REQUIRE(hera::format<"{}"_s>(0.1) == "0.1");
+        REQUIRE(hera::format<"{:.2f}"_s>(3.14159) == "3.14");
+        REQUIRE(hera::format<"{:.3e}"_s>(12345.678) == "1.235e+04");
+        REQUIRE(hera::format<"{:E}"_s>(1e100) == "1.000000E+100");
+        REQUIRE(hera::format<"{:g}"_s>(0.5) == "0.5");
+        REQUIRE(hera::format<"{:f}"_s>(std::numeric_limits<double>::max())
+                    .size() == 316);
+        REQUIRE(hera::format<"{}"_s>(-1.5f) == "-1.5");
+    }
+
+    SECTION("width and alignment")
+    {
+        REQUIRE(hera::format<"[{:5}]"_s>(42) == "[   42]");
+        REQUIRE(hera::format<"[{:5}]"_s>("ab") == "[ab   ]");
+        REQUIRE(hera::format<"[{:<5}]"_s>(42) == "[42   ]");
+        REQUIRE(hera::format<"[{:*^7}]"_s>("mid") == "[**mid**]");
+        REQUIRE(hera::format<"[{:>8.2f}]"_s>(2.5) == "[    2.50]");
+        REQUIRE(hera::format<"[{:2}]"_s>(12345) == "[12345]");
+        REQUIRE(hera::format<"[{:.3}]"_s>("truncated") == "[tru]");
+    }
+
+    SECTION("size hint")
+    {
+        const std::string_view name = "request";
+
+        const auto hint = hera::format_size_hint<"{}: {} ms"_s>(name, 42);
+        REQUIRE(hint >= hera::format<"{}: {} ms"_s>(name, 42).size());
+        REQUIRE(hint == 2 + 3 + name.size() +
+                            std::numeric_limits<int>::digits10 + 2);
+
+        char  buffer[64];
+        char* end = hera::format_to<"{}={}"_s>(buffer, "x", 1.25);
+        REQUIRE(std::string_view(buffer, end - buffer) == "x=1.25");
+    }
+
+    SECTION("checked at compile time")
+    {
+        static_assert(valid_format<"{} {}"_s, int, double>);
+        static_assert(!valid_format<"{} {}"_s, int>);
+        static_assert(!valid_format<"{}"_s, int, int>);
+        static_assert(!valid_format<"{:f}"_s, int>);
+        static_assert(!valid_format<"{:x}"_s, double>);
+        static_assert(!valid_format<"{:.2}"_s, int>);
+        static_assert(!valid_format<"{"_s, int>);
+        static_assert(!valid_format<"}"_s>);
+        static_assert(!valid_format<"{0} {}"_s, int>);
+        static_assert(!valid_format<"{}"_s, std::nullptr_t>);
+    }
+}
@@ -0,0 +1,183 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hera/container/soa_vector.hpp"
+#include "hera/group_by.hpp"
+
+namespace
+{
+// customer, region, quantity, price
+using order = hera::tuple<std::int32_t, std::string, std::int64_t, double>;
+
+std::vector<order> make_orders(std::size_t rows)
+{
+    std::vector<order> res;
+    res.reserve(rows);
+
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        res.push_back(order{static_cast<std::int32_t>((i * 7919) % 1000),
+                            std::string(1, static_cast<char>('a' + i % 5)),
+                            static_cast<std::int64_t>(i % 13),
+                            static_cast<double>(i % 97) / 2});
+    }
+
+    return res;
+}
+
+struct expected_group
+{
+    std::int64_t sum   = 0;
+    double       min   = 1e300;
+    std::size_t  count = 0;
+};
+
+template<typename Key, typename F>
+std::map<Key, expected_group> expected(const std::vector<order>& orders,
+                                       F                         key)
+{
+    std::map<Key, expected_group> res;
+
+    for (const auto& o : orders)
+    {
+        auto& group = res[key(o)];
+        group.sum += hera::get<2>(o);
+        group.min = std::min(group.min, hera::get<3>(o));
+        ++group.count;
+    }
+
+    return res;
+}
+
+template<typename Table, typename Expected, typename F>
+void check(const Table& result, const Expected& groups, F key)
+{
+    REQUIRE(result.size() == groups.size());
+
+    for (std::size_t i = 0; i != result.size(); ++i)
+    {
+        const auto  row   = result.row(i);
+        const auto& group = groups.at(key(row));
+
+        REQUIRE(hera::get<Table::columns - 3>(row) == group.sum);
+        REQUIRE(hera::get<Table::columns - 2>(row) == group.min);
+        REQUIRE(hera::get<Table::columns - 1>(row) == group.count);
+    }
+}
+
+struct reading
+{
+    std::int16_t sensor;
+    float        value;
+};
+} // namespace
+
+TEST_CASE("group_by")
+{
+    const auto orders = make_orders(hera::table_batch_size * 8 + 5);
+    const auto reducers =
+        hera::tuple{hera::sum<2>, hera::min<3>, hera::count};
+
+    SECTION("integral key")
+    {
+        const auto groups = expected<std::int32_t>(
+            orders, [](const order& o) { return hera::get<0>(o); });
+        const auto key = [](const auto& row) { return hera::get<0>(row); };
+
+        const auto result = hera::group_by<0>(orders, reducers);
+        check(result, groups, key);
+
+        // groups in order of their first row
+        REQUIRE(result.column<0>()[0] == hera::get<0>(orders[0]));
+        REQUIRE(result.column<0>()[1] == hera::get<0>(orders[1]));
+
+        check(hera::group_by<0>(orders, reducers, 4), groups, key);
+    }
+
+    SECTION("string key")
+    {
+        const auto groups = expected<std::string>(
+            orders, [](const order& o) { return hera::get<1>(o); });
+        const auto key = [](const auto& row) { return hera::get<0>(row); };
+
+        const auto result = hera::group_by<1>(orders, reducers);
+        REQUIRE(result.column<0>()[0] == "a");
+        check(result, groups, key);
+        check(hera::group_by<1>(orders, reducers, 3), groups, key);
+    }
+
+    SECTION("composite key")
+    {
+        using key_type = std::pair<std::int32_t, std::string>;
+
+        const auto groups = expected<key_type>(orders, [](const order& o) {
+            return key_type{hera::get<0>(o), hera::get<1>(o)};
+        });
+        const auto key = [](const auto& row) {
+            return key_type{hera::get<0>(row), hera::get<1>(row)};
+        };
+
+        check(hera::group_by<0, 1>(orders, reducers), groups, key);
+        check(hera::group_by<0, 1>(orders, reducers, 8), groups, key);
+    }
+
+    SECTION("small integral keys index directly")
+    {
+        std::vector<reading>          readings;
+        std::map<std::int16_t, float> maxima;
+        for (int i = 0; i != 5000; ++i)
+        {
+            const reading r{static_cast<std::int16_t>(i % 300 - 150),
+                            static_cast<float>(i % 17)};
+            readings.push_back(r);
+            maxima[r.sensor] = std::max(maxima[r.sensor], r.value);
+        }
+
+        const auto soa = hera::to_soa(readings);
+
+        for (std::size_t threads : {1, 4})
+        {
+            const auto result = hera::group_by<0>(
+                soa,
+                hera::tuple{hera::max<1>, hera::avg<1>, hera::count},
+                threads);
+
+            REQUIRE(result.size() == 300);
+
+            std::size_t rows = 0;
+            for (std::size_t i = 0; i != result.size(); ++i)
+            {
+                REQUIRE(result.column<1>()[i] ==
+                        maxima.at(result.column<0>()[i]));
+                REQUIRE(result.column<2>()[i].has_value());
+                rows += result.column<3>()[i];
+            }
+            REQUIRE(rows == readings.size());
+        }
+    }
+
+    SECTION("empty rows")
+    {
+        const std::vector<order> none;
+        REQUIRE(hera::group_by<0>(none, reducers, 4).empty());
+    }
+
+    SECTION("signed zeros are one group")
+    {
+        const std::vector<hera::tuple<double, int>> values{
+            {0.0, 1}, {-0.0, 2}, {1.5, 3}};
+
+        const auto result =
+            hera::group_by<0>(values, hera::tuple{hera::sum<1>});
+
+        REQUIRE(result.size() == 2);
+        REQUIRE(result.column<1>()[0] == 3);
+    }
+}
@@ -0,0 +1,155 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "hera/container/pair.hpp"
+#include "hera/container/soa_vector.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/hash.hpp"
+
+namespace
+{
+struct trade
+{
+    std::int64_t id;
+    double       price;
+    std::string  venue;
+    std::uint8_t side;
+};
+
+struct level
+{
+    std::int32_t price;
+    std::int32_t quantity;
+};
+} // namespace
+
+template<>
+inline constexpr bool hera::enable_aggregate_range<level> = true;
+
+TEST_CASE("hash")
+{
+    SECTION("scalars")
+    {
+        REQUIRE(hera::hash(42) == hera::hash(42));
+        REQUIRE(hera::hash(42) != hera::hash(43));
+        REQUIRE(hera::hash(0) != 0);
+        REQUIRE(hera::hash(0.0) == hera::hash(-0.0));
+        REQUIRE(hera::hash(1, 1) != hera::hash(1, 2));
+    }
+
+    SECTION("strings")
+    {
+        const std::string str = "hello";
+        REQUIRE(hera::hash(str) == hera::hash(std::string_view{"hello"}));
+        REQUIRE(hera::hash(str) != hera::hash(std::string_view{"hellp"}));
+    }
+
+    SECTION("tuples")
+    {
+        using packed = hera::tuple<std::uint32_t, std::uint32_t>;
+        static_assert(hera::detail::hash_packed_v<packed>);
+
+        REQUIRE(hera::hash(packed{1, 2}) == hera::hash(packed{1, 2}));
+        REQUIRE(hera::hash(packed{1, 2}) != hera::hash(packed{2, 1}));
+
+        // padding and floats are hashed by element
+        using padded = hera::tuple<std::uint8_t, std::uint64_t, double>;
+        static_assert(!hera::detail::hash_packed_v<padded>);
+
+        REQUIRE(hera::hash(padded{1, 2, 0.0}) ==
+                hera::hash(padded{1, 2, -0.0}));
+        REQUIRE(hera::hash(padded{1, 2, 0.0}) !=
+                hera::hash(padded{2, 1, 0.0}));
+
+        // references are hashed by value, not by address
+        std::int64_t a = 5;
+        std::int64_t b = 5;
+
+        using refs = hera::tuple<std::int64_t&>;
+        static_assert(!hera::detail::hash_packed_v<refs>);
+        REQUIRE(hera::hash(refs{a}) == hera::hash(refs{b}));
+
+        using ref_pair = hera::pair<std::int64_t&, std::int64_t&>;
+        static_assert(!hera::detail::hash_packed_v<ref_pair>);
+        REQUIRE(hera::hash(ref_pair{a, b}) == hera::hash(ref_pair{b, a}));
+
+        using zeros = hera::tuple<int, double>;
+        REQUIRE(hera::hash(zeros{0, 0.0}) != 0);
+
+        const hera::tuple<std::string, int> named{"a", 1};
+        REQUIRE(hera::hash(named) ==
+                hera::hash(1, hera::hash(std::string{"a"})));
+
+        const hera::pair<std::string, double> pair{"a", 1.0};
+        REQUIRE(hera::hash(pair) == hera::hash(pair));
+
+        // aggregates which opted into being ranges
+        REQUIRE(hera::hash(level{1, 2}) == hera::hash(level{1, 2}));
+        REQUIRE(hera::hash(level{1, 2}) != hera::hash(level{2, 1}));
+    }
+
+    SECTION("ranges")
+    {
+        const std::vector<int> ints{1, 2, 3};
+        REQUIRE(hera::hash(ints) == hera::hash(std::vector<int>{1, 2, 3}));
+        REQUIRE(hera::hash(ints) != hera::hash(std::vector<int>{1, 2}));
+
+        const std::vector<std::vector<int>> nested{{1}, {2, 3}};
+        REQUIRE(hera::hash(nested) !=
+                hera::hash(std::vector<std::vector<int>>{{1, 2}, {3}}));
+
+        const std::vector<double> doubles{0.0, 1.5};
+        REQUIRE(hera::hash(doubles) ==
+                hera::hash(std::vector<double>{-0.0, 1.5}));
+
+        const std::array<std::uint16_t, 3> arr{1, 2, 3};
+        REQUIRE(hera::hash(arr) ==
+                hera::hash(std::array<std::uint16_t, 3>{1, 2, 3}));
+    }
+
+    SECTION("unordered containers")
+    {
+        std::unordered_map<std::pair<int, std::string>, int, hera::hash_fn>
+            map;
+        map[{1, "a"}] = 1;
+        map[{2, "a"}] = 2;
+        map[{1, "a"}] += 10;
+
+        REQUIRE(map.size() == 2);
+        REQUIRE(map.at({1, "a"}) == 11);
+    }
+
+    SECTION("hash_many")
+    {
+        std::vector<trade> trades;
+        for (int i = 0; i != 3000; ++i)
+        {
+            trades.push_back({i % 1000,
+                              static_cast<double>(i % 5) / 2,
+                              i % 2 == 0 ? "X" : "Y",
+                              static_cast<std::uint8_t>(i % 2)});
+        }
+
+        const auto columns = hera::to_soa(trades);
+        const auto hashes  = hera::hash_many(columns, 7);
+
+        REQUIRE(hashes.size() == trades.size());
+        for (std::size_t i = 0; i != trades.size(); ++i)
+        {
+            REQUIRE(hashes[i] == hera::hash(columns[i], 7));
+        }
+
+        // the rows repeat every 1000 rows
+        REQUIRE(hashes[0] == hashes[1000]);
+        REQUIRE(std::set<std::uint64_t>(hashes.begin(), hashes.end()).size() ==
+                1000);
+    }
+}
@@ -0,0 +1,197 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <map>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "hera/container/soa_vector.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/hash_join.hpp"
+
+namespace
+{
+// id, name
+using customer = hera::tuple<std::int64_t, std::string>;
+// order id, customer id, amount
+using order = hera::tuple<std::int64_t, std::int64_t, double>;
+
+struct line
+{
+    std::int64_t order;
+    std::int32_t item;
+};
+} // namespace
+
+TEST_CASE("hash_join")
+{
+    std::vector<customer> customers;
+    for (std::int64_t id = 0; id != 500; ++id)
+    {
+        customers.push_back(customer{id * 2, "c" + std::to_string(id * 2)});
+    }
+
+    std::vector<order> orders;
+    for (std::int64_t id = 0; id != 3000; ++id)
+    {
+        orders.push_back(order{id, (id * 37) % 1200, static_cast<double>(id)});
+    }
+
+    SECTION("one key, built on the smaller side")
+    {
+        const auto joined =
+            hera::hash_join<hera::index_sequence<1>, hera::index_sequence<0>>(
+                orders, customers);
+
+        std::size_t expected = 0;
+        for (const auto& o : orders)
+        {
+            const auto c = hera::get<1>(o);
+            expected += c % 2 == 0 && c < 1000;
+        }
+        REQUIRE(joined.size() == expected);
+        static_assert(std::ranges::random_access_range<decltype(joined)>);
+
+        for (const auto row : joined)
+        {
+            static_assert(decltype(hera::size(row))::value == 5);
+
+            REQUIRE(hera::get<1>(row) == hera::get<3>(row));
+            REQUIRE(hera::get<4>(row) ==
+                    "c" + std::to_string(hera::get<1>(row)));
+        }
+
+        // the elements are references into the joined rows
+        REQUIRE(&hera::get<0>(joined[0]) ==
+                &hera::get<0>(orders[joined.matches()[0].left]));
+        REQUIRE(&hera::get<4>(joined[0]) ==
+                &hera::get<1>(customers[joined.matches()[0].right]));
+
+        // the same matches when the sides are swapped
+        const auto swapped =
+            hera::hash_join<hera::index_sequence<0>, hera::index_sequence<1>>(
+                customers, orders);
+        REQUIRE(swapped.size() == joined.size());
+
+        std::map<std::uint32_t, std::uint32_t> by_order;
+        for (const auto match : joined.matches())
+        {
+            by_order[match.left] = match.right;
+        }
+        for (const auto match : swapped.matches())
+        {
+            REQUIRE(by_order.at(match.right) == match.left);
+        }
+    }
+
+    SECTION("duplicate keys on both sides")
+    {
+        const std::vector<hera::tuple<int, char>> left{
+            {1, 'a'}, {2, 'b'}, {1, 'c'}, {3, 'd'}};
+        const std::vector<hera::tuple<char, int>> right{
+            {'x', 1}, {'y', 1}, {'z', 4}, {'w', 2}, {'v', 1}};
+
+        const auto joined =
+            hera::hash_join<hera::index_sequence<0>, hera::index_sequence<1>>(
+                left, right);
+
+        REQUIRE(joined.size() == 7);
+
+        std::size_t ones = 0;
+        for (const auto row : joined)
+        {
+            REQUIRE(hera::get<0>(row) == hera::get<3>(row));
+            ones += hera::get<0>(row) == 1;
+        }
+        REQUIRE(ones == 6);
+    }
+
+    SECTION("low cardinality keys")
+    {
+        // customer ids of many orders, joined against mostly other ids
+        std::vector<hera::tuple<int>> built;
+        for (int i = 0; i != 2000; ++i)
+        {
+            built.push_back(hera::tuple<int>{i % 2});
+        }
+
+        std::vector<hera::tuple<int>> probed;
+        for (int i = 0; i != 4000; ++i)
+        {
+            probed.push_back(hera::tuple<int>{i % 1000 == 0 ? 1 : i + 2});
+        }
+
+        const auto joined =
+            hera::hash_join<hera::index_sequence<0>, hera::index_sequence<0>>(
+                built, probed);
+
+        REQUIRE(joined.size() == 4 * 1000);
+
+        const auto matches = joined.matches();
+        for (std::size_t i = 0; i != matches.size(); ++i)
+        {
+            REQUIRE(matches[i].left % 2 == 1);
+            if (i != 0 && matches[i].right == matches[i - 1].right)
+            {
+                REQUIRE(matches[i].left > matches[i - 1].left);
+            }
+        }
+    }
+
+    SECTION("composite and string keys")
+    {
+        const std::vector<hera::tuple<std::string, int, int>> prices{
+            {"apple", 1, 10}, {"apple", 2, 20}, {"pear", 1, 30}};
+        const std::vector<hera::tuple<int, std::string_view>> sales{
+            {2, "apple"}, {1, "pear"}, {3, "apple"}, {1, "apple"}};
+
+        const auto joined = hera::hash_join<hera::index_sequence<0, 1>,
+                                            hera::index_sequence<1, 0>>(
+            prices, sales);
+
+        REQUIRE(joined.size() == 3);
+
+        int total = 0;
+        for (const auto row : joined)
+        {
+            total += hera::get<2>(row);
+        }
+        REQUIRE(total == 60);
+
+        const auto first = joined[0].materialize();
+        REQUIRE(hera::get<0>(first) == hera::get<4>(first));
+    }
+
+    SECTION("columnar rows")
+    {
+        const auto lines = hera::to_soa(
+            std::vector<line>{{4, 100}, {7, 200}, {4, 300}, {9, 400}});
+
+        const auto joined =
+            hera::hash_join<hera::index_sequence<0>, hera::index_sequence<0>>(
+                orders, lines);
+
+        REQUIRE(joined.size() == 4);
+        for (const auto row : joined)
+        {
+            REQUIRE(hera::get<0>(row) == hera::get<3>(row));
+        }
+    }
+
+    SECTION("no matches")
+    {
+        const std::vector<order> none;
+
+        REQUIRE(
+            hera::hash_join<hera::index_sequence<1>, hera::index_sequence<0>>(
+                none, customers)
+                .empty());
+        REQUIRE(
+            hera::hash_join<hera::index_sequence<1>, hera::index_sequence<0>>(
+                orders, none)
+                .empty());
+    }
+}
@@ -0,0 +1,157 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "hera/container/tuple.hpp"
+#include "hera/json.hpp"
+
+using namespace hera::literals;
+using namespace std::string_view_literals;
+
+namespace
+{
+using point = hera::record<hera::field<"x"_s, int>, hera::field<"y"_s, int>>;
+
+using order = hera::record<hera::field<"id"_s, std::uint64_t>,
+                           hera::field<"symbol"_s, std::string>,
+                           hera::field<"price"_s, double>,
+                           hera::field<"open"_s, bool>,
+                           hera::field<"note"_s, std::optional<std::string>>,
+                           hera::field<"fills"_s, std::vector<int>>,
+                           hera::field<"at"_s, point>>;
+} // namespace
+
+TEST_CASE("json")
+{
+    SECTION("writer")
+    {
+        const order o{42, "AB\"C", 0.5, true, std::nullopt, {1, 2}, {3, -4}};
+
+        REQUIRE(hera::to_json(o) ==
+                R"({"id":42,"symbol":"AB\"C","price":0.5,"open":true,)"
+                R"("note":null,"fills":[1,2],"at":{"x":3,"y":-4}})");
+
+        REQUIRE(hera::to_json(hera::record<>{}) == "{}");
+        REQUIRE(hera::to_json(hera::tuple{1, 'c', "s"sv}) == R"([1,"c","s"])");
+        REQUIRE(hera::to_json(std::numeric_limits<double>::infinity()) ==
+                "null");
+        REQUIRE(hera::to_json("\x01\n\\"sv) == R"("\u0001\n\\")");
+
+        // keys are escaped once at compile time
+        using odd = hera::record<hera::field<"a\"b"_s, int>>;
+        REQUIRE(hera::to_json(odd{1}) == R"({"a\"b":1})");
+
+        // writing appends
+        std::string out = "x=";
+        hera::write_json(out, point{1, 2});
+        REQUIRE(out == R"(x={"x":1,"y":2})");
+    }
+
+    SECTION("round trip")
+    {
+        const order o{7, "line\nbreak", -1.25e-7, false, "é", {}, {0, 1}};
+
+        const auto text = hera::to_json(o);
+        const auto back = hera::from_json<order>(text);
+
+        REQUIRE(back);
+        REQUIRE(*back == o);
+    }
+
+    SECTION("reader")
+    {
+        constexpr auto text = R"( {
+            "at" : {"y": 2, "x": 1},
+            "unknown": [{"deep": [1, {"a": null}]}, "}", -1e3, true],
+            "symbol": "Xé😀",
+            "id": 18446744073709551615,
+            "fills": [5, 6, 7],
+            "note": "n",
+            "price": 2E2,
+            "open": true
+        } )"sv;
+
+        order o{};
+        REQUIRE(hera::read_json(text, o));
+
+        REQUIRE(o["id"_s] == std::numeric_limits<std::uint64_t>::max());
+        REQUIRE(o["symbol"_s] == "X\xc3\xa9\xf0\x9f\x98\x80");
+        REQUIRE(o["price"_s] == 200.0);
+        REQUIRE(o["open"_s]);
+        REQUIRE(o["note"_s] == "n");
+        REQUIRE(o["fills"_s] == std::vector<int>{5, 6, 7});
+        REQUIRE(o["at"_s] == point{1, 2});
+    }
+
+    SECTION("absent members keep their value")
+    {
+        point p{5, 6};
+        REQUIRE(hera::read_json(R"({"y": 1})", p));
+        REQUIRE(p == point{5, 1});
+    }
+
+    SECTION("escaped keys")
+    {
+        const auto p = hera::from_json<point>(
+            R"({"\u0078": 1, "y\u0000": 3, "y": 2})");
+        REQUIRE(p);
+        REQUIRE(*p == point{1, 2});
+    }
+
+    SECTION("string views refer into the input")
+    {
+        using view = hera::record<hera::field<"name"_s, std::string_view>>;
+
+        constexpr auto text = R"({"name": "plain"})"sv;
+        const auto     v    = hera::from_json<view>(text);
+        REQUIRE(v);
+        REQUIRE((*v)["name"_s].data() == text.data() + 10);
+
+        REQUIRE_FALSE(hera::from_json<view>(R"({"name": "esc\"aped"})"));
+    }
+
+    SECTION("fixed size arrays and tuples")
+    {
+        using shape = hera::record<hera::field<"dims"_s, std::array<int, 2>>,
+                                   hera::field<"tag"_s, hera::tuple<char, bool>>>;
+
+        const auto s =
+            hera::from_json<shape>(R"({"dims": [3, 4], "tag": ["t", false]})");
+        REQUIRE(s);
+        REQUIRE((*s)["dims"_s] == std::array{3, 4});
+        REQUIRE(hera::get<0>((*s)["tag"_s]) == 't');
+
+        REQUIRE_FALSE(hera::from_json<shape>(R"({"dims": [3]})"));
+        REQUIRE_FALSE(hera::from_json<shape>(R"({"dims": [3, 4, 5]})"));
+    }
+
+    SECTION("malformed input")
+    {
+        for (const auto text : {""sv,
+                                "{"sv,
+                                R"({"x": 1,})"sv,
+                                R"({"x": 1} trailing)"sv,
+                                R"({"x": 1.5})"sv,
+                                R"({"x": "1"})"sv,
+                                R"({"x": nan})"sv,
+                                R"({"x" 1})"sv,
+                                R"({"z": [1, 2})"sv,
+                                R"({"z": })"sv,
+                                R"({"\q": 1})"sv,
+                                R"({"x": 99999999999})"sv})
+        {
+            INFO(text);
+            REQUIRE_FALSE(hera::from_json<point>(text));
+        }
+
+        REQUIRE_FALSE(hera::from_json<std::string>(R"("\ud800")"));
+        REQUIRE_FALSE(hera::from_json<std::string>("\"a\nb\""));
+        REQUIRE_FALSE(hera::from_json<std::uint32_t>("-1"));
+    }
+}
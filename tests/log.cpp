@@ -0,0 +1,202 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "hera/log.hpp"
+
+using namespace hera::literals;
+
+namespace
+{
+std::string read_all(std::FILE* file)
+{
+    std::rewind(file);
+
+    std::string result;
+    char        buffer[256];
+
+    for (std::size_t n; (n = std::fread(buffer, 1, sizeof(buffer), file)) != 0;)
+    {
+        result.append(buffer, n);
+    }
+
+    return result;
+}
+
+std::vector<std::string> lines_of(const std::string& text)
+{
+    std::vector<std::string> lines;
+
+    std::size_t first = 0;
+    for (auto last = text.find('\n'); last != std::string::npos;
+         last      = text.find('\n', first))
+    {
+        lines.push_back(text.substr(first, last - first));
+        first = last + 1;
+    }
+
+    std::sort(lines.begin(), lines.end());
+    return lines;
+}
+
+bool decode(const std::string& binary)
+{
+    std::FILE* in  = std::tmpfile();
+    std::FILE* out = std::tmpfile();
+
+    std::fwrite(binary.data(), 1, binary.size(), in);
+    std::rewind(in);
+
+    const bool res = hera::log_decode(in, out);
+
+    std::fclose(in);
+    std::fclose(out);
+    return res;
+}
+
+template<auto Fmt, typename... Args>
+concept loggable = requires(const Args&... args)
+{
+    hera::log<Fmt>(args...);
+};
+} // namespace
+
+TEST_CASE("log")
+{
+    SECTION("layout")
+    {
+        using layout = hera::detail::log_layout<
+            hera::type_list<std::uint8_t, std::string_view, double, char>>;
+
+        static_assert(layout::kinds[0] == hera::log_arg_kind::u8);
+        static_assert(layout::kinds[1] == hera::log_arg_kind::text);
+        static_assert(layout::kinds[2] == hera::log_arg_kind::f64);
+        static_assert(layout::offsets[1] == 1);
+        static_assert(layout::offsets[2] == 5);
+        static_assert(layout::offsets[3] == 13);
+        static_assert(layout::fixed_size == 14);
+
+        std::byte buffer[64];
+        layout::encode(buffer, 7, "text", 2.5, 'c');
+        REQUIRE(layout::size(7, "text", 2.5, 'c') == 18);
+
+        const auto decoded = layout::decode(buffer);
+        REQUIRE(hera::get<0>(decoded) == 7);
+        REQUIRE(hera::get<1>(decoded) == "text");
+        REQUIRE(hera::get<2>(decoded) == 2.5);
+        REQUIRE(hera::get<3>(decoded) == 'c');
+    }
+
+    SECTION("text output")
+    {
+        std::FILE* file = std::tmpfile();
+        REQUIRE(file != nullptr);
+
+        {
+            hera::log_backend backend{file};
+
+            std::thread worker{[] {
+                for (int i = 0; i < 3; ++i)
+                {
+                    hera::log<"worker {} {:.1f}"_s>(i, i * 0.5);
+                }
+            }};
+
+            hera::log<"request {} took {} ms"_s>("/index.html", 12);
+            hera::log<"[{:>4}]"_s>(std::string{"ab"});
+
+            worker.join();
+            backend.flush();
+
+            REQUIRE(lines_of(read_all(file)) ==
+                    std::vector<std::string>{"[  ab]",
+                                             "request /index.html took 12 ms",
+                                             "worker 0 0.0",
+                                             "worker 1 0.5",
+                                             "worker 2 1.0"});
+        }
+
+        std::fclose(file);
+    }
+
+    SECTION("binary output")
+    {
+        std::FILE* binary = std::tmpfile();
+        std::FILE* text   = std::tmpfile();
+        REQUIRE(binary != nullptr);
+        REQUIRE(text != nullptr);
+
+        {
+            hera::log_backend backend{binary, hera::log_output::binary};
+
+            for (std::uint16_t i = 0; i < 2; ++i)
+            {
+                hera::log<"{:x} {} {}"_s>(i + 10, true, "x"_s);
+            }
+
+            hera::log<"{:c}{:5.2f}|{:<3}|"_s>('a', 3.14159f, std::int8_t{-1});
+        }
+
+        std::rewind(binary);
+        REQUIRE(hera::log_decode(binary, text));
+        REQUIRE(read_all(text) == "a true x\nb true x\na 3.14|-1 |\n");
+
+        std::fclose(binary);
+        std::fclose(text);
+    }
+
+    SECTION("malformed binary input")
+    {
+        std::FILE* binary = std::tmpfile();
+        REQUIRE(binary != nullptr);
+
+        {
+            hera::log_backend backend{binary, hera::log_output::binary};
+            hera::log<"{} {:b} {}"_s>("name"_s, std::int32_t{-5}, 2.5);
+        }
+
+        const std::string valid = read_all(binary);
+        std::fclose(binary);
+
+        REQUIRE(decode(valid));
+
+        // magic, then the descriptor and the record
+        constexpr std::size_t format  = 8 + 1 + 8 + 4;
+        constexpr std::size_t payload = format + 10 + 4 + 3 + 1 + 8 + 4;
+        REQUIRE(valid.size() == payload + 4 + 4 + 8 + 4);
+
+        // cut anywhere within the record
+        for (std::size_t size = payload - 12; size < valid.size(); ++size)
+        {
+            REQUIRE_FALSE(decode(valid.substr(0, size)));
+        }
+
+        // a text longer than the record
+        std::string corrupt = valid;
+        corrupt[payload]    = '\x7f';
+        REQUIRE_FALSE(decode(corrupt));
+
+        // a spec integers don't accept
+        corrupt             = valid;
+        corrupt[format + 5] = 'f';
+        REQUIRE_FALSE(decode(corrupt));
+
+        // an unterminated slot
+        corrupt             = valid;
+        corrupt[format + 1] = 'x';
+        REQUIRE_FALSE(decode(corrupt));
+    }
+
+    SECTION("checked at compile time")
+    {
+        static_assert(loggable<"{} {}"_s, int, std::string_view>);
+        static_assert(!loggable<"{} {}"_s, int>);
+        static_assert(!loggable<"{}"_s, long double>);
+    }
+}
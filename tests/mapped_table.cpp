@@ -0,0 +1,163 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <vector>
+
+#include "hera/mapped_table.hpp"
+#include "hera/view/reorder.hpp"
+#include "hera/view/transform.hpp"
+
+namespace
+{
+using trade = hera::tuple<std::uint64_t, std::uint32_t, double, std::int8_t>;
+
+constexpr auto opposite_endian = std::endian::native == std::endian::little
+                                     ? std::endian::big
+                                     : std::endian::little;
+
+std::vector<std::byte> make_trades(std::size_t count)
+{
+    std::vector<std::byte> buffer(count * hera::serialized_size_v<trade>);
+
+    std::span<std::byte> out{buffer};
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        const auto written = hera::serialize(
+            trade{std::uint64_t{i} << 33,
+                  static_cast<std::uint32_t>(i * 3),
+                  i * 0.5,
+                  static_cast<std::int8_t>(-static_cast<int>(i % 100))},
+            out);
+        out = out.subspan(*written);
+    }
+
+    return buffer;
+}
+} // namespace
+
+TEST_CASE("mapped_table")
+{
+    using record = hera::mapped_record_view<trade>;
+
+    STATIC_REQUIRE(record::record_size == 21);
+    STATIC_REQUIRE(record::offsets ==
+                   std::array<std::size_t, 4>{0, 8, 12, 20});
+    STATIC_REQUIRE(hera::size_v<record> == 4);
+    STATIC_REQUIRE(
+        std::random_access_iterator<hera::mapped_table<trade>::iterator>);
+
+    const auto buffer = make_trades(100);
+
+    SECTION("record view")
+    {
+        // the second record starts at an odd address
+        const record rec{buffer.data() + record::record_size};
+
+        REQUIRE(hera::get<0>(rec) == std::uint64_t{1} << 33);
+        REQUIRE(hera::get<1>(rec) == 3u);
+        REQUIRE(hera::get<2>(rec) == 0.5);
+        REQUIRE(hera::get<3>(rec) == -1);
+
+        const auto [id, qty, price, side] = rec;
+        REQUIRE(qty == 3u);
+        REQUIRE(side == -1);
+
+        auto copy = rec.materialize();
+        REQUIRE(hera::get<2>(copy) == 0.5);
+    }
+
+    SECTION("views")
+    {
+        const record rec{buffer.data() + 2 * record::record_size};
+
+        auto reordered =
+            rec | hera::views::reorder(hera::index_sequence<2, 1>{});
+        REQUIRE(hera::get<0>(reordered) == 1.0);
+        REQUIRE(hera::get<1>(reordered) == 6u);
+
+        auto doubled =
+            rec | hera::views::transform([](auto x) { return x + x; });
+        REQUIRE(hera::get<1>(doubled) == 12u);
+    }
+
+    SECTION("buffer")
+    {
+        hera::mapped_table<trade> table{std::span<const std::byte>{
+            buffer.data(), buffer.size() - 1}};
+
+        // the incomplete last record is dropped
+        REQUIRE(table.size() == 99);
+        REQUIRE(std::distance(table.begin(), table.end()) == 99);
+        REQUIRE(hera::get<1>(table[10]) == 30u);
+        REQUIRE(hera::get<1>(table.begin()[11]) == 33u);
+
+        const auto count =
+            std::count_if(table.begin(), table.end(), [](auto rec) {
+                return hera::get<3>(rec) < -50;
+            });
+        REQUIRE(count == 48);
+    }
+
+    SECTION("file")
+    {
+        const char* path = "hera_mapped_table.bin";
+
+        std::FILE* file = std::fopen(path, "wb");
+        REQUIRE(file != nullptr);
+        std::fwrite(buffer.data(), 1, buffer.size(), file);
+        std::fclose(file);
+
+        {
+            auto table = hera::mapped_table<trade>::open(path);
+            REQUIRE(table);
+            REQUIRE(table->size() == 100);
+
+            double sum = 0;
+            for (auto rec : *table)
+            {
+                sum += hera::get<2>(rec);
+            }
+            REQUIRE(sum == 0.5 * (99 * 100 / 2));
+
+            table->advise(hera::mapped_advice::random);
+
+            auto moved = std::move(*table);
+            REQUIRE(hera::get<0>(moved[99]) == std::uint64_t{99} << 33);
+            REQUIRE(table->empty());
+        }
+
+        std::remove(path);
+
+        REQUIRE_FALSE(hera::mapped_table<trade>::open(path));
+    }
+
+    SECTION("byte order")
+    {
+        using swapped_record =
+            hera::mapped_record_view<trade, opposite_endian>;
+
+        std::array<std::byte, 21> bytes{};
+        hera::detail::store_unaligned<opposite_endian>(bytes.data(),
+                                                       std::uint64_t{42});
+        hera::detail::store_unaligned<opposite_endian>(bytes.data() + 8,
+                                                       std::uint32_t{7});
+        hera::detail::store_unaligned<opposite_endian>(bytes.data() + 12, 2.5);
+        hera::detail::store_unaligned<opposite_endian>(bytes.data() + 20,
+                                                       std::int8_t{-3});
+
+        const swapped_record rec{bytes.data()};
+
+        REQUIRE(hera::get<0>(rec) == 42u);
+        REQUIRE(hera::get<1>(rec) == 7u);
+        REQUIRE(hera::get<2>(rec) == 2.5);
+        REQUIRE(hera::get<3>(rec) == -3);
+
+        STATIC_REQUIRE(hera::detail::byteswap(std::uint32_t{0x01020304}) ==
+                       0x04030201);
+    }
+}
@@ -0,0 +1,189 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "hera/container/soa_vector.hpp"
+#include "hera/container/tuple.hpp"
+#include "hera/radix_sort.hpp"
+
+namespace
+{
+using row = hera::tuple<std::int32_t, double, std::array<char, 3>, int>;
+
+std::vector<row> make_rows(std::size_t size)
+{
+    std::vector<row> res;
+
+    std::uint64_t state = 7;
+    const auto    next  = [&] {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return state >> 33;
+    };
+
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        res.push_back(
+            row{static_cast<std::int32_t>(next() % 2001) - 1000,
+                (static_cast<double>(next() % 2001) - 1000) / 8,
+                std::array<char, 3>{static_cast<char>("aZ\xe9"[next() % 3]),
+                                    static_cast<char>('a' + next() % 3),
+                                    0},
+                static_cast<int>(i)});
+    }
+
+    return res;
+}
+
+template<std::size_t I>
+bool element_less(const row& lhs, const row& rhs)
+{
+    if constexpr (I == 2)
+    {
+        return std::memcmp(
+                   hera::get<2>(lhs).data(), hera::get<2>(rhs).data(), 3) < 0;
+    }
+    else
+    {
+        return hera::get<I>(lhs) < hera::get<I>(rhs);
+    }
+}
+
+struct point
+{
+    std::int16_t x;
+    float        y;
+};
+} // namespace
+
+TEST_CASE("radix_sort")
+{
+    const auto rows = make_rows(5000);
+
+    SECTION("signed integers")
+    {
+        auto sorted   = rows;
+        auto expected = rows;
+
+        hera::radix_sort<0>(sorted);
+        std::stable_sort(expected.begin(), expected.end(), element_less<0>);
+
+        // stable, the last element tells the original position
+        for (std::size_t i = 0; i != rows.size(); ++i)
+        {
+            REQUIRE(hera::get<3>(sorted[i]) == hera::get<3>(expected[i]));
+        }
+    }
+
+    SECTION("floats")
+    {
+        const auto order = hera::radix_sort_indices<1>(rows);
+
+        REQUIRE(order.size() == rows.size());
+        REQUIRE(std::is_sorted(order.begin(),
+                               order.end(),
+                               [&](std::uint32_t lhs, std::uint32_t rhs) {
+                                   return hera::get<1>(rows[lhs]) <
+                                          hera::get<1>(rows[rhs]);
+                               }));
+
+        std::vector<hera::tuple<double>> specials{
+            {std::numeric_limits<double>::infinity()},
+            {-0.0},
+            {-std::numeric_limits<double>::infinity()},
+            {-1e-300},
+            {std::numeric_limits<double>::lowest()},
+            {0.0},
+            {1e-300}};
+        hera::radix_sort<0>(specials);
+
+        REQUIRE(hera::get<0>(specials[0]) ==
+                -std::numeric_limits<double>::infinity());
+        REQUIRE(hera::get<0>(specials[1]) ==
+                std::numeric_limits<double>::lowest());
+        REQUIRE(hera::get<0>(specials[2]) == -1e-300);
+        REQUIRE(std::signbit(hera::get<0>(specials[3])));
+        REQUIRE_FALSE(std::signbit(hera::get<0>(specials[4])));
+        REQUIRE(hera::get<0>(specials[5]) == 1e-300);
+        REQUIRE(hera::get<0>(specials[6]) ==
+                std::numeric_limits<double>::infinity());
+    }
+
+    SECTION("fixed length strings then integers")
+    {
+        auto sorted   = rows;
+        auto expected = rows;
+
+        hera::radix_sort<2, 0>(sorted);
+        std::stable_sort(
+            expected.begin(), expected.end(), [](const row& l, const row& r) {
+                if (element_less<2>(l, r))
+                {
+                    return true;
+                }
+                return !element_less<2>(r, l) && element_less<0>(l, r);
+            });
+
+        for (std::size_t i = 0; i != rows.size(); ++i)
+        {
+            REQUIRE(hera::get<3>(sorted[i]) == hera::get<3>(expected[i]));
+        }
+
+        // bytes compare unsigned
+        REQUIRE(hera::get<2>(sorted.back())[0] == '\xe9');
+
+        std::vector<hera::tuple<hera::fixed_string<2>>> names{
+            {"cb"}, {"ab"}, {"ca"}};
+        hera::radix_sort<0>(names);
+        REQUIRE(std::string_view{hera::get<0>(names[0])} == "ab");
+        REQUIRE(std::string_view{hera::get<0>(names[2])} == "cb");
+    }
+
+    SECTION("rows which can only be permuted by index")
+    {
+        const auto soa = hera::to_soa(std::vector<point>{
+            {3, 1.0f}, {-2, 0.5f}, {3, -1.0f}, {0, 2.0f}});
+
+        const auto order = hera::radix_sort_indices<0, 1>(soa);
+        REQUIRE(order == std::vector<std::uint32_t>{1, 3, 2, 0});
+    }
+
+    SECTION("wide move only rows")
+    {
+        std::vector<hera::tuple<std::uint8_t, std::unique_ptr<int>>> values;
+        for (int i = 0; i != 300; ++i)
+        {
+            values.emplace_back(static_cast<std::uint8_t>(255 - i % 256),
+                                std::make_unique<int>(i));
+        }
+
+        hera::radix_sort<0>(values);
+
+        REQUIRE(hera::get<0>(values.front()) == 0);
+        REQUIRE(*hera::get<1>(values.front()) == 255);
+        REQUIRE(hera::get<0>(values.back()) == 255);
+        REQUIRE(std::is_sorted(
+            values.begin(), values.end(), [](const auto& l, const auto& r) {
+                return hera::get<0>(l) < hera::get<0>(r);
+            }));
+    }
+
+    SECTION("empty and constant keys")
+    {
+        std::vector<hera::tuple<std::uint64_t>> none;
+        hera::radix_sort<0>(none);
+        REQUIRE(none.empty());
+
+        const std::vector<hera::tuple<std::uint64_t, int>> same{
+            {5, 2}, {5, 0}, {5, 1}};
+        REQUIRE(hera::radix_sort_indices<0>(same) ==
+                std::vector<std::uint32_t>{0, 1, 2});
+    }
+}
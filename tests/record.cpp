@@ -0,0 +1,62 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <string_view>
+
+#include "hera/container/record.hpp"
+
+using namespace hera::literals;
+
+TEST_CASE("record")
+{
+    using person = hera::record<hera::field<"name"_s, std::string>,
+                                hera::field<"age"_s, int>,
+                                hera::field<"height"_s, double>>;
+
+    STATIC_REQUIRE(hera::bounded_range<person>);
+    STATIC_REQUIRE(hera::size_v<person> == 3);
+    STATIC_REQUIRE(person::index_of("height"_s) == 2);
+
+    person p{"ada", 36, 1.65};
+
+    REQUIRE(p.get<"name"_s>() == "ada");
+    REQUIRE(p["age"_s] == 36);
+    REQUIRE(hera::get<2>(p) == 1.65);
+
+    p.get<"age"_s>() = 37;
+    REQUIRE(hera::get<1>(p) == 37);
+    REQUIRE(&p["age"_s] == &hera::get<1>(p.values()));
+
+    SECTION("runtime keys")
+    {
+        REQUIRE(person::keys()[1] == "age");
+        REQUIRE(person::index_of("name") == 0);
+        REQUIRE(person::index_of("height") == 2);
+        REQUIRE(person::index_of("weight") == person::npos);
+        REQUIRE(person::index_of("") == person::npos);
+    }
+
+    SECTION("structured bindings")
+    {
+        auto& [name, age, height] = p;
+        REQUIRE(name == "ada");
+        REQUIRE(age == 37);
+        REQUIRE(&height == &p["height"_s]);
+    }
+
+    SECTION("constexpr")
+    {
+        constexpr hera::record<hera::field<"x"_s, int>, hera::field<"y"_s, int>>
+            point{1, 2};
+
+        STATIC_REQUIRE(point["y"_s] == 2);
+        STATIC_REQUIRE(point.get<"x"_s>() == 1);
+        STATIC_REQUIRE(point == decltype(point){1, 2});
+    }
+
+    SECTION("moves")
+    {
+        auto name = std::move(p).get<"name"_s>();
+        REQUIRE(name == "ada");
+    }
+}
@@ -0,0 +1,148 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <string_view>
+
+#include "hera/regex.hpp"
+
+using namespace hera::literals;
+
+namespace
+{
+template<auto Pattern>
+concept valid_regex = requires
+{
+    typename hera::regex<Pattern>;
+    hera::regex<Pattern>::groups;
+};
+} // namespace
+
+TEST_CASE("regex")
+{
+    SECTION("match")
+    {
+        using identifier = hera::regex<"[A-Za-z_]\\w*"_s>;
+
+        REQUIRE(identifier::match("snake_case_42"));
+        REQUIRE(identifier::match("_"));
+        REQUIRE_FALSE(identifier::match("42abc"));
+        REQUIRE_FALSE(identifier::match(""));
+        REQUIRE_FALSE(identifier::match("with space"));
+
+        using number = hera::regex<"-?(?:0|[1-9]\\d*)(?:\\.\\d+)?"_s>;
+
+        REQUIRE(number::match("0"));
+        REQUIRE(number::match("-12.5"));
+        REQUIRE_FALSE(number::match("012"));
+        REQUIRE_FALSE(number::match("1."));
+
+        static_assert(number::match("3.14"));
+        static_assert(!number::match("pi"));
+    }
+
+    SECTION("quantifiers and alternation")
+    {
+        using hex = hera::regex<"0x[0-9a-fA-F]{2,4}"_s>;
+
+        REQUIRE(hex::match("0xff"));
+        REQUIRE(hex::match("0xBEEF"));
+        REQUIRE_FALSE(hex::match("0xf"));
+        REQUIRE_FALSE(hex::match("0xBEEF0"));
+
+        using level = hera::regex<"INFO|WARN(?:ING)?|ERROR"_s>;
+
+        REQUIRE(level::match("WARN"));
+        REQUIRE(level::match("WARNING"));
+        REQUIRE_FALSE(level::match("WARNI"));
+
+        using escaped = hera::regex<"a\\.b[^\\s.]+"_s>;
+
+        REQUIRE(escaped::match("a.bc"));
+        REQUIRE_FALSE(escaped::match("axbc"));
+        REQUIRE_FALSE(escaped::match("a.b c"));
+        REQUIRE_FALSE(escaped::match("a.b."));
+    }
+
+    SECTION("search")
+    {
+        using error = hera::regex<"ERROR \\d+"_s>;
+
+        REQUIRE(error::search("12:00 ERROR 503 upstream"));
+        REQUIRE_FALSE(error::search("12:00 ERROR upstream"));
+        REQUIRE(hera::regex<"x*"_s>::search(""));
+    }
+
+    SECTION("captures")
+    {
+        using request = hera::regex<
+            "(GET|POST) (/[^ ?]*)(?:\\?(\\S*))? HTTP/1\\.[01]"_s>;
+        static_assert(request::groups == 3);
+
+        auto captures = request::match_captures("GET /index.html HTTP/1.1");
+        REQUIRE(captures);
+        REQUIRE(hera::get<0>(*captures) == "GET /index.html HTTP/1.1");
+        REQUIRE(hera::get<1>(*captures) == "GET");
+        REQUIRE(hera::get<2>(*captures) == "/index.html");
+        REQUIRE(hera::get<3>(*captures).data() == nullptr);
+
+        captures = request::match_captures("POST /api?id=3 HTTP/1.0");
+        REQUIRE(captures);
+        REQUIRE(hera::get<2>(*captures) == "/api");
+        REQUIRE(hera::get<3>(*captures) == "id=3");
+
+        REQUIRE_FALSE(request::match_captures("PUT /index.html HTTP/1.1"));
+    }
+
+    SECTION("search captures")
+    {
+        using key_value = hera::regex<"(\\w+)=(\\w*)"_s>;
+
+        const auto captures = key_value::search_captures("ms=812 path=/api");
+        REQUIRE(captures);
+        REQUIRE(hera::get<0>(*captures) == "ms=812");
+        REQUIRE(hera::get<1>(*captures) == "ms");
+        REQUIRE(hera::get<2>(*captures) == "812");
+
+        REQUIRE_FALSE(key_value::search_captures("no pairs here"));
+
+        // greedy and lazy quantifiers
+        REQUIRE(hera::get<1>(
+                    *hera::regex<"<(.+)>"_s>::search_captures("<a><b>")) ==
+                "a><b");
+        REQUIRE(hera::get<1>(
+                    *hera::regex<"<(.+?)>"_s>::search_captures("<a><b>")) ==
+                "a");
+
+        constexpr auto digits =
+            hera::regex<"(\\d+)"_s>::search_captures("abc 123 def");
+        static_assert(hera::get<1>(*digits) == "123");
+    }
+
+    SECTION("long inputs")
+    {
+        // too long for the backtracker, captures come from the Pike VM
+        const std::string text = std::string(20000, 'a') + "=" +
+                                 std::string(100, 'b') + " tail";
+
+        using key_value = hera::regex<"(a+)=(b*)"_s>;
+
+        const auto captures = key_value::search_captures(text);
+        REQUIRE(captures);
+        REQUIRE(hera::get<1>(*captures).size() == 20000);
+        REQUIRE(hera::get<2>(*captures).size() == 100);
+
+        const auto full =
+            hera::regex<"(a+)=(b*) (\\w+)"_s>::match_captures(text);
+        REQUIRE(full);
+        REQUIRE(hera::get<3>(*full) == "tail");
+    }
+
+    SECTION("invalid patterns")
+    {
+        static_assert(valid_regex<"a(b)c"_s>);
+        static_assert(!valid_regex<"a(b"_s>);
+        static_assert(!valid_regex<"a{3,1}"_s>);
+        static_assert(!valid_regex<"[z-a]"_s>);
+        static_assert(!valid_regex<"*a"_s>);
+    }
+}
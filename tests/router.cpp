@@ -0,0 +1,74 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <string_view>
+
+#include "hera/router.hpp"
+
+using namespace hera::literals;
+
+TEST_CASE("router")
+{
+    auto routes = hera::router{hera::tuple{
+        hera::pair{"/"_s, [] { return std::string{"root"}; }},
+        hera::pair{"/users"_s, [] { return std::string{"users"}; }},
+        hera::pair{"/users/*/posts"_s, [] { return std::string{"posts"}; }},
+        hera::pair{"/users/*"_s, [] { return std::string{"user"}; }},
+        hera::pair{"/static/*"_s, [] { return std::string{"static"}; }},
+        hera::pair{"/internal/metrics/prometheus"_s,
+                   [] { return std::string{"metrics"}; }}}};
+
+    REQUIRE(routes.route("/") == "root");
+    REQUIRE(routes.route("/users") == "users");
+    REQUIRE(routes.route("/users/42") == "user");
+    REQUIRE(routes.route("/users/") == "user");
+    REQUIRE(routes.route("/users/42/posts") == "posts");
+    REQUIRE(routes.route("/static/css/site.css") == "static");
+    // a trailing wildcard swallows the remaining segments as well
+    REQUIRE(routes.route("/users/42/comments") == "user");
+    REQUIRE(routes.route("/internal/metrics/prometheus") == "metrics");
+
+    REQUIRE_FALSE(routes.route("").has_value());
+    REQUIRE_FALSE(routes.route("/user").has_value());
+    REQUIRE_FALSE(routes.route("/internal/metrics/prometheu").has_value());
+    REQUIRE_FALSE(routes.route("/internal/metrics/prometheusx").has_value());
+    REQUIRE_FALSE(routes.route("/internal/metrics/Prometheus").has_value());
+
+    SECTION("match")
+    {
+        static_assert(decltype(routes)::match("/users/7") == 3);
+        static_assert(decltype(routes)::match("/static/") == 4);
+        static_assert(decltype(routes)::match("/nope") == decltype(routes)::npos);
+
+        // the runtime path compares literal runs in one go
+        const std::string path = "/internal/metrics/prometheus";
+        REQUIRE(routes.match(path) == 5);
+    }
+
+    SECTION("precedence")
+    {
+        // the earlier pattern wins if both match
+        auto topics = hera::router{
+            hera::pair{"metrics.cpu"_s, [](int x) { return x + 1; }},
+            hera::pair{"metrics.*"_s, [](int x) { return x + 2; }},
+            hera::pair{"*"_s, [](int x) { return x + 3; }}};
+
+        REQUIRE(topics.route("metrics.cpu", 0) == 1);
+        REQUIRE(topics.route("metrics.mem", 0) == 2);
+        REQUIRE(topics.route("metrics.", 0) == 2);
+        REQUIRE(topics.route("logs/error", 0) == 3);
+        REQUIRE(topics.route("", 0) == 3);
+    }
+
+    SECTION("void handlers")
+    {
+        int  hits = 0;
+        auto r    = hera::router{hera::pair{"a*c"_s, [&] { ++hits; }}};
+
+        REQUIRE(r.route("abbbc"));
+        REQUIRE(r.route("ac"));
+        REQUIRE_FALSE(r.route("ab/c"));
+        REQUIRE_FALSE(r.route("acb"));
+        REQUIRE(hits == 2);
+    }
+}
@@ -0,0 +1,103 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <string_view>
+
+#include "hera/algorithm/search.hpp"
+
+using namespace hera::literals;
+
+namespace
+{
+// verifies every strategy against std::string_view::find at every alignment
+template<typename Needle>
+void check_against_find(Needle needle, const std::string& haystack)
+{
+    const auto expected = static_cast<std::string_view>(needle);
+
+    for (std::size_t offset = 0; offset <= haystack.size(); ++offset)
+    {
+        const auto view = std::string_view{haystack}.substr(offset);
+        REQUIRE(hera::search(view, needle) == view.find(expected));
+    }
+}
+} // namespace
+
+TEST_CASE("search")
+{
+    const std::string log =
+        "2024-01-01T00:00:00Z INFO  request served path=/index.html ms=3\n"
+        "2024-01-01T00:00:01Z WARN  slow request path=/api/users ms=812\n"
+        "2024-01-01T00:00:02Z ERROR connection reset by peer while reading "
+        "response header from upstream\n"
+        "2024-01-01T00:00:03Z INFO  aaaaaaaaaaaaaaaaaaaaaaaaaab\n";
+
+    REQUIRE(hera::search(log, "ERROR"_s) == log.find("ERROR"));
+    REQUIRE(hera::search(log, "\n"_s) == log.find('\n'));
+    REQUIRE(hera::search(log, "FATAL"_s) == std::string_view::npos);
+    REQUIRE(hera::search(log, ""_s) == 0);
+
+    check_against_find("E"_s, log);
+    check_against_find("ms="_s, log);
+    check_against_find("aab"_s, log);
+    check_against_find("aaaaaaaaaaaaaaaaaab"_s, log);
+    check_against_find("path=/api/users ms="_s, log);
+    check_against_find("connection reset by peer while reading response"_s,
+                       log);
+    check_against_find("connection reset by peer while reading responsE"_s,
+                       log);
+
+    SECTION("constexpr")
+    {
+        static_assert(hera::search("hello world", "world"_s) == 6);
+        static_assert(hera::search("hello world", "worlds"_s) ==
+                      std::string_view::npos);
+    }
+}
+
+TEST_CASE("search_any")
+{
+    const auto needles = hera::tuple{"ERROR"_s, "WARN"_s, "RROR x"_s};
+
+    const std::string log = "INFO ok\nWARN slow\nERROR failed\n";
+
+    auto result = hera::search_any(log, needles);
+    REQUIRE(result);
+    REQUIRE(result.position == log.find("WARN"));
+    REQUIRE(result.index == 1);
+
+    result = hera::search_any(std::string_view{log}.substr(12), needles);
+    REQUIRE(result.position == log.find("ERROR") - 12);
+    REQUIRE(result.index == 0);
+
+    REQUIRE_FALSE(hera::search_any("INFO only", needles));
+
+    SECTION("overlapping needles")
+    {
+        // the needle ending first wins
+        const auto overlapping = hera::tuple{"abcd"_s, "bc"_s};
+
+        result = hera::search_any("xxabcd", overlapping);
+        REQUIRE(result.position == 3);
+        REQUIRE(result.index == 1);
+
+        static_assert(hera::search_any("xxabcd", overlapping).index == 1);
+    }
+
+    SECTION("long haystack")
+    {
+        std::string haystack(100, 'E');
+        haystack += "ERRO WARM ERROR";
+
+        result = hera::search_any(haystack, needles);
+        REQUIRE(result.position == haystack.size() - 5);
+        REQUIRE(result.index == 0);
+    }
+
+    SECTION("empty needle")
+    {
+        result = hera::search_any("abc", hera::tuple{"c"_s, ""_s});
+        REQUIRE(result.position == 0);
+        REQUIRE(result.index == 1);
+    }
+}
@@ -0,0 +1,275 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "hera/serialize.hpp"
+
+namespace
+{
+struct point
+{
+    float x;
+    float y;
+};
+
+/// padded and not a range
+class stamp
+{
+public:
+    stamp() = default;
+
+    stamp(std::int64_t t, char z) : time_{t}, zone_{z}
+    {}
+
+    std::int64_t time() const
+    {
+        return time_;
+    }
+
+    char zone() const
+    {
+        return zone_;
+    }
+
+private:
+    std::int64_t time_;
+    char         zone_;
+};
+
+std::size_t offset_of(const auto& object, const auto& field)
+{
+    return reinterpret_cast<const std::byte*>(&field) -
+           reinterpret_cast<const std::byte*>(&object);
+}
+} // namespace
+
+template<>
+inline constexpr bool hera::enable_aggregate_range<point> = true;
+
+TEST_CASE("serialize")
+{
+    SECTION("fixed size")
+    {
+        using record = hera::tuple<std::uint64_t, std::uint32_t, std::uint32_t>;
+
+        STATIC_REQUIRE(hera::serialized_size_v<record> == 16);
+        STATIC_REQUIRE(hera::detail::serial_layout<record>::packed);
+
+        record value{std::uint64_t{1} << 40, 7u, 9u};
+
+        std::array<std::byte, 16> buffer{};
+        REQUIRE(hera::serialize(value, buffer) == 16);
+
+        std::uint64_t first;
+        std::memcpy(&first, buffer.data(), sizeof(first));
+        REQUIRE(first == std::uint64_t{1} << 40);
+
+        auto res = hera::deserialize<record>(buffer);
+        REQUIRE(res);
+        REQUIRE(hera::get<0>(*res) == std::uint64_t{1} << 40);
+        REQUIRE(hera::get<1>(*res) == 7u);
+        REQUIRE(hera::get<2>(*res) == 9u);
+
+        std::array<std::byte, 15> small{};
+        REQUIRE_FALSE(hera::serialize(value, small));
+        REQUIRE_FALSE(hera::deserialize<record>(small));
+    }
+
+    SECTION("padding is dropped")
+    {
+        using record = hera::tuple<std::uint8_t, std::uint32_t, std::uint16_t>;
+        using layout = hera::detail::serial_layout<record>;
+
+        STATIC_REQUIRE(hera::serialized_size_v<record> == 7);
+        STATIC_REQUIRE_FALSE(layout::packed);
+
+        record value{std::uint8_t{1}, 2u, std::uint16_t{3}};
+
+        // the predicted layout has to match the actual one for runs to work
+        REQUIRE(offset_of(value, hera::get<0>(value)) == layout::offsets[0]);
+        REQUIRE(offset_of(value, hera::get<1>(value)) == layout::offsets[1]);
+        REQUIRE(offset_of(value, hera::get<2>(value)) == layout::offsets[2]);
+        STATIC_REQUIRE(layout::run_fields[1] == 2);
+
+        std::array<std::byte, 7> buffer{};
+        REQUIRE(hera::serialize(value, buffer) == 7);
+
+        auto res = hera::deserialize<record>(buffer);
+        REQUIRE(res);
+        REQUIRE(hera::get<0>(*res) == 1);
+        REQUIRE(hera::get<1>(*res) == 2u);
+        REQUIRE(hera::get<2>(*res) == 3);
+    }
+
+    SECTION("tail padded elements")
+    {
+        // not standard layout, a following tuple element may live in its
+        // tail padding
+        using stamp_fields = hera::tuple<std::int64_t, char>;
+        using record       = hera::tuple<stamp_fields, char, std::uint16_t>;
+        using layout       = hera::detail::serial_layout<record>;
+
+        STATIC_REQUIRE(hera::serialized_size_v<record> == 8 + 1 + 1 + 2);
+        STATIC_REQUIRE_FALSE(layout::native);
+
+        record value{stamp_fields{-3, 'u'}, 'k', std::uint16_t{9}};
+
+        std::array<std::byte, 12> buffer{};
+        REQUIRE(hera::serialize(value, buffer) == 12);
+
+        record res{stamp_fields{7, 'a'}, 'b', std::uint16_t{1}};
+        REQUIRE(hera::deserialize(buffer, res) == 12);
+        REQUIRE(hera::get<0>(hera::get<0>(res)) == -3);
+        REQUIRE(hera::get<1>(hera::get<0>(res)) == 'u');
+        REQUIRE(hera::get<1>(res) == 'k');
+        REQUIRE(hera::get<2>(res) == 9);
+    }
+
+    SECTION("nested")
+    {
+        using record = hera::tuple<point,
+                                   std::array<std::int16_t, 3>,
+                                   hera::tuple<char, double>>;
+
+        STATIC_REQUIRE(hera::serialized_size_v<record> == 8 + 6 + 9);
+
+        record value{point{1.5f, -2.f},
+                     std::array<std::int16_t, 3>{4, 5, 6},
+                     hera::tuple<char, double>{'x', 0.25}};
+
+        std::array<std::byte, 23> buffer{};
+        REQUIRE(hera::serialize(value, buffer) == 23);
+
+        auto res = hera::deserialize<record>(buffer);
+        REQUIRE(res);
+        REQUIRE(hera::get<0>(*res).y == -2.f);
+        REQUIRE(hera::get<1>(*res)[2] == 6);
+        REQUIRE(hera::get<0>(hera::get<2>(*res)) == 'x');
+        REQUIRE(hera::get<1>(hera::get<2>(*res)) == 0.25);
+    }
+
+    SECTION("bools")
+    {
+        using record = hera::tuple<std::uint8_t, bool, std::string_view>;
+
+        STATIC_REQUIRE(hera::detail::serial_fixed_size<hera::tuple<bool>>() == 1);
+
+        std::array<std::byte, 8> buffer{};
+        REQUIRE(hera::serialize(record{std::uint8_t{4}, true, "ab"}, buffer) ==
+                8);
+        REQUIRE(buffer[1] == std::byte{1});
+
+        auto res = hera::deserialize<record>(buffer);
+        REQUIRE(res);
+        REQUIRE(hera::get<1>(*res));
+
+        buffer[1] = std::byte{2};
+        REQUIRE_FALSE(hera::deserialize<record>(buffer));
+
+        using flags = hera::tuple<std::span<const bool>>;
+
+        std::array<std::byte, 7> seq{};
+        REQUIRE(hera::serialize(flags{std::array{true, false, true}}, seq) ==
+                7);
+        REQUIRE(hera::deserialize<flags>(seq));
+
+        seq[6] = std::byte{0xff};
+        REQUIRE_FALSE(hera::deserialize<flags>(seq));
+    }
+
+    SECTION("variable size")
+    {
+        using record = hera::tuple<std::uint32_t,
+                                   std::string,
+                                   std::vector<std::int64_t>,
+                                   std::string_view,
+                                   std::uint16_t>;
+
+        record value{42u,
+                     std::string{"hello"},
+                     std::vector<std::int64_t>{-1, 2, -3},
+                     std::string_view{"world"},
+                     std::uint16_t{7}};
+
+        const auto size = hera::serialized_size(value);
+        REQUIRE(size == 4 + (4 + 5) + (4 + 24) + (4 + 5) + 2);
+
+        std::vector<std::byte> buffer(size);
+        REQUIRE(hera::serialize(value, buffer) == size);
+
+        auto res = hera::deserialize<record>(buffer);
+        REQUIRE(res);
+        REQUIRE(hera::get<0>(*res) == 42u);
+        REQUIRE(hera::get<1>(*res) == "hello");
+        REQUIRE(hera::get<2>(*res) == std::vector<std::int64_t>{-1, 2, -3});
+        REQUIRE(hera::get<3>(*res) == "world");
+        REQUIRE(hera::get<4>(*res) == 7);
+
+        // views refer into the input
+        REQUIRE(reinterpret_cast<const std::byte*>(hera::get<3>(*res).data()) >=
+                buffer.data());
+        REQUIRE(reinterpret_cast<const std::byte*>(hera::get<3>(*res).data()) <
+                buffer.data() + buffer.size());
+
+        for (std::size_t n = 0; n != size; ++n)
+        {
+            REQUIRE_FALSE(hera::deserialize<record>(
+                std::span<const std::byte>{buffer.data(), n}));
+            REQUIRE_FALSE(hera::serialize(
+                value, std::span<std::byte>{buffer.data(), n}));
+        }
+    }
+
+    SECTION("stream of records")
+    {
+        using record = hera::tuple<std::uint16_t, std::string>;
+
+        std::vector<std::byte> buffer(64);
+        std::span<std::byte>   out{buffer};
+
+        for (std::uint16_t i = 0; i != 3; ++i)
+        {
+            auto written = hera::serialize(
+                record{i, std::string(i, 'a')}, out);
+            REQUIRE(written);
+            out = out.subspan(*written);
+        }
+
+        std::span<const std::byte> in{buffer};
+        for (std::uint16_t i = 0; i != 3; ++i)
+        {
+            record value;
+            auto   read = hera::deserialize(in, value);
+            REQUIRE(read);
+            REQUIRE(hera::get<0>(value) == i);
+            REQUIRE(hera::get<1>(value) == std::string(i, 'a'));
+            in = in.subspan(*read);
+        }
+    }
+
+    SECTION("constraints")
+    {
+        STATIC_REQUIRE(hera::serializable<hera::tuple<int, std::string>>);
+        STATIC_REQUIRE_FALSE(hera::serializable<hera::tuple<int*>>);
+        STATIC_REQUIRE_FALSE(
+            hera::serializable<hera::tuple<std::vector<std::string>>>);
+        STATIC_REQUIRE(hera::serializable<hera::tuple<std::span<const int>>>);
+        STATIC_REQUIRE_FALSE(
+            hera::deserializable<hera::tuple<std::span<const int>>>);
+        STATIC_REQUIRE(
+            hera::deserializable<hera::tuple<std::span<const std::byte>>>);
+
+        // types with padding are only written field by field
+        STATIC_REQUIRE_FALSE(hera::serializable<hera::tuple<stamp>>);
+        STATIC_REQUIRE_FALSE(
+            hera::serializable<hera::tuple<std::optional<int>>>);
+        STATIC_REQUIRE(hera::serializable<hera::tuple<point>>);
+    }
+}
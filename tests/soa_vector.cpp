@@ -0,0 +1,209 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hera/algorithm/byteswap.hpp"
+#include "hera/algorithm/for_each.hpp"
+#include "hera/container/soa_vector.hpp"
+
+namespace
+{
+struct order
+{
+    std::uint64_t id;
+    std::string   symbol;
+    double        price;
+    bool          open;
+
+    friend bool operator==(const order&, const order&) = default;
+};
+
+struct owned
+{
+    int                  key;
+    std::unique_ptr<int> value;
+};
+
+int fragile_live        = 0;
+int fragile_copies_left = 0;
+
+/// copies throw once `fragile_copies_left` are used up, moves may throw too
+struct fragile
+{
+    int value;
+
+    explicit fragile(int v) : value{v}
+    {
+        ++fragile_live;
+    }
+
+    fragile(const fragile& other) : value{other.value}
+    {
+        if (fragile_copies_left == 0)
+        {
+            throw std::runtime_error{"copy"};
+        }
+        --fragile_copies_left;
+        ++fragile_live;
+    }
+
+    fragile(fragile&& other) : value{other.value}
+    {
+        ++fragile_live;
+    }
+
+    ~fragile()
+    {
+        --fragile_live;
+    }
+};
+
+struct labelled
+{
+    std::string name;
+    fragile     part;
+};
+
+std::vector<order> make_orders()
+{
+    return {{1, "AB", 1.5, true}, {2, "CD", 2.5, false}, {3, "EF", 0.5, true}};
+}
+} // namespace
+
+TEST_CASE("soa_vector")
+{
+    SECTION("to_soa")
+    {
+        const auto orders = make_orders();
+        auto       soa    = hera::to_soa(orders);
+
+        STATIC_REQUIRE(decltype(soa)::fields == 4);
+        REQUIRE(soa.size() == 3);
+
+        auto prices = soa.column<2>();
+        REQUIRE(std::vector<double>(prices.begin(), prices.end()) ==
+                std::vector<double>{1.5, 2.5, 0.5});
+
+        // bool members get a real column, not std::vector<bool>
+        const auto open = soa.column<3>();
+        REQUIRE(std::count(open.begin(), open.end(), true) == 2);
+
+        REQUIRE(soa[1].materialize() == orders[1]);
+        REQUIRE(soa.to_aos() == orders);
+    }
+
+    SECTION("row proxies refer into the columns")
+    {
+        auto soa = hera::to_soa(make_orders());
+
+        auto row = soa[2];
+        REQUIRE(hera::size(row) == 4);
+        REQUIRE(&hera::get<1>(row) == &soa.column<1>()[2]);
+
+        hera::get<2>(row) = 9.0;
+        REQUIRE(soa.column<2>()[2] == 9.0);
+
+        std::string text;
+        hera::for_each(soa[0], [&](const auto& member) {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(member)>,
+                                         std::string>)
+            {
+                text += member;
+            }
+        });
+        REQUIRE(text == "AB");
+
+        double sum = 0;
+        for (auto r : std::as_const(soa))
+        {
+            sum += hera::get<2>(r);
+        }
+        REQUIRE(sum == 13.0);
+
+        auto it = std::find_if(soa.begin(), soa.end(), [](auto r) {
+            return hera::get<0>(r) == 2;
+        });
+        REQUIRE(it - soa.begin() == 1);
+        REQUIRE(hera::get<1>(*it) == "CD");
+    }
+
+    SECTION("builder")
+    {
+        hera::soa_builder<owned> builder;
+
+        for (int i = 0; i != 100; ++i)
+        {
+            builder.push_back(owned{i, std::make_unique<int>(i * 2)});
+        }
+        REQUIRE(builder.size() == 100);
+
+        auto soa = std::move(builder).build();
+        REQUIRE(soa.size() == 100);
+        REQUIRE(soa.column<0>()[99] == 99);
+        REQUIRE(*soa.column<1>()[50] == 100);
+
+        auto moved = std::move(soa);
+        REQUIRE(moved.size() == 100);
+        REQUIRE(soa.empty());
+    }
+
+    SECTION("throwing members")
+    {
+        const labelled row{std::string(64, 'x'), fragile{1}};
+
+        {
+            hera::soa_builder<labelled> builder;
+
+            // the name is copied before the part throws
+            fragile_copies_left = 0;
+            REQUIRE_THROWS(builder.push_back(row));
+            REQUIRE(builder.size() == 0);
+            REQUIRE(fragile_live == 1);
+
+            fragile_copies_left = 8;
+            for (int i = 0; i != 8; ++i)
+            {
+                builder.push_back(row);
+            }
+
+            // growing copies the parts, the names are only moved once they
+            // all succeeded
+            fragile_copies_left = 3;
+            REQUIRE_THROWS(builder.push_back(row));
+            REQUIRE(fragile_live == 9);
+
+            fragile_copies_left = 9;
+            builder.push_back(row);
+
+            const auto soa = std::move(builder).build();
+            REQUIRE(soa.size() == 9);
+            for (const auto r : soa)
+            {
+                REQUIRE(hera::get<0>(r) == row.name);
+                REQUIRE(hera::get<1>(r).value == 1);
+            }
+        }
+
+        REQUIRE(fragile_live == 1);
+    }
+
+    SECTION("columns are spans")
+    {
+        std::vector<order> orders;
+        for (std::uint64_t i = 0; i != 20; ++i)
+        {
+            orders.push_back({i, "", 0, false});
+        }
+
+        auto soa = hera::to_soa(std::move(orders));
+        hera::byteswap(soa.column<0>());
+        REQUIRE(soa.column<0>()[1] == hera::detail::byteswap(std::uint64_t{1}));
+    }
+}
@@ -0,0 +1,131 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <string_view>
+
+#include "hera/container/static_map.hpp"
+
+using namespace hera::literals;
+
+TEST_CASE("static_map")
+{
+    auto map = hera::static_map{hera::pair{"content-type"_s, 1},
+                                hera::pair{"content-length"_s, 2},
+                                hera::pair{"host"_s, 3},
+                                hera::pair{"accept"_s, 4}};
+
+    static_assert(hera::size_v<decltype(map)> == 4);
+
+    REQUIRE(map.index_of("content-type") == 0);
+    REQUIRE(map.index_of("content-length") == 1);
+    REQUIRE(map.index_of("host") == 2);
+    REQUIRE(map.index_of("accept") == 3);
+
+    REQUIRE(map.index_of("") == map.npos);
+    REQUIRE(map.index_of("hos") == map.npos);
+    REQUIRE(map.index_of("content-typ") == map.npos);
+    REQUIRE_FALSE(map.contains("Host"));
+
+    REQUIRE(*map.find("host") == 3);
+    REQUIRE(map.find("via") == nullptr);
+
+    *map.find("host") = 42;
+    REQUIRE(map["host"_s] == 42);
+    REQUIRE(hera::get<0>(map) == 1);
+
+    SECTION("constexpr")
+    {
+        constexpr auto cmap = hera::make_static_map(hera::pair{"a"_s, 'a'},
+                                                    hera::pair{"b"_s, 'b'});
+
+        static_assert(*cmap.find("b") == 'b');
+        static_assert(cmap.find("c") == nullptr);
+        static_assert(cmap["a"_s] == 'a');
+    }
+
+    SECTION("heterogeneous visit")
+    {
+        auto handlers = hera::static_map{
+            hera::pair{"int"_s, 5},
+            hera::pair{"str"_s, std::string{"five"}},
+            hera::pair{"len"_s, [](std::string_view s) { return s.size(); }}};
+
+        auto describe = [](const auto& value) -> std::string {
+            using value_type = std::decay_t<decltype(value)>;
+
+            if constexpr (std::is_same_v<value_type, int>)
+            {
+                return std::to_string(value);
+            }
+            else if constexpr (std::is_same_v<value_type, std::string>)
+            {
+                return value;
+            }
+            else
+            {
+                return std::to_string(value("hello"));
+            }
+        };
+
+        REQUIRE(handlers.visit("int", describe) == "5");
+        REQUIRE(handlers.visit("str", describe) == "five");
+        REQUIRE(handlers.visit("len", describe) == "5");
+        REQUIRE_FALSE(handlers.visit("nope", describe).has_value());
+
+        std::size_t calls = 0;
+        REQUIRE(handlers.visit("str", [&](const auto&) { ++calls; }));
+        REQUIRE_FALSE(handlers.visit("", [&](const auto&) { ++calls; }));
+        REQUIRE(calls == 1);
+    }
+
+    SECTION("many keys")
+    {
+        auto big = hera::static_map{
+            hera::pair{"k00"_s, 0},  hera::pair{"k01"_s, 1},
+            hera::pair{"k02"_s, 2},  hera::pair{"k03"_s, 3},
+            hera::pair{"k04"_s, 4},  hera::pair{"k05"_s, 5},
+            hera::pair{"k06"_s, 6},  hera::pair{"k07"_s, 7},
+            hera::pair{"k08"_s, 8},  hera::pair{"k09"_s, 9},
+            hera::pair{"k10"_s, 10}, hera::pair{"k11"_s, 11},
+            hera::pair{"k12"_s, 12}, hera::pair{"k13"_s, 13},
+            hera::pair{"k14"_s, 14}, hera::pair{"k15"_s, 15},
+            hera::pair{"k16"_s, 16}, hera::pair{"a-much-longer-key"_s, 17}};
+
+        for (std::size_t i = 0; i < big.keys().size(); ++i)
+        {
+            REQUIRE(big.index_of(big.keys()[i]) == i);
+            REQUIRE(*big.find(big.keys()[i]) == static_cast<int>(i));
+        }
+
+        REQUIRE(big.index_of("k17") == big.npos);
+        REQUIRE(big.index_of("a-much-longer-kez") == big.npos);
+    }
+
+    SECTION("key lengths")
+    {
+        // covers every tail length of the word wise hash
+        auto lengths = hera::static_map{hera::pair{"a"_s, 1},
+                                        hera::pair{"ab"_s, 2},
+                                        hera::pair{"abc"_s, 3},
+                                        hera::pair{"abcd"_s, 4},
+                                        hera::pair{"abcde"_s, 5},
+                                        hera::pair{"abcdef"_s, 6},
+                                        hera::pair{"abcdefg"_s, 7},
+                                        hera::pair{"abcdefgh"_s, 8},
+                                        hera::pair{"abcdefghi"_s, 9},
+                                        hera::pair{"abcdefghijklmno"_s, 15}};
+
+        const std::string alphabet = "abcdefghijklmnopqrstuvwxyz";
+
+        for (std::size_t len = 1; len < 10; ++len)
+        {
+            // a separate buffer so the lookup has to compare the contents
+            const std::string key = alphabet.substr(0, len);
+            REQUIRE(*lengths.find(key) == static_cast<int>(len));
+        }
+
+        REQUIRE(*lengths.find(alphabet.substr(0, 15)) == 15);
+        REQUIRE(lengths.find(alphabet.substr(0, 10)) == nullptr);
+        REQUIRE(lengths.find(alphabet.substr(1, 3)) == nullptr);
+    }
+}
@@ -0,0 +1,76 @@
+#include <catch2/catch.hpp>
+
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "hera/container/string_table.hpp"
+
+using namespace hera::literals;
+
+TEST_CASE("string_table")
+{
+    using table = hera::string_table<"request.latency"_s,
+                                     "latency"_s,
+                                     "request.count"_s,
+                                     "count"_s,
+                                     ""_s,
+                                     "errors"_s>;
+
+    SECTION("id to string")
+    {
+        REQUIRE(table::view(0) == "request.latency");
+        REQUIRE(table::view(1) == "latency");
+        REQUIRE(table::view(3) == "count");
+        REQUIRE(table::view(4) == "");
+        REQUIRE(table{}[5] == "errors");
+        REQUIRE(hera::get<2>(table{}) == "request.count");
+        REQUIRE(std::strcmp(table::c_str(1), "latency") == 0);
+
+        static_assert(table::view(5) == "errors");
+        static_assert(hera::size(table{}) == 6);
+    }
+
+    SECTION("suffixes are shared")
+    {
+        // "latency", "count" and "" live inside of the longer strings
+        REQUIRE(table::blob().size() == std::strlen("request.latency") + 1 +
+                                            std::strlen("request.count") + 1 +
+                                            std::strlen("errors") + 1);
+
+        const auto* first = table::blob().data();
+        const auto* last  = first + table::blob().size();
+
+        for (std::size_t id = 0; id < table::npos; ++id)
+        {
+            REQUIRE(table::view(id).data() >= first);
+            REQUIRE(table::view(id).data() + table::view(id).size() < last);
+        }
+    }
+
+    SECTION("string to id")
+    {
+        const std::string query = "request.count";
+
+        REQUIRE(table::id_of(query) == 2);
+        REQUIRE(table::id_of("latency") == 1);
+        REQUIRE(table::id_of("") == 4);
+        REQUIRE(table::id_of("request") == table::npos);
+        REQUIRE(table::id_of("errors.") == table::npos);
+        REQUIRE_FALSE(table::contains("missing"));
+
+        static_assert(table::id_of("count"_s) == 3);
+        static_assert(table::id_of(std::string_view{"errors"}) == 5);
+    }
+
+    SECTION("make_string_table")
+    {
+        constexpr auto small = hera::make_string_table("a"_s, "b"_s);
+        static_assert(small.view(1) == "b");
+        static_assert(small.id_of("a") == 0);
+
+        constexpr auto none = hera::make_string_table();
+        static_assert(none.id_of("a") == none.npos);
+        static_assert(none.blob().size() == 1);
+    }
+}
@@ -0,0 +1,143 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "hera/table.hpp"
+
+namespace
+{
+// id, price, quantity, venue
+using trades = hera::table<std::int64_t, double, std::int32_t, std::string>;
+
+trades make_trades(std::size_t rows)
+{
+    trades res;
+    res.reserve(rows);
+
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        res.push_back(static_cast<std::int64_t>(i),
+                      static_cast<double>(i % 100) / 4,
+                      static_cast<std::int32_t>(i % 7),
+                      i % 3 == 0 ? "X" : "Y");
+    }
+
+    return res;
+}
+} // namespace
+
+TEST_CASE("table")
+{
+    // spans several batches and ends in a partial one
+    constexpr std::size_t rows = hera::table_batch_size * 3 + 17;
+    const auto            tbl  = make_trades(rows);
+
+    REQUIRE(tbl.size() == rows);
+    REQUIRE(tbl.column<3>()[3] == "X");
+    REQUIRE(hera::get<1>(tbl.row(6)) == 1.5);
+
+    SECTION("filters")
+    {
+        auto cheap = tbl.query().where<1>([](double p) { return p < 5; });
+
+        std::size_t expected = 0;
+        for (std::size_t i = 0; i != rows; ++i)
+        {
+            expected += static_cast<double>(i % 100) / 4 < 5;
+        }
+        REQUIRE(cheap.count() == expected);
+
+        auto both = cheap.where<2, 3>([](std::int32_t q, const std::string& v) {
+            return q == 3 && v == "X";
+        });
+
+        const auto selection = both.selection();
+        REQUIRE_FALSE(selection.empty());
+        for (const auto row : selection)
+        {
+            REQUIRE(row % 100 < 20);
+            REQUIRE(row % 7 == 3);
+            REQUIRE(row % 3 == 0);
+        }
+        REQUIRE(both.count() == selection.size());
+
+        REQUIRE(tbl.query().where<0>([](auto) { return false; }).count() == 0);
+    }
+
+    SECTION("projection")
+    {
+        auto query = tbl.query()
+                         .select<3, 0>()
+                         .where<1>([](std::int64_t id) { return id >= 10; })
+                         .where<1>([](std::int64_t id) { return id < 13; });
+
+        std::vector<std::string> venues;
+        query.for_each([&](const std::string& venue, std::int64_t id) {
+            venues.push_back(venue + std::to_string(id));
+        });
+        REQUIRE(venues == std::vector<std::string>{"Y10", "Y11", "X12"});
+
+        const auto collected = query.select(hera::index_sequence<1>{}).collect();
+        STATIC_REQUIRE(decltype(collected)::columns == 1);
+        REQUIRE(collected.size() == 3);
+        REQUIRE(collected.column<0>()[2] == 12);
+    }
+
+    SECTION("aggregates")
+    {
+        const auto res =
+            tbl.query()
+                .where<2>([](std::int32_t q) { return q > 0; })
+                .aggregate(hera::tuple{
+                    hera::sum<2>,
+                    hera::min<1>,
+                    hera::max<0>,
+                    hera::avg<2>,
+                    hera::count,
+                    hera::sum_of<1, 2>([](double p, std::int32_t q) {
+                        return p * q;
+                    })});
+
+        std::int64_t expected_total    = 0;
+        double       expected_notional = 0;
+        std::size_t  expected_count    = 0;
+        std::int64_t expected_max      = 0;
+        for (std::size_t i = 0; i != rows; ++i)
+        {
+            if (i % 7 > 0)
+            {
+                expected_total += i % 7;
+                expected_notional += static_cast<double>(i % 100) / 4 * (i % 7);
+                expected_max = static_cast<std::int64_t>(i);
+                ++expected_count;
+            }
+        }
+
+        STATIC_REQUIRE(
+            std::is_same_v<decltype(hera::get<0>(res)), const std::int64_t&>);
+        REQUIRE(hera::get<0>(res) == expected_total);
+        REQUIRE(hera::get<1>(res) == 0.0);
+        REQUIRE(hera::get<2>(res) == expected_max);
+        REQUIRE(*hera::get<3>(res) ==
+                Approx(static_cast<double>(expected_total) /
+                       static_cast<double>(expected_count)));
+        REQUIRE(hera::get<4>(res) == expected_count);
+        REQUIRE(hera::get<5>(res) == Approx(expected_notional));
+
+        const auto none = tbl.query()
+                              .where<0>([](auto) { return false; })
+                              .aggregate(hera::tuple{hera::min<0>});
+        REQUIRE_FALSE(hera::get<0>(none));
+    }
+
+    SECTION("empty table")
+    {
+        const trades empty;
+        REQUIRE(empty.query().count() == 0);
+        REQUIRE(hera::get<0>(empty.query().aggregate(hera::tuple{hera::sum<1>})) ==
+                0.0);
+    }
+}
@@ -1,14 +1,40 @@
 #include <catch2/catch.hpp>
 
+#include <array>
 #include <cstring>
 #include <string>
 
+#include "hera/container/pair.hpp"
 #include "hera/container/tuple.hpp"
 #include "hera/ranges.hpp"
 
 template<std::size_t I>
 constexpr auto size_ = std::integral_constant<std::size_t, I>{};
 
+namespace
+{
+/// counts how often it was copied or moved
+struct counted
+{
+    int  value;
+    int* copies;
+
+    counted(int v, int* c) : value{v}, copies{c}
+    {}
+
+    counted(const counted& other) : value{other.value}, copies{other.copies}
+    {
+        ++*copies;
+    }
+
+    counted(counted&& other) noexcept
+        : value{other.value}, copies{other.copies}
+    {
+        ++*copies;
+    }
+};
+} // namespace
+
 TEST_CASE("tuple")
 {
     auto tup    = hera::tuple{"hello", "tuple", 42};
@@ -66,5 +92,51 @@ TEST_CASE("tuple")
         REQUIRE(tup_str.back() != "world"); // show the moved from state
         REQUIRE(tup_str1.back() == "world");
         REQUIRE(tup_str1.front() == "knock knock");
+
+        // the new element is constructed in place
+        int  copies = 0;
+        auto tup2   = hera::tuple{1}.emplace_back<counted>(2, &copies);
+        REQUIRE(copies == 0);
+
+        auto tup3 = std::move(tup2).emplace_front<counted>(0, &copies);
+        REQUIRE(copies == 1);
+        REQUIRE(hera::get<0>(tup3).value == 0);
+        REQUIRE(hera::get<2>(tup3).value == 2);
+    }
+
+    SECTION("tuple_cat")
+    {
+        int value = 5;
+
+        const auto cat = hera::tuple_cat(hera::tuple<int, int&>{1, value},
+                                         hera::pair<char, double>{'a', 2.5},
+                                         std::array<short, 2>{3, 4},
+                                         hera::tuple<>{});
+
+        static_assert(
+            hera::same_as<
+                const hera::tuple<int, int&, char, double, short, short>,
+                decltype(cat)>);
+
+        REQUIRE(hera::get<0>(cat) == 1);
+        REQUIRE(&hera::get<1>(cat) == &value);
+        REQUIRE(hera::get<2>(cat) == 'a');
+        REQUIRE(hera::get<5>(cat) == 4);
+
+        static_assert(
+            hera::same_as<hera::tuple<>, decltype(hera::tuple_cat())>);
+
+        // every element is moved once from rvalues and copied once from
+        // lvalues
+        int        copies = 0;
+        const auto lvalue = hera::tuple<counted>{counted{1, &copies}};
+        auto rvalue = hera::tuple<counted, counted>{counted{2, &copies},
+                                                    counted{3, &copies}};
+        copies      = 0;
+
+        const auto both = hera::tuple_cat(lvalue, std::move(rvalue));
+        REQUIRE(copies == 3);
+        REQUIRE(hera::get<0>(both).value == 1);
+        REQUIRE(hera::get<2>(both).value == 3);
     }
 }
\ No newline at end of file
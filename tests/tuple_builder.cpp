@@ -0,0 +1,96 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <string>
+#include <utility>
+
+#include "hera/container/tuple.hpp"
+#include "hera/container/tuple_builder.hpp"
+
+namespace
+{
+/// counts how often it was copied or moved
+struct counted
+{
+    int  value;
+    int* copies;
+
+    counted(int v, int* c) : value{v}, copies{c}
+    {}
+
+    counted(const counted& other) : value{other.value}, copies{other.copies}
+    {
+        ++*copies;
+    }
+
+    counted(counted&& other) noexcept
+        : value{other.value}, copies{other.copies}
+    {
+        ++*copies;
+    }
+};
+} // namespace
+
+TEST_CASE("tuple_builder")
+{
+    SECTION("elements in order")
+    {
+        const std::string name = "abc";
+
+        auto tup = hera::tuple_builder{}
+                       .push_back(1)
+                       .emplace_back<std::string>(3, 'x')
+                       .push_front(name)
+                       .emplace_front<double>(0.5)
+                       .build();
+
+        static_assert(
+            hera::same_as<hera::tuple<double, std::string, int, std::string>,
+                          decltype(tup)>);
+
+        REQUIRE(hera::get<0>(tup) == 0.5);
+        REQUIRE(hera::get<1>(tup) == "abc");
+        REQUIRE(hera::get<2>(tup) == 1);
+        REQUIRE(hera::get<3>(tup) == "xxx");
+
+        static_assert(hera::same_as<hera::tuple<>,
+                                    decltype(hera::tuple_builder{}.build())>);
+    }
+
+    SECTION("constructed once")
+    {
+        int copies = 0;
+
+        counted first{1, &copies};
+        auto    rest = hera::tuple<counted, int>{counted{3, &copies}, 4};
+        copies       = 0;
+
+        auto tup = hera::tuple_builder{}
+                       .push_back(first)
+                       .emplace_back<counted>(2, &copies)
+                       .append(std::move(rest))
+                       .build();
+
+        static_assert(hera::same_as<hera::tuple<counted, counted, counted, int>,
+                                    decltype(tup)>);
+
+        // one copy of `first`, one move out of `rest`, nothing for the
+        // emplaced element however long the chain
+        REQUIRE(copies == 2);
+        REQUIRE(hera::get<0>(tup).value == 1);
+        REQUIRE(hera::get<1>(tup).value == 2);
+        REQUIRE(hera::get<2>(tup).value == 3);
+        REQUIRE(hera::get<3>(tup) == 4);
+    }
+
+    SECTION("immovable elements")
+    {
+        auto tup = hera::tuple_builder{}
+                       .emplace_back<std::atomic<int>>(7)
+                       .push_back(8)
+                       .build();
+
+        REQUIRE(hera::get<0>(tup).load() == 7);
+        REQUIRE(hera::get<1>(tup) == 8);
+    }
+}
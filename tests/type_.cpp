@@ -89,6 +89,21 @@ TEST_CASE("type_")
     }
 }
 
+TEST_CASE("type_ hash")
+{
+    static_assert(hera::type_<int>::name() == "int");
+    static_assert(hera::type_<std::optional<int>>::name() ==
+                  "std::optional<int>");
+
+    static_assert(hera::type_<int>::hash() == hera::type_<int>::hash());
+    static_assert(hera::type_<int>::hash() != hera::type_<const int>::hash());
+    static_assert(hera::type_<int>::hash() != hera::type_<int&>::hash());
+    static_assert(hera::type_<float>::hash() != hera::type_<double>::hash());
+
+    // usable at runtime as well
+    REQUIRE(hera::type_<char>::hash() == hera::typeid_('c').hash());
+}
+
 TEST_CASE("forward_type_")
 {
     auto i     = hera::type_<int&>{};
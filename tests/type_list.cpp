@@ -43,4 +43,53 @@ TEST_CASE("type_list")
         // static_assert(
         //    decltype(str == hera::type_<const char*>{})::value);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("type_list set operations")
+{
+    constexpr auto lhs = hera::type_list<int, float, int, char, float>{};
+    constexpr auto rhs = hera::type_list<double, char, int>{};
+
+    static_assert(decltype(lhs.contains(hera::type_<char>{}))::value);
+    static_assert(!decltype(lhs.contains(hera::type_<double>{}))::value);
+    static_assert(!decltype(lhs.contains(hera::type_<const int>{}))::value);
+
+    static_assert(hera::same_as<hera::type_list<int, float, char>,
+                                decltype(lhs.unique())>);
+
+    static_assert(hera::same_as<hera::type_list<int, float, char, double>,
+                                decltype(lhs.union_(rhs))>);
+
+    static_assert(hera::same_as<hera::type_list<int, char>,
+                                decltype(lhs.intersection(rhs))>);
+
+    static_assert(
+        hera::same_as<hera::type_list<float>, decltype(lhs.difference(rhs))>);
+
+    SECTION("empty")
+    {
+        constexpr auto none = hera::type_list<>{};
+
+        static_assert(hera::same_as<hera::type_list<>, decltype(none.unique())>);
+        static_assert(hera::same_as<hera::type_list<>,
+                                    decltype(lhs.intersection(none))>);
+        static_assert(hera::same_as<hera::type_list<int, float, char>,
+                                    decltype(lhs.difference(none))>);
+    }
+
+    SECTION("unnamed types")
+    {
+        // both lambdas may be spelled the same, the identity still differs
+        auto first  = [] {};
+        auto second = [] {};
+
+        using first_t  = decltype(first);
+        using second_t = decltype(second);
+
+        static_assert(hera::same_as<hera::type_list<first_t, second_t>,
+                                    decltype(hera::type_list<first_t,
+                                                             second_t,
+                                                             first_t>{}
+                                                 .unique())>);
+    }
+}
@@ -0,0 +1,80 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+
+#include "hera/container/type_map.hpp"
+#include "hera/ranges.hpp"
+
+namespace
+{
+struct logger
+{
+    int level;
+};
+
+struct metrics
+{
+    std::string prefix;
+};
+
+struct tracer
+{};
+
+template<typename... Ts>
+concept valid_type_map = requires
+{
+    typename hera::type_map<Ts...>;
+};
+} // namespace
+
+TEST_CASE("type_map")
+{
+    auto map = hera::type_map<logger, metrics, tracer>{
+        logger{3}, metrics{"svc"}, tracer{}};
+
+    static_assert(hera::bounded_range<decltype(map)>);
+    static_assert(hera::size_v<decltype(map)> == 3);
+    static_assert(
+        hera::same_as<metrics, hera::element_type_t<decltype(map), 1>>);
+
+    REQUIRE(map.get<logger>().level == 3);
+    REQUIRE(map.get<metrics>().prefix == "svc");
+
+    static_assert(hera::same_as<logger&, decltype(map.get<logger>())>);
+    static_assert(
+        hera::same_as<metrics&&, decltype(std::move(map).get<metrics>())>);
+
+    map.get<logger>().level = 5;
+    REQUIRE(hera::get<0>(map).level == 5);
+
+    static_assert(decltype(map.contains<tracer>())::value);
+    static_assert(!decltype(map.contains<int>())::value);
+    static_assert(decltype(map.index_of<metrics>())::value == 1);
+
+    SECTION("const")
+    {
+        const auto& cmap = map;
+
+        static_assert(hera::same_as<const logger&, decltype(cmap.get<logger>())>);
+        static_assert(hera::same_as<const metrics,
+                                    hera::element_type_t<decltype(cmap), 1>>);
+        REQUIRE(cmap.get<metrics>().prefix == "svc");
+    }
+
+    SECTION("deduction")
+    {
+        auto deduced = hera::type_map{42, 4.2, std::string{"hi"}};
+
+        REQUIRE(deduced.get<int>() == 42);
+        REQUIRE(deduced.get<std::string>() == "hi");
+        REQUIRE(hera::make_type_map('c', 1u).get<char>() == 'c');
+    }
+
+    SECTION("uniqueness")
+    {
+        static_assert(hera::unique_types<int, float, char>);
+        static_assert(!hera::unique_types<int, float, int>);
+        static_assert(valid_type_map<int, float>);
+        static_assert(!valid_type_map<int, int>);
+    }
+}